@@ -0,0 +1,127 @@
+#include "stdafx.h"
+#include "artwork_events.h"
+#include "async_io_manager.h"
+#include "foo_artwork_log.h"
+#include <algorithm>
+#include <atomic>
+
+// Immediate repaint of every panel (ui_element.cpp, artwork_panel_cui.cpp)
+extern void refresh_all_dui_artwork_panels();
+extern void refresh_all_cui_artwork_panels();
+
+static shared_hbitmap g_main_component_image;
+
+shared_hbitmap make_shared_hbitmap(HBITMAP bitmap) {
+    if (!bitmap) return shared_hbitmap();
+    return shared_hbitmap(bitmap, [](HBITMAP b) { DeleteObject(b); });
+}
+
+// std::atomic_load on a shared_ptr takes MSVC's process-wide spin lock. Panels read the
+// image once per paint, unlike the per-row titleformat snapshot (titleformat_provider.cpp).
+shared_hbitmap get_main_component_artwork_image() {
+    return std::atomic_load(&g_main_component_image);
+}
+
+void set_main_component_artwork_image(shared_hbitmap image) {
+    std::atomic_store(&g_main_component_image, std::move(image));
+}
+
+ArtworkEventManager& ArtworkEventManager::get() {
+    static ArtworkEventManager s_instance;
+    return s_instance;
+}
+
+void ArtworkEventManager::subscribe(IArtworkEventListener* listener) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_listeners.push_back(listener);
+}
+
+void ArtworkEventManager::unsubscribe(IArtworkEventListener* listener) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_listeners.erase(std::remove(m_listeners.begin(), m_listeners.end(), listener), m_listeners.end());
+}
+
+void ArtworkEventManager::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_listeners.clear();
+    m_pending.reset();
+}
+
+bool ArtworkEventManager::is_subscribed(IArtworkEventListener* listener) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::find(m_listeners.begin(), m_listeners.end(), listener) != m_listeners.end();
+}
+
+void ArtworkEventManager::notify(const ArtworkEvent& event) {
+    if (g_is_shutting_down.load() || core_api::is_shutting_down()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // A LOADED without an image only carries the source name; it must not
+        // replace a queued one that the panels would actually display
+        if (event.type == ArtworkEventType::ARTWORK_LOADED && !event.image && m_pending &&
+            m_pending->type == ArtworkEventType::ARTWORK_LOADED && m_pending->image) {
+            return;
+        }
+
+        m_pending = std::make_shared<const ArtworkEvent>(event);
+        if (m_flush_posted) return;
+        m_flush_posted = true;
+    }
+
+    async_io_manager::instance().post_to_main_thread([this]() { flush(); });
+}
+
+void ArtworkEventManager::flush() {
+    std::shared_ptr<const ArtworkEvent> event;
+    std::vector<IArtworkEventListener*> listeners;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        event.swap(m_pending);
+        m_flush_posted = false;
+        listeners = m_listeners;
+    }
+    if (!event) return;
+
+    for (auto* listener : listeners) {
+        if (g_is_shutting_down.load() || core_api::is_shutting_down()) return;
+        // An earlier listener may have destroyed a panel further down the list
+        if (!listener || !is_subscribed(listener)) continue;
+        try {
+            listener->on_artwork_event(*event);
+        } catch (...) {
+            // Continue notifying other listeners even if one fails
+        }
+    }
+}
+
+void subscribe_to_artwork_events(IArtworkEventListener* listener) {
+    ArtworkEventManager::get().subscribe(listener);
+}
+
+void unsubscribe_from_artwork_events(IArtworkEventListener* listener) {
+    ArtworkEventManager::get().unsubscribe(listener);
+}
+
+static std::atomic<unsigned> g_panel_refresh_reasons{0};
+static std::atomic<unsigned> g_panel_refresh_requests{0};
+
+static void flush_panel_refresh() {
+    unsigned requests = g_panel_refresh_requests.exchange(0);
+    unsigned reasons = g_panel_refresh_reasons.exchange(0);
+    if (!reasons) return;
+
+    foo_artwork::log_printf("foo_artwork: Refreshing artwork panels (%u request(s), reasons 0x%x)", requests, reasons);
+    refresh_all_dui_artwork_panels();
+    refresh_all_cui_artwork_panels();
+}
+
+void request_panel_refresh(unsigned reasons) {
+    if (!reasons) return;
+    g_panel_refresh_requests.fetch_add(1);
+
+    // Only the request that finds the panels clean schedules the flush
+    if (g_panel_refresh_reasons.fetch_or(reasons) != 0) return;
+    async_io_manager::instance().post_to_main_thread(flush_panel_refresh);
+}
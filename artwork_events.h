@@ -0,0 +1,100 @@
+#pragma once
+#include "stdafx.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Decoded artwork shared by the loader, the event queue and the panels. The GDI
+// bitmap is deleted when the last reference goes away, so a panel can still be
+// drawing from an event's image while the next track is being decoded.
+typedef std::shared_ptr<std::remove_pointer<HBITMAP>::type> shared_hbitmap;
+
+// Takes ownership of bitmap; nullptr gives an empty image
+shared_hbitmap make_shared_hbitmap(HBITMAP bitmap);
+
+// Artwork most recently decoded by the main component (empty if none).
+// Safe to call from any thread.
+shared_hbitmap get_main_component_artwork_image();
+void set_main_component_artwork_image(shared_hbitmap image);
+
+//=============================================================================
+// Event-Driven Artwork System
+//=============================================================================
+
+// Artwork event types
+enum class ArtworkEventType {
+    ARTWORK_LOADED,     // New artwork loaded successfully
+    ARTWORK_LOADING,    // Search started
+    ARTWORK_FAILED,     // Search failed
+    ARTWORK_CLEARED     // Artwork cleared
+};
+
+// Artwork event data
+struct ArtworkEvent {
+    ArtworkEventType type;
+    shared_hbitmap image;   // Keeps the bitmap alive for as long as the event is
+    HBITMAP bitmap;         // image.get()
+    std::string source;
+    std::string artist;
+    std::string title;
+
+    ArtworkEvent(ArtworkEventType t, shared_hbitmap img = shared_hbitmap(), const std::string& src = "",
+                 const std::string& art = "", const std::string& ttl = "")
+        : type(t), image(std::move(img)), bitmap(image.get()), source(src), artist(art), title(ttl) {}
+};
+
+// Artwork event listener interface
+class IArtworkEventListener {
+public:
+    virtual ~IArtworkEventListener() = default;
+    // Always called on the main thread
+    virtual void on_artwork_event(const ArtworkEvent& event) = 0;
+};
+
+// Artwork event bus (singleton). notify() can be called from any thread; the
+// event is queued and delivered to every listener from the main thread on the
+// next message-loop turn. Events arriving before that replace the queued one, so
+// LOADING -> FAILED -> LOADED during a burst of track skips reaches each panel
+// as a single LOADED and costs one repaint.
+class ArtworkEventManager {
+public:
+    static ArtworkEventManager& get();
+
+    void subscribe(IArtworkEventListener* listener);
+    void unsubscribe(IArtworkEventListener* listener);
+    // Drops all listeners and any queued event
+    void clear();
+    void notify(const ArtworkEvent& event);
+
+private:
+    void flush();
+    bool is_subscribed(IArtworkEventListener* listener);
+
+    std::mutex m_mutex;
+    std::vector<IArtworkEventListener*> m_listeners;
+    std::shared_ptr<const ArtworkEvent> m_pending;
+    bool m_flush_posted = false;
+};
+
+// Wrappers kept for the panels and the exported C API
+void subscribe_to_artwork_events(IArtworkEventListener* listener);
+void unsubscribe_from_artwork_events(IArtworkEventListener* listener);
+
+//=============================================================================
+// Coalesced panel refresh
+//=============================================================================
+
+// Why the panels are being refreshed; requests made before the flush are OR-ed together
+enum panel_refresh_reason : unsigned {
+    panel_refresh_artwork_ready     = 1 << 0,   // New artwork is in the cache / titleformat info
+    panel_refresh_provider_rejected = 1 << 1,   // Artwork rejected, look up again without that provider
+    panel_refresh_recognition_due   = 1 << 2,   // ACRCloud recognition may run again on this stream
+    panel_refresh_external          = 1 << 3    // foo_artwork_refresh() from another component
+};
+
+// Marks every DUI and CUI artwork panel dirty. Safe to call from any thread.
+// Everything requested before the next main-thread turn is handled by one
+// flush, so N requests cost one repaint per panel.
+void request_panel_refresh(unsigned reasons);
@@ -4,273 +4,30 @@
 #include "preferences.h"
 #include "acrcloud_client.h"
 #include "titleformat_provider.h"
+#include "image_probe.h"
+#include "provider_health.h"
+#include "sse_client.h"
+#include "json_extractor.h"
+#include "candidate_ranker.h"
+#include "track_matcher.h"
+#include "titleformat_script_cache.h"
+#include "artwork_events.h"
 #include <winhttp.h>
 #include <shlwapi.h>
 #include <shlobj.h>
 #include <thread>
 #include <chrono>
 #include <algorithm>
+#include <climits>
 #include <set>
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 
-// Normalize diacritics/accented characters to ASCII equivalents (UTF-8 aware)
-static std::string normalize_diacritics(const std::string& s) {
-    std::string result;
-    result.reserve(s.size());
-
-    for (size_t i = 0; i < s.size(); ++i) {
-        unsigned char c = static_cast<unsigned char>(s[i]);
-
-        // Check for UTF-8 two-byte sequences starting with 0xC3 (Latin-1 Supplement)
-        if (c == 0xC3 && i + 1 < s.size()) {
-            unsigned char next = static_cast<unsigned char>(s[i + 1]);
-            char replacement = 0;
-
-            // Uppercase variants (0xC3 0x80-0x9F)
-            if (next >= 0x80 && next <= 0x85) replacement = 'A';       // À Á Â Ã Ä Å
-            else if (next == 0x86) { result += "AE"; i++; continue; }  // Æ
-            else if (next == 0x87) replacement = 'C';                  // Ç
-            else if (next >= 0x88 && next <= 0x8B) replacement = 'E';  // È É Ê Ë
-            else if (next >= 0x8C && next <= 0x8F) replacement = 'I';  // Ì Í Î Ï
-            else if (next == 0x90) replacement = 'D';                  // Ð
-            else if (next == 0x91) replacement = 'N';                  // Ñ
-            else if (next >= 0x92 && next <= 0x96) replacement = 'O';  // Ò Ó Ô Õ Ö
-            else if (next == 0x98) replacement = 'O';                  // Ø
-            else if (next >= 0x99 && next <= 0x9C) replacement = 'U';  // Ù Ú Û Ü
-            else if (next == 0x9D) replacement = 'Y';                  // Ý
-            // Lowercase variants (0xC3 0xA0-0xBF)
-            else if (next >= 0xA0 && next <= 0xA5) replacement = 'a';  // à á â ã ä å
-            else if (next == 0xA6) { result += "ae"; i++; continue; }  // æ
-            else if (next == 0xA7) replacement = 'c';                  // ç
-            else if (next >= 0xA8 && next <= 0xAB) replacement = 'e';  // è é ê ë
-            else if (next >= 0xAC && next <= 0xAF) replacement = 'i';  // ì í î ï
-            else if (next == 0xB0) replacement = 'd';                  // ð
-            else if (next == 0xB1) replacement = 'n';                  // ñ
-            else if (next >= 0xB2 && next <= 0xB6) replacement = 'o';  // ò ó ô õ ö
-            else if (next == 0xB8) replacement = 'o';                  // ø
-            else if (next >= 0xB9 && next <= 0xBC) replacement = 'u';  // ù ú û ü
-            else if (next == 0xBD || next == 0xBF) replacement = 'y';  // ý ÿ
-            else if (next == 0x9F) { result += "ss"; i++; continue; }  // ß (German eszett)
-
-            if (replacement) {
-                result += replacement;
-                i++;  // Skip the second byte
-                continue;
-            }
-        }
-
-        // Check for UTF-8 two-byte sequences starting with 0xC5 (Latin Extended-A)
-        if (c == 0xC5 && i + 1 < s.size()) {
-            unsigned char next = static_cast<unsigned char>(s[i + 1]);
-            char replacement = 0;
-
-            if (next == 0x92 || next == 0x93) {  // Œ œ
-                result += (next == 0x92) ? "OE" : "oe";
-                i++;
-                continue;
-            }
-            else if (next == 0xA0 || next == 0xA1) replacement = (next == 0xA0) ? 'S' : 's';  // Š š
-            else if (next == 0xBD || next == 0xBE) replacement = (next == 0xBD) ? 'Z' : 'z';  // Ž ž
-
-            if (replacement) {
-                result += replacement;
-                i++;
-                continue;
-            }
-        }
-
-        // Pass through other characters unchanged
-        result += s[i];
-    }
-
-    return result;
-}
-
-// Normalize string for fuzzy matching: removes diacritics, punctuation, normalizes "AND"/"&", lowercases
-static std::string normalize_for_matching(const std::string& s) {
-    // First normalize diacritics (ö→o, é→e, etc.)
-    std::string diacritic_normalized = normalize_diacritics(s);
-
-    std::string result;
-    result.reserve(diacritic_normalized.size());
-
-    for (size_t i = 0; i < diacritic_normalized.size(); ++i) {
-        char c = diacritic_normalized[i];
-
-        // Skip punctuation (periods, commas, apostrophes, etc.)
-        if (c == '.' || c == ',' || c == '\'' || c == '!' || c == '?' || c == '-') {
-            continue;
-        }
-
-        // Treat underscores as spaces (common in stream metadata)
-        if (c == '_') {
-            result += ' ';
-            continue;
-        }
-
-        // Convert to lowercase
-        result += std::tolower(static_cast<unsigned char>(c));
-    }
-
-    // Normalize " and " to " & " for consistent comparison
-    // Process the result to handle "and" vs "&"
-    std::string normalized;
-    normalized.reserve(result.size());
-
-    for (size_t i = 0; i < result.size(); ++i) {
-        // Check for " and " pattern (with spaces)
-        if (i + 4 < result.size() &&
-            result[i] == ' ' &&
-            result[i+1] == 'a' &&
-            result[i+2] == 'n' &&
-            result[i+3] == 'd' &&
-            result[i+4] == ' ') {
-            normalized += ' ';  // Replace " and " with single space (remove the word entirely)
-            i += 4;  // Skip past " and " (loop will add 1 more)
-            continue;
-        }
-
-        // Check for " & " pattern
-        if (i + 2 < result.size() &&
-            result[i] == ' ' &&
-            result[i+1] == '&' &&
-            result[i+2] == ' ') {
-            normalized += ' ';  // Replace " & " with single space
-            i += 2;  // Skip past " & "
-            continue;
-        }
-
-        normalized += result[i];
-    }
-
-    // Collapse multiple spaces into one
-    result.clear();
-    bool last_was_space = false;
-    for (char c : normalized) {
-        if (c == ' ') {
-            if (!last_was_space) {
-                result += c;
-                last_was_space = true;
-            }
-        } else {
-            result += c;
-            last_was_space = false;
-        }
-    }
-
-    // Trim leading/trailing spaces
-    size_t start = result.find_first_not_of(' ');
-    if (start == std::string::npos) return "";
-    size_t end = result.find_last_not_of(' ');
-
-    return result.substr(start, end - start + 1);
-}
-
-// Case-insensitive string comparison helper for matching artist/track names
-static bool strings_equal_ignore_case(const std::string& a, const std::string& b) {
-    if (a.size() != b.size()) return false;
-    for (size_t i = 0; i < a.size(); ++i) {
-        if (std::tolower(static_cast<unsigned char>(a[i])) !=
-            std::tolower(static_cast<unsigned char>(b[i]))) {
-            return false;
-        }
-    }
-    return true;
-}
-
-// Fuzzy string comparison that normalizes before comparing
-static bool strings_match_fuzzy(const std::string& a, const std::string& b) {
-    // First try exact case-insensitive match (fast path)
-    if (a.size() == b.size() && strings_equal_ignore_case(a, b)) {
-        return true;
-    }
-
-    // Normalize both strings and compare
-    std::string norm_a = normalize_for_matching(a);
-    std::string norm_b = normalize_for_matching(b);
-
-    return norm_a == norm_b;
-}
-
-// Helper to strip "The " prefix from artist names for fuzzy matching
-static std::string strip_the_prefix(const std::string& s) {
-    if (s.size() > 4) {
-        // Check for "The " prefix (case-insensitive)
-        if ((s[0] == 'T' || s[0] == 't') &&
-            (s[1] == 'H' || s[1] == 'h') &&
-            (s[2] == 'E' || s[2] == 'e') &&
-            s[3] == ' ') {
-            return s.substr(4);
-        }
-    }
-    return s;
-}
-
-// Fuzzy artist comparison: handles case, punctuation, "The " prefix, and "AND"/"&" differences
-static bool artists_match(const std::string& a, const std::string& b) {
-    // First try exact case-insensitive match (fast path)
-    if (strings_equal_ignore_case(a, b)) return true;
-
-    // Try fuzzy match (handles punctuation like "T. Rex" vs "T Rex", and "AND" vs "&")
-    if (strings_match_fuzzy(a, b)) return true;
-
-    // Try matching after stripping "The " prefix from both
-    std::string a_stripped = strip_the_prefix(a);
-    std::string b_stripped = strip_the_prefix(b);
-
-    if (strings_equal_ignore_case(a_stripped, b_stripped)) return true;
-
-    // Try fuzzy match on stripped versions too
-    if (strings_match_fuzzy(a_stripped, b_stripped)) return true;
-
-    // Try matching extracted first artists for multi-artist collaborations
-    std::string first_a = MetadataCleaner::extract_first_artist(a.c_str());
-    std::string first_b = MetadataCleaner::extract_first_artist(b.c_str());
-
-    if (!first_a.empty() && !first_b.empty() && (first_a != a || first_b != b)) {
-        if (strings_equal_ignore_case(first_a, first_b)) return true;
-        if (strings_match_fuzzy(first_a, first_b)) return true;
-
-        std::string first_a_stripped = strip_the_prefix(first_a);
-        std::string first_b_stripped = strip_the_prefix(first_b);
-        if (strings_equal_ignore_case(first_a_stripped, first_b_stripped)) return true;
-        if (strings_match_fuzzy(first_a_stripped, first_b_stripped)) return true;
-    }
-
-    if (!first_a.empty() && first_a != a) {
-        if (strings_equal_ignore_case(first_a, b)) return true;
-        if (strings_match_fuzzy(first_a, b)) return true;
-        std::string first_a_stripped = strip_the_prefix(first_a);
-        if (strings_equal_ignore_case(first_a_stripped, b_stripped)) return true;
-        if (strings_match_fuzzy(first_a_stripped, b_stripped)) return true;
-    }
-
-    if (!first_b.empty() && first_b != b) {
-        if (strings_equal_ignore_case(a, first_b)) return true;
-        if (strings_match_fuzzy(a, first_b)) return true;
-        std::string first_b_stripped = strip_the_prefix(first_b);
-        if (strings_equal_ignore_case(a_stripped, first_b_stripped)) return true;
-        if (strings_match_fuzzy(a_stripped, first_b_stripped)) return true;
-    }
-
-    // Try matching extracted second artists (e.g. Gouryella from Ferry Corsten pres. Gouryella)
-    std::string second_a = MetadataCleaner::extract_second_artist(a.c_str());
-    std::string second_b = MetadataCleaner::extract_second_artist(b.c_str());
-
-    if (!second_a.empty()) {
-        if (strings_equal_ignore_case(second_a, b)) return true;
-        if (strings_match_fuzzy(second_a, b)) return true;
-        if (!first_b.empty() && (strings_equal_ignore_case(second_a, first_b) || strings_match_fuzzy(second_a, first_b))) return true;
-    }
-
-    if (!second_b.empty()) {
-        if (strings_equal_ignore_case(a, second_b)) return true;
-        if (strings_match_fuzzy(a, second_b)) return true;
-        if (!first_a.empty() && (strings_equal_ignore_case(first_a, second_b) || strings_match_fuzzy(first_a, second_b))) return true;
-    }
-
-    return false;
+// Provider lengths are reported in milliseconds
+static unsigned ms_to_seconds(const std::string* ms) {
+    if (!ms) return 0;
+    long long value = _atoi64(ms->c_str());
+    return value > 0 ? (unsigned)((value + 500) / 1000) : 0;
 }
 
 #pragma comment(lib, "winhttp.lib")
@@ -289,6 +46,8 @@ extern cfg_string cfg_discogs_consumer_secret;
 extern cfg_string cfg_lastfm_key;
 extern cfg_int cfg_http_timeout;
 extern cfg_int cfg_retry_count;
+extern cfg_int cfg_min_artwork_size;
+extern cfg_bool cfg_full_resolution_artwork;
 extern cfg_bool cfg_enable_disk_cache;
 extern cfg_bool cfg_single_file_cache;
 extern cfg_bool cfg_enable_acrcloud;
@@ -321,6 +80,20 @@ static pfc::string8 g_active_cache_key;
 static std::set<std::string> g_rejected_providers_for_current_track;
 static std::atomic<uint64_t> g_search_generation{0};
 
+// URL the current online artwork was downloaded from (main thread only)
+static pfc::string8 g_active_artwork_url;
+
+// Length in seconds of the track being searched, 0 if unknown (streams). Read by the
+// provider parsers on I/O threads to rank candidates.
+static std::atomic<unsigned> g_expected_track_seconds{0};
+
+// Largest edge (device pixels) of each visible artwork panel, used to right-size provider downloads
+static std::mutex g_panel_size_mutex;
+static std::map<const void*, unsigned> g_panel_artwork_sizes;
+
+// Edge lengths panel-sized artwork is cached under, smallest first
+static const unsigned ARTWORK_CACHE_TIERS[] = { 150, 300, 600, 1200 };
+
 pfc::string8 artwork_manager::get_active_resolved_provider() {
     return g_active_resolved_provider;
 }
@@ -329,6 +102,107 @@ pfc::string8 artwork_manager::get_active_source() {
     return g_active_source;
 }
 
+void artwork_manager::set_panel_artwork_size(const void* panel, unsigned pixels) {
+    std::lock_guard<std::mutex> lock(g_panel_size_mutex);
+    if (pixels == 0) {
+        g_panel_artwork_sizes.erase(panel);
+    } else {
+        g_panel_artwork_sizes[panel] = pixels;
+    }
+}
+
+unsigned artwork_manager::get_target_artwork_size() {
+    if (cfg_full_resolution_artwork) return 0;
+
+    unsigned largest = 0;
+    {
+        std::lock_guard<std::mutex> lock(g_panel_size_mutex);
+        for (const auto& entry : g_panel_artwork_sizes) {
+            largest = (std::max)(largest, entry.second);
+        }
+    }
+
+    // No panel has reported its size yet - keep full resolution
+    if (largest == 0) return 0;
+
+    // Never ask for less than the minimum accepted artwork size
+    unsigned min_size = cfg_min_artwork_size > 0 ? (unsigned)(int)cfg_min_artwork_size : 0;
+    largest = (std::max)(largest, min_size);
+
+    // Round up to a cache tier so an image cached for a tier covers every panel size
+    // within it; beyond the largest tier the full image is wanted anyway
+    for (unsigned tier : ARTWORK_CACHE_TIERS) {
+        if (largest <= tier) return tier;
+    }
+    return 0;
+}
+
+// Panel-sized downloads are cached per size tier ("Artist_Title@300"), full resolution
+// artwork under the plain key, so a larger panel never gets a smaller cached image
+static void append_size_tier(pfc::string8& key) {
+    unsigned tier = artwork_manager::get_target_artwork_size();
+    if (tier > 0) key << "@" << pfc::format_int(tier);
+}
+
+// Cache key without its "@<tier>" suffix, i.e. the key of the full resolution image
+static pfc::string8 strip_size_tier(const pfc::string8& key) {
+    t_size at = key.find_last('@');
+    if (at == pfc_infinite) return key;
+    for (unsigned tier : ARTWORK_CACHE_TIERS) {
+        if (strcmp(key.get_ptr() + at + 1, pfc::format_int(tier)) == 0) {
+            pfc::string8 base = key;
+            base.truncate(at);
+            return base;
+        }
+    }
+    return key;
+}
+
+// Keys a cached image for key can be found under: key itself, then every larger tier,
+// then the full resolution key. Images cached before size tiers existed, or while a
+// larger panel was open, are still served instead of being downloaded again.
+static std::vector<pfc::string8> cache_lookup_keys(const pfc::string8& key) {
+    std::vector<pfc::string8> keys(1, key);
+    pfc::string8 base = strip_size_tier(key);
+    if (base == key) return keys;
+
+    unsigned tier = (unsigned)atoi(key.get_ptr() + base.get_length() + 1);
+    for (unsigned larger : ARTWORK_CACHE_TIERS) {
+        if (larger <= tier) continue;
+        pfc::string8 larger_key = base;
+        larger_key << "@" << pfc::format_int(larger);
+        keys.push_back(larger_key);
+    }
+    keys.push_back(base);
+    return keys;
+}
+
+// cache_get_async over cache_lookup_keys(key); found_key is the key that hit
+typedef std::function<void(bool success, const image_buffer& data, const pfc::string8& found_key)> tiered_cache_callback;
+
+static void cache_get_tiered_async(std::shared_ptr<const std::vector<pfc::string8>> keys, size_t index, tiered_cache_callback callback) {
+    async_io_manager::instance().cache_get_async((*keys)[index],
+        [keys, index, callback](bool success, const image_buffer& data, const pfc::string8& error) {
+            if (success && data.get_size() > 0) {
+                if (index > 0) {
+                    // Stored under the requested key as well, so the cover path reported for
+                    // the track exists and the next lookup hits at once
+                    foo_artwork::log_printf("foo_artwork: Cache hit for '%s' under '%s'", (*keys)[0].c_str(), (*keys)[index].c_str());
+                    async_io_manager::instance().cache_set_async((*keys)[0], data);
+                }
+                callback(true, data, (*keys)[index]);
+            } else if (index + 1 < keys->size()) {
+                cache_get_tiered_async(keys, index + 1, callback);
+            } else {
+                callback(false, image_buffer(), pfc::string8());
+            }
+        });
+}
+
+static void cache_get_tiered_async(const pfc::string8& key, tiered_cache_callback callback) {
+    cache_get_tiered_async(std::make_shared<const std::vector<pfc::string8>>(cache_lookup_keys(key)), 0, callback);
+}
+
 static bool contains_case_insensitive(const char* haystack, const char* needle) {
     if (!haystack || !needle) return false;
     pfc::string8 h(haystack);
@@ -350,12 +224,14 @@ static visualisation_stream::ptr get_persistent_vis_stream();
 static void stop_rms_silence_detector(bool force = true);
 static void reset_acrcloud_cooldown();
 static void log_simplified_track_info(const char* artist, const char* title);
+static void load_full_resolution_urls();
 
 void artwork_manager::initialize() {
     g_is_shutting_down.store(false);
     if (initialized_.exchange(true)) return; // Already initialized
     
     async_io_manager::instance().initialize(4); // 4 thread pool workers
+    load_full_resolution_urls();
 }
 
 void artwork_manager::shutdown() {
@@ -365,6 +241,11 @@ void artwork_manager::shutdown() {
     if (!initialized_.exchange(false)) return; // Not initialized
     
     async_io_manager::instance().shutdown();
+    titleformat_script_cache::clear();
+
+    // Release the metadb handles held for %foo_artwork_*% fields while the core is still up
+    titleformat_provider::forget_recorded_artwork(false);
+    titleformat_provider::clear_track_artwork_info();
 }
 
 void artwork_manager::on_playback_new_track(metadb_handle_ptr track) {
@@ -380,6 +261,7 @@ void artwork_manager::on_playback_new_track(metadb_handle_ptr track) {
     g_active_playing_track = track;
     g_active_source.reset();
     g_active_resolved_provider.reset();
+    g_active_artwork_url.reset();
     g_rejected_providers_for_current_track.clear();
     g_last_stream_artist.reset();
     g_last_stream_title.reset();
@@ -427,9 +309,7 @@ void artwork_manager::on_playback_stop() {
     }
 }
 
-extern void refresh_all_dui_artwork_panels();
-extern void refresh_all_cui_artwork_panels();
-extern bool create_bitmap_from_image_data(const std::vector<BYTE>& data);
+extern bool create_bitmap_from_image_data(const image_buffer& data);
 
 void artwork_manager::get_artwork_async(metadb_handle_ptr track, artwork_callback callback) {
     ASSERT_MAIN_THREAD();
@@ -787,6 +667,32 @@ pfc::string8 artwork_manager::extract_broadcast_artwork_url_from_info(const file
     return "";
 }
 
+// Joins patterns into one script whose output lists each result, '\x01'-separated,
+// so a single evaluation covers every candidate field
+static pfc::string8 build_combined_pattern(const char* const* patterns, size_t count) {
+    pfc::string8 combined;
+    for (size_t i = 0; i < count; i++) {
+        if (i > 0) combined << "$char(1)";
+        combined << "[" << patterns[i] << "]";
+    }
+    return combined;
+}
+
+// First part of a combined script's output that is a usable artwork URL
+static pfc::string8 first_broadcast_url(const pfc::string8& formatted) {
+    const char* part = formatted.c_str();
+    for (;;) {
+        const char* end = strchr(part, '\x01');
+        pfc::string8 value(part, end ? (t_size)(end - part) : strlen(part));
+        if (!value.is_empty()) {
+            pfc::string8 clean_url = sanitize_broadcast_url(value.c_str());
+            if (!clean_url.is_empty()) return clean_url;
+        }
+        if (!end) return "";
+        part = end + 1;
+    }
+}
+
 pfc::string8 artwork_manager::extract_broadcast_artwork_url(metadb_handle_ptr track) {
     // 1. Extract from track file_info if valid
     if (track.is_valid()) {
@@ -803,8 +709,7 @@ pfc::string8 artwork_manager::extract_broadcast_artwork_url(metadb_handle_ptr tr
     try {
         static_api_ptr_t<playback_control> pc;
         if (pc->is_playing() || pc->is_paused()) {
-            static_api_ptr_t<titleformat_compiler> compiler;
-            const char* tf_patterns[] = {
+            static const char* const tf_patterns[] = {
                 "$info(cover_url)", "$info(COVER_URL)",
                 "$info(artwork_url)", "$info(ARTWORK_URL)",
                 "$info(art_url)", "$info(ART_URL)",
@@ -829,15 +734,13 @@ pfc::string8 artwork_manager::extract_broadcast_artwork_url(metadb_handle_ptr tr
                 "%song_art%", "%song_art_url%",
                 "%album_art%", "%album_art_url%"
             };
-            for (const char* pat : tf_patterns) {
-                service_ptr_t<titleformat_object> script;
-                compiler->compile_force(script, pat);
-                pfc::string8 formatted;
-                if (pc->playback_format_title(nullptr, formatted, script, nullptr, playback_control::display_level_all)) {
-                    pfc::string8 clean_url = sanitize_broadcast_url(formatted.c_str());
-                    if (!clean_url.is_empty()) {
-                        return clean_url;
-                    }
+            static const pfc::string8 combined = build_combined_pattern(tf_patterns, _countof(tf_patterns));
+
+            pfc::string8 formatted;
+            if (pc->playback_format_title(nullptr, formatted, titleformat_script_cache::get(combined), nullptr, playback_control::display_level_all)) {
+                pfc::string8 clean_url = first_broadcast_url(formatted);
+                if (!clean_url.is_empty()) {
+                    return clean_url;
                 }
             }
         }
@@ -846,20 +749,17 @@ pfc::string8 artwork_manager::extract_broadcast_artwork_url(metadb_handle_ptr tr
     // 3. Fallback: track title formatting if track is valid
     if (track.is_valid()) {
         try {
-            static_api_ptr_t<titleformat_compiler> compiler;
-            const char* tf_patterns[] = {
+            static const char* const tf_patterns[] = {
                 "$info(cover_url)", "$info(artwork_url)", "$info(art_url)",
                 "$info(image_url)", "%cover_url%", "%artwork_url%", "%art_url%"
             };
-            for (const char* pat : tf_patterns) {
-                service_ptr_t<titleformat_object> script;
-                compiler->compile_force(script, pat);
-                pfc::string8 formatted;
-                if (track->format_title(nullptr, formatted, script, nullptr)) {
-                    pfc::string8 clean_url = sanitize_broadcast_url(formatted.c_str());
-                    if (!clean_url.is_empty()) {
-                        return clean_url;
-                    }
+            static const pfc::string8 combined = build_combined_pattern(tf_patterns, _countof(tf_patterns));
+
+            pfc::string8 formatted;
+            if (track->format_title(nullptr, formatted, titleformat_script_cache::get(combined), nullptr)) {
+                pfc::string8 clean_url = first_broadcast_url(formatted);
+                if (!clean_url.is_empty()) {
+                    return clean_url;
                 }
             }
         } catch (...) {}
@@ -868,6 +768,99 @@ pfc::string8 artwork_manager::extract_broadcast_artwork_url(metadb_handle_ptr tr
     return "";
 }
 
+// Broadcast artwork downloaded ahead of the song boundary. Looked up by URL, or by
+// cache key when the server changes the URL once the song starts.
+struct prefetched_broadcast_artwork {
+    pfc::string8 url;
+    pfc::string8 cache_key;
+    artwork_manager::artwork_result result;
+};
+static std::mutex g_prefetch_mutex;
+static std::vector<prefetched_broadcast_artwork> g_prefetched_broadcast_artwork;
+static std::set<std::string> g_prefetch_in_flight;
+static const size_t MAX_PREFETCHED_BROADCAST_ARTWORK = 4;
+
+// URLs whose prefetch failed, with the time a new attempt is allowed. playing_next
+// repeats the same URL on every poll; without this a dead link is fetched each time.
+static std::map<std::string, std::chrono::steady_clock::time_point> g_prefetch_failed_until;
+static const std::chrono::seconds PREFETCH_FAILURE_BACKOFF(120);
+static const size_t MAX_PREFETCH_FAILURES = 16;
+
+static bool find_prefetched_broadcast_artwork(const pfc::string8& url, const pfc::string8& cache_key, artwork_manager::artwork_result& result) {
+    std::lock_guard<std::mutex> lock(g_prefetch_mutex);
+    for (const auto& entry : g_prefetched_broadcast_artwork) {
+        if (entry.url == url) {
+            result = entry.result;
+            return true;
+        }
+    }
+    if (!cache_key.is_empty() && cache_key != "current") {
+        for (const auto& entry : g_prefetched_broadcast_artwork) {
+            if (entry.cache_key == cache_key) {
+                result = entry.result;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void artwork_manager::prefetch_broadcast_artwork_async(const pfc::string8& cover_url, const pfc::string8& cache_key) {
+    pfc::string8 clean_url = sanitize_broadcast_url(cover_url.c_str());
+    if (clean_url.is_empty()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(g_prefetch_mutex);
+        for (const auto& entry : g_prefetched_broadcast_artwork) {
+            if (entry.url == clean_url) return;
+        }
+        auto failed = g_prefetch_failed_until.find(clean_url.c_str());
+        if (failed != g_prefetch_failed_until.end()) {
+            if (std::chrono::steady_clock::now() < failed->second) return;
+            g_prefetch_failed_until.erase(failed);
+        }
+        if (!g_prefetch_in_flight.insert(clean_url.c_str()).second) return;
+    }
+
+    foo_artwork::log_printf("foo_artwork: Prefetching broadcast artwork for upcoming song from '%s'", clean_url.c_str());
+
+    download_image_async(clean_url.c_str(), [clean_url, cache_key](const artwork_result& res) {
+        {
+            std::lock_guard<std::mutex> lock(g_prefetch_mutex);
+            g_prefetch_in_flight.erase(clean_url.c_str());
+            if (!res.success || res.data.get_size() == 0) {
+                auto now = std::chrono::steady_clock::now();
+                for (auto it = g_prefetch_failed_until.begin(); it != g_prefetch_failed_until.end();) {
+                    if (it->second <= now) it = g_prefetch_failed_until.erase(it);
+                    else ++it;
+                }
+                if (g_prefetch_failed_until.size() < MAX_PREFETCH_FAILURES) {
+                    g_prefetch_failed_until[clean_url.c_str()] = now + PREFETCH_FAILURE_BACKOFF;
+                }
+                foo_artwork::log_printf("foo_artwork: Prefetch of '%s' failed (%s), not retrying for %d s", clean_url.c_str(),
+                                        res.error_message.c_str(), (int)PREFETCH_FAILURE_BACKOFF.count());
+                return;
+            }
+
+            // Oldest entries go first; only the next song or two are ever useful
+            if (g_prefetched_broadcast_artwork.size() >= MAX_PREFETCHED_BROADCAST_ARTWORK) {
+                g_prefetched_broadcast_artwork.erase(g_prefetched_broadcast_artwork.begin());
+            }
+            prefetched_broadcast_artwork entry;
+            entry.url = clean_url;
+            entry.cache_key = cache_key;
+            entry.result = res;
+            entry.result.source = "Broadcast Artwork";
+            g_prefetched_broadcast_artwork.push_back(entry);
+        }
+
+        // The single-file cache only ever holds the current song, so only the per-song cache is filled ahead of time
+        if (cfg_enable_disk_cache && !cache_key.is_empty()) {
+            async_io_manager::instance().cache_set_async(cache_key, res.data);
+        }
+    });
+}
+
 void artwork_manager::search_broadcast_artwork_async(const pfc::string8& cover_url, const pfc::string8& cache_key, artwork_callback callback) {
     pfc::string8 clean_url = sanitize_broadcast_url(cover_url.c_str());
     if (clean_url.is_empty()) {
@@ -878,6 +871,19 @@ void artwork_manager::search_broadcast_artwork_async(const pfc::string8& cover_u
         return;
     }
 
+    // Prefetched from the previous payload's playing_next - no download needed
+    artwork_result final_res;
+    if (find_prefetched_broadcast_artwork(clean_url, cache_key, final_res)) {
+        if (cfg_single_file_cache) {
+            async_io_manager::instance().cache_set_async("current", final_res.data);
+        }
+        foo_artwork::log_printf("foo_artwork: SUCCESS - In-stream broadcast artwork served from prefetch (%u bytes)", (unsigned)final_res.data.get_size());
+        async_io_manager::instance().post_to_main_thread([callback, final_res]() {
+            callback(final_res);
+        });
+        return;
+    }
+
     foo_artwork::log_printf("foo_artwork: Fetching in-stream broadcast artwork from '%s'...", clean_url.c_str());
 
     download_image_async(clean_url.c_str(), [clean_url, cache_key, callback](const artwork_result& res) {
@@ -906,7 +912,297 @@ enum class StreamProbeStatus {
 };
 
 static std::mutex g_probe_cache_mutex;
-static std::map<std::string, std::pair<StreamProbeStatus, pfc::string8>> g_probed_stream_endpoints_cache;
+
+// Probe results per stream URL. Persisted in the profile so stations are not re-probed on
+// every start: discovered endpoints are trusted for a week, streams without one for a day.
+// A probe that failed because a candidate did not answer (timeout, offline, 5xx, 429)
+// says nothing about the station; it is kept in memory for a few minutes and never saved.
+struct stream_probe_entry {
+    StreamProbeStatus status = StreamProbeStatus::UNKNOWN;
+    pfc::string8 endpoint;
+    int64_t checked_at = 0;     // Unix time of the probe
+    bool unreachable = false;   // FAILED without a definitive answer from every candidate
+};
+static std::map<std::string, stream_probe_entry> g_probed_stream_endpoints_cache;
+static const int64_t PROBE_SUCCESS_TTL_SECONDS = 7 * 24 * 3600;
+static const int64_t PROBE_FAILED_TTL_SECONDS = 24 * 3600;
+static const int64_t PROBE_UNREACHABLE_TTL_SECONDS = 10 * 60;
+
+// Callers waiting for the persisted table to be read (main thread only)
+static std::vector<std::function<void()>> g_probe_table_waiters;
+
+static bool is_probe_entry_fresh(const stream_probe_entry& entry, int64_t now) {
+    int64_t ttl = (entry.status == StreamProbeStatus::SUCCESS) ? PROBE_SUCCESS_TTL_SECONDS :
+                  entry.unreachable ? PROBE_UNREACHABLE_TTL_SECONDS : PROBE_FAILED_TTL_SECONDS;
+    return entry.status != StreamProbeStatus::UNKNOWN && now - entry.checked_at < ttl && entry.checked_at <= now + 3600;
+}
+
+// A JSON table kept in foo_artwork_data in the profile. Saving is debounced and a save
+// never overlaps the previous one (main thread only): changes arriving while a save is
+// scheduled go into it, changes arriving while one is being written schedule another
+// once it is done, and changes made before the saved table was read are saved after.
+struct persisted_table {
+    const char* file_name;
+    const char* description;    // for the log
+    json (*snapshot)();         // contents to save, called on the main thread
+    bool loaded = false;
+    bool save_scheduled = false;
+    bool writing = false;
+    bool dirty = false;
+};
+static const DWORD PERSISTED_TABLE_SAVE_DELAY_MS = 2000;
+
+static pfc::string8 get_persisted_table_path(const persisted_table& table) {
+    pfc::string8 profile_url = core_api::get_profile_path();
+    pfc::string8 profile_path;
+    if (!foobar2000_io::extract_native_path(profile_url.c_str(), profile_path)) {
+        return "";
+    }
+    profile_path << "\\foo_artwork_data\\" << table.file_name;
+    return profile_path;
+}
+
+// Replaces path with text through a temporary file, so a crash or a concurrent
+// reader never sees a half-written table (worker thread)
+static bool replace_file_contents(const pfc::string8& path, const std::string& text) {
+    pfc::string8 temp_path = path;
+    temp_path << ".tmp";
+    pfc::stringcvt::string_wide_from_utf8 wide_path(path.c_str());
+    pfc::stringcvt::string_wide_from_utf8 wide_temp_path(temp_path.c_str());
+
+    pfc::string8 directory = path;
+    t_size separator = directory.find_last('\\');
+    if (separator != pfc_infinite) {
+        directory.truncate(separator);
+        SHCreateDirectoryExW(nullptr, pfc::stringcvt::string_wide_from_utf8(directory.c_str()), nullptr);
+    }
+
+    HANDLE file = CreateFileW(wide_temp_path, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    DWORD written = 0;
+    bool ok = WriteFile(file, text.data(), (DWORD)text.size(), &written, nullptr) && written == text.size() &&
+              FlushFileBuffers(file);
+    CloseHandle(file);
+
+    if (ok) ok = MoveFileExW(wide_temp_path, wide_path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != FALSE;
+    if (!ok) DeleteFileW(wide_temp_path);
+    return ok;
+}
+
+static void save_persisted_table(persisted_table* table);
+
+static void write_persisted_table(persisted_table* table) {
+    ASSERT_MAIN_THREAD();
+    table->save_scheduled = false;
+    if (g_is_shutting_down.load()) return;
+    pfc::string8 path = get_persisted_table_path(*table);
+    if (path.is_empty()) return;
+
+    std::string text = table->snapshot().dump();
+    table->writing = true;
+    async_io_manager::instance().submit_task([table, path, text]() {
+        if (!replace_file_contents(path, text)) {
+            foo_artwork::log_printf("foo_artwork: Could not save %s to %s", table->description, path.c_str());
+        }
+        async_io_manager::instance().post_to_main_thread([table]() {
+            table->writing = false;
+            if (!table->dirty) return;
+            table->dirty = false;
+            save_persisted_table(table);
+        });
+    });
+}
+
+static void save_persisted_table(persisted_table* table) {
+    ASSERT_MAIN_THREAD();
+    if (table->save_scheduled) return;
+    if (table->writing || !table->loaded) {
+        table->dirty = true;
+        return;
+    }
+
+    table->save_scheduled = true;
+    async_io_manager::instance().submit_task_after(PERSISTED_TABLE_SAVE_DELAY_MS, [table]() {
+        async_io_manager::instance().post_to_main_thread([table]() { write_persisted_table(table); });
+    });
+}
+
+// Marks the saved table as read, saving the changes made before
+static void persisted_table_loaded(persisted_table* table) {
+    ASSERT_MAIN_THREAD();
+    table->loaded = true;
+    if (!table->dirty) return;
+    table->dirty = false;
+    save_persisted_table(table);
+}
+
+static json snapshot_stream_probe_table() {
+    json table = json::object();
+    std::lock_guard<std::mutex> lock(g_probe_cache_mutex);
+    int64_t now = (int64_t)time(nullptr);
+    for (const auto& item : g_probed_stream_endpoints_cache) {
+        if (item.second.unreachable || !is_probe_entry_fresh(item.second, now)) continue;
+        json entry;
+        entry["status"] = (item.second.status == StreamProbeStatus::SUCCESS) ? "ok" : "none";
+        entry["endpoint"] = item.second.endpoint.c_str();
+        entry["checked_at"] = item.second.checked_at;
+        table[item.first] = entry;
+    }
+    return table;
+}
+
+static persisted_table g_probe_table = { "stream_endpoints.json", "now-playing endpoint probe results", snapshot_stream_probe_table };
+
+static void set_stream_probe_result(const pfc::string8& stream_url, StreamProbeStatus status, const pfc::string8& endpoint,
+                                    bool unreachable = false) {
+    {
+        std::lock_guard<std::mutex> lock(g_probe_cache_mutex);
+        stream_probe_entry& entry = g_probed_stream_endpoints_cache[stream_url.c_str()];
+        entry.status = status;
+        entry.endpoint = endpoint;
+        entry.checked_at = (int64_t)time(nullptr);
+        entry.unreachable = unreachable;
+    }
+    // Nothing worth keeping across restarts
+    if (!unreachable) save_persisted_table(&g_probe_table);
+}
+
+// True once the persisted table has been read. Otherwise starts reading it and runs
+// resume when it is available, so a probe never starts from an incomplete table.
+static bool stream_probe_table_ready(std::function<void()> resume) {
+    ASSERT_MAIN_THREAD();
+    if (g_probe_table.loaded) return true;
+
+    g_probe_table_waiters.push_back(resume);
+    if (g_probe_table_waiters.size() > 1) return false;  // Read already in progress
+
+    auto finish_loading = []() {
+        persisted_table_loaded(&g_probe_table);
+        std::vector<std::function<void()>> waiters;
+        waiters.swap(g_probe_table_waiters);
+        for (auto& waiter : waiters) waiter();
+    };
+
+    pfc::string8 path = get_persisted_table_path(g_probe_table);
+    if (path.is_empty()) {
+        finish_loading();
+        return false;
+    }
+
+    async_io_manager::instance().read_file_async(path, [finish_loading](bool success, const image_buffer& data, const pfc::string8& error) {
+        if (success && data.get_size() > 0) {
+            try {
+                json table = json::parse(data.get_ptr(), data.get_ptr() + data.get_size(), nullptr, false);
+                if (table.is_object()) {
+                    std::lock_guard<std::mutex> lock(g_probe_cache_mutex);
+                    int64_t now = (int64_t)time(nullptr);
+                    for (auto& item : table.items()) {
+                        const json& value = item.value();
+                        if (!value.is_object() || !value.contains("status") || !value["status"].is_string() ||
+                            !value.contains("checked_at") || !value["checked_at"].is_number()) continue;
+
+                        stream_probe_entry entry;
+                        entry.status = (value["status"].get<std::string>() == "ok") ? StreamProbeStatus::SUCCESS : StreamProbeStatus::FAILED;
+                        entry.endpoint = (value.contains("endpoint") && value["endpoint"].is_string()) ? value["endpoint"].get<std::string>().c_str() : "";
+                        entry.checked_at = value["checked_at"].get<int64_t>();
+                        if (entry.status == StreamProbeStatus::SUCCESS && entry.endpoint.is_empty()) continue;
+                        if (!is_probe_entry_fresh(entry, now)) continue;
+
+                        // Results probed during this session take precedence
+                        g_probed_stream_endpoints_cache.emplace(item.key(), entry);
+                    }
+                    foo_artwork::log_printf("foo_artwork: Loaded %u saved now-playing endpoint probe results", (unsigned)g_probed_stream_endpoints_cache.size());
+                }
+            } catch (...) {}
+        }
+        finish_loading();
+    });
+    return false;
+}
+
+// Full resolution URL of each panel-sized image in the artwork cache, by cache key
+// without its size tier ("current" in single-file mode), so the viewer can fetch the
+// original of artwork served from the cache. Kept out of the image cache, where it
+// would be counted and pruned like artwork (main thread only).
+struct full_resolution_url_entry {
+    std::string url;
+    int64_t stored_at = 0;      // Unix time
+};
+static const size_t MAX_FULL_RESOLUTION_URLS = 2000;
+static std::map<std::string, full_resolution_url_entry> g_full_resolution_urls;
+
+static json snapshot_full_resolution_urls() {
+    json table = json::object();
+    for (const auto& item : g_full_resolution_urls) {
+        json entry;
+        entry["url"] = item.second.url;
+        entry["stored_at"] = item.second.stored_at;
+        table[item.first] = entry;
+    }
+    return table;
+}
+
+static persisted_table g_full_resolution_url_table = { "full_resolution_urls.json", "full resolution artwork URLs", snapshot_full_resolution_urls };
+
+// Records the full resolution URL of the image cached under cache_key; an empty url forgets it
+static void set_full_resolution_url(const pfc::string8& cache_key, const pfc::string8& url) {
+    ASSERT_MAIN_THREAD();
+    std::string key = strip_size_tier(cache_key).c_str();
+    if (url.is_empty()) {
+        if (g_full_resolution_urls.erase(key) == 0) return;
+    } else {
+        full_resolution_url_entry& entry = g_full_resolution_urls[key];
+        entry.url = url.c_str();
+        entry.stored_at = (int64_t)time(nullptr);
+
+        // Over the limit the least recently stored entry goes; its image is the first the cache prunes as well
+        if (g_full_resolution_urls.size() > MAX_FULL_RESOLUTION_URLS) {
+            auto oldest = g_full_resolution_urls.end();
+            for (auto it = g_full_resolution_urls.begin(); it != g_full_resolution_urls.end(); ++it) {
+                if (it->first == "current") continue;
+                if (oldest == g_full_resolution_urls.end() || it->second.stored_at < oldest->second.stored_at) oldest = it;
+            }
+            if (oldest != g_full_resolution_urls.end()) g_full_resolution_urls.erase(oldest);
+        }
+    }
+    save_persisted_table(&g_full_resolution_url_table);
+}
+
+static pfc::string8 get_full_resolution_url_of_cached(const pfc::string8& cache_key) {
+    ASSERT_MAIN_THREAD();
+    auto it = g_full_resolution_urls.find(strip_size_tier(cache_key).c_str());
+    return it != g_full_resolution_urls.end() ? pfc::string8(it->second.url.c_str()) : pfc::string8();
+}
+
+// Reads the saved URLs; URLs recorded meanwhile take precedence
+static void load_full_resolution_urls() {
+    ASSERT_MAIN_THREAD();
+    pfc::string8 path = get_persisted_table_path(g_full_resolution_url_table);
+    if (path.is_empty()) {
+        persisted_table_loaded(&g_full_resolution_url_table);
+        return;
+    }
+
+    async_io_manager::instance().read_file_async(path, [](bool success, const image_buffer& data, const pfc::string8& error) {
+        if (success && data.get_size() > 0) {
+            try {
+                json table = json::parse(data.get_ptr(), data.get_ptr() + data.get_size(), nullptr, false);
+                if (table.is_object()) {
+                    for (auto& item : table.items()) {
+                        const json& value = item.value();
+                        if (!value.is_object() || !value.contains("url") || !value["url"].is_string()) continue;
+
+                        full_resolution_url_entry entry;
+                        entry.url = value["url"].get<std::string>();
+                        if (value.contains("stored_at") && value["stored_at"].is_number()) entry.stored_at = value["stored_at"].get<int64_t>();
+                        if (!entry.url.empty()) g_full_resolution_urls.emplace(item.key(), entry);
+                    }
+                }
+            } catch (...) {}
+        }
+        persisted_table_loaded(&g_full_resolution_url_table);
+    });
+}
 
 pfc::string8 artwork_manager::extract_station_slug_from_url(const char* url) {
     if (!url || url[0] == '\0') return "";
@@ -1091,9 +1387,26 @@ static const json* find_matching_station_in_array(const json& j_array, const std
     return &j_array[0];
 }
 
-void artwork_manager::stop_external_stream_api_poller() {
-    g_external_api_session_token++;
-}
+// Real-time now-playing subscription (AzuraCast SSE), replaces polling while connected
+static std::mutex g_sse_mutex;
+static std::shared_ptr<sse_client> g_sse_client;
+
+// Per-endpoint result of trying the SSE feed, so servers without it are polled straight away
+static std::map<std::string, StreamProbeStatus> g_sse_support_cache;
+
+static void stop_external_now_playing_sse() {
+    std::shared_ptr<sse_client> client;
+    {
+        std::lock_guard<std::mutex> lock(g_sse_mutex);
+        client.swap(g_sse_client);
+    }
+    if (client) client->stop();
+}
+
+void artwork_manager::stop_external_stream_api_poller() {
+    g_external_api_session_token++;
+    stop_external_now_playing_sse();
+}
 
 static void add_unique_candidate(std::vector<pfc::string8>& list, const pfc::string8& url) {
     if (url.is_empty()) return;
@@ -1103,57 +1416,84 @@ static void add_unique_candidate(std::vector<pfc::string8>& list, const pfc::str
     list.push_back(url);
 }
 
-static void probe_candidates_async(const pfc::string8& stream_url, const std::vector<pfc::string8>& candidates, size_t index, uint64_t session_token) {
-    ASSERT_MAIN_THREAD();
-    if (g_is_shutting_down.load() || g_external_api_session_token != session_token) return;
-
-    if (index >= candidates.size()) {
-        std::lock_guard<std::mutex> lock(g_probe_cache_mutex);
-        g_probed_stream_endpoints_cache[stream_url.c_str()] = { StreamProbeStatus::FAILED, "" };
-        return;
-    }
-
-    pfc::string8 target = candidates[index];
-    foo_artwork::log_printf("foo_artwork: Auto-probing stream for now-playing API at: %s", target.c_str());
+// Does a response look like an AzuraCast / RadioReg now-playing payload?
+static bool is_now_playing_payload(const pfc::string8& response) {
+    if (response.is_empty()) return false;
+    try {
+        json j = json::parse(response.c_str(), nullptr, false);
+        if (j.is_discarded()) return false;
+        if (j.is_object()) {
+            return j.contains("now_playing") || 
+                   (j.contains("station") && j.contains("song")) || 
+                   j.contains("song") || 
+                   (j.contains("artist") && j.contains("title"));
+        }
+        if (j.is_array() && !j.empty() && j[0].is_object()) {
+            return j[0].contains("now_playing") || 
+                   j[0].contains("station") || 
+                   (j[0].contains("artist") && j[0].contains("title"));
+        }
+    } catch (...) {}
+    return false;
+}
 
-    async_io_manager::instance().http_get_async(target.c_str(), [stream_url, candidates, index, target, session_token](bool success, const pfc::string8& response, const pfc::string8& error) {
-        ASSERT_MAIN_THREAD();
-        if (g_is_shutting_down.load() || g_external_api_session_token != session_token) return;
+// Candidates of one stream probed concurrently (main thread only). The highest priority
+// candidate that validates wins, but only once every candidate ahead of it has failed.
+struct stream_probe_race {
+    pfc::string8 stream_url;
+    std::vector<pfc::string8> candidates;
+    std::vector<StreamProbeStatus> results;     // UNKNOWN while the request is pending
+    bool unreachable = false;                   // A candidate failed without an HTTP answer
+    bool decided = false;
+};
 
-        bool validated = false;
-        if (success && !response.is_empty()) {
-            try {
-                json j = json::parse(response.c_str(), nullptr, false);
-                if (!j.is_discarded()) {
-                    if (j.is_object()) {
-                        if (j.contains("now_playing") || 
-                            (j.contains("station") && j.contains("song")) || 
-                            j.contains("song") || 
-                            (j.contains("artist") && j.contains("title"))) {
-                            validated = true;
-                        }
-                    } else if (j.is_array() && !j.empty() && j[0].is_object()) {
-                        if (j[0].contains("now_playing") || 
-                            j[0].contains("station") || 
-                            (j[0].contains("artist") && j[0].contains("title"))) {
-                            validated = true;
-                        }
-                    }
-                }
-            } catch (...) {}
-        }
+static void decide_stream_probe(const std::shared_ptr<stream_probe_race>& race, uint64_t session_token) {
+    if (race->decided) return;
 
-        if (validated) {
-            {
-                std::lock_guard<std::mutex> lock(g_probe_cache_mutex);
-                g_probed_stream_endpoints_cache[stream_url.c_str()] = { StreamProbeStatus::SUCCESS, target };
-            }
+    for (size_t i = 0; i < race->candidates.size(); i++) {
+        if (race->results[i] == StreamProbeStatus::UNKNOWN) return;  // A higher priority candidate may still win
+        if (race->results[i] == StreamProbeStatus::SUCCESS) {
+            race->decided = true;
+            const pfc::string8& target = race->candidates[i];
+            set_stream_probe_result(race->stream_url, StreamProbeStatus::SUCCESS, target);
             foo_artwork::log_printf("foo_artwork: Server auto-probing successfully discovered external API: %s", target.c_str());
             artwork_manager::poll_external_stream_api(target, session_token);
-        } else {
-            probe_candidates_async(stream_url, candidates, index + 1, session_token);
+            return;
         }
-    });
+    }
+
+    race->decided = true;
+    if (race->unreachable) {
+        foo_artwork::log_printf("foo_artwork: Auto-probing found no now-playing API, but not every candidate answered; not remembered across restarts");
+    }
+    set_stream_probe_result(race->stream_url, StreamProbeStatus::FAILED, "", race->unreachable);
+}
+
+static void probe_candidates_async(const pfc::string8& stream_url, const std::vector<pfc::string8>& candidates, uint64_t session_token) {
+    ASSERT_MAIN_THREAD();
+    if (g_is_shutting_down.load() || g_external_api_session_token != session_token) return;
+
+    auto race = std::make_shared<stream_probe_race>();
+    race->stream_url = stream_url;
+    race->candidates = candidates;
+    race->results.assign(candidates.size(), StreamProbeStatus::UNKNOWN);
+
+    // All candidates at once - a dead candidate no longer costs a full timeout before the next is tried
+    for (size_t index = 0; index < candidates.size(); index++) {
+        pfc::string8 target = candidates[index];
+        foo_artwork::log_printf("foo_artwork: Auto-probing stream for now-playing API at: %s", target.c_str());
+
+        async_io_manager::instance().http_get_async(target.c_str(), [race, index, session_token](bool success, const pfc::string8& response, const pfc::string8& error) {
+            ASSERT_MAIN_THREAD();
+            if (g_is_shutting_down.load()) return;
+
+            // Results are recorded even if the session moved on, so the table stays useful. Any HTTP
+            // answer (including 404) is definitive; only transport errors, 5xx and 429 fail the request.
+            race->results[index] = (success && is_now_playing_payload(response)) ? StreamProbeStatus::SUCCESS : StreamProbeStatus::FAILED;
+            if (!success) race->unreachable = true;
+            decide_stream_probe(race, session_token);
+        });
+    }
 }
 
 void artwork_manager::probe_external_stream_api(const pfc::string8& stream_url, uint64_t session_token) {
@@ -1168,21 +1508,29 @@ void artwork_manager::probe_external_stream_api(const pfc::string8& stream_url,
     std::string base = (host_end != std::string::npos) ? s.substr(0, host_end) : s;
     if (base.empty()) return;
 
+    // Saved results from earlier sessions must be loaded before deciding to probe
+    if (!stream_probe_table_ready([stream_url, session_token]() { probe_external_stream_api(stream_url, session_token); })) {
+        return;
+    }
+
     // Check probe cache
+    stream_probe_entry cached;
+    bool has_cached = false;
     {
         std::lock_guard<std::mutex> lock(g_probe_cache_mutex);
         auto it = g_probed_stream_endpoints_cache.find(stream_url.c_str());
-        if (it != g_probed_stream_endpoints_cache.end()) {
-            if (it->second.first == StreamProbeStatus::SUCCESS) {
-                pfc::string8 endpoint = it->second.second;
-                foo_artwork::log_printf("foo_artwork: Using cached external now-playing endpoint: %s", endpoint.c_str());
-                poll_external_stream_api(endpoint, session_token);
-                return;
-            } else if (it->second.first == StreamProbeStatus::FAILED) {
-                return; // Probed previously and not an external API endpoint
-            }
+        if (it != g_probed_stream_endpoints_cache.end() && is_probe_entry_fresh(it->second, (int64_t)time(nullptr))) {
+            cached = it->second;
+            has_cached = true;
         }
     }
+    if (has_cached) {
+        if (cached.status == StreamProbeStatus::SUCCESS) {
+            foo_artwork::log_printf("foo_artwork: Using cached external now-playing endpoint: %s", cached.endpoint.c_str());
+            poll_external_stream_api(cached.endpoint, session_token);
+        }
+        return; // FAILED: probed recently and not an external API endpoint
+    }
 
     pfc::string8 slug = extract_station_slug_from_url(stream_url.c_str());
 
@@ -1233,12 +1581,15 @@ void artwork_manager::probe_external_stream_api(const pfc::string8& stream_url,
 
     if (candidates.empty()) return;
 
-    probe_candidates_async(stream_url, candidates, 0, session_token);
+    probe_candidates_async(stream_url, candidates, session_token);
 }
 
 void artwork_manager::start_external_stream_api_poller(const pfc::string8& stream_url) {
     stop_external_stream_api_poller();
 
+    // A new stream starts from a full response, not a 304 against the previous session's payload
+    async_io_manager::instance().http_clear_validators();
+
     pfc::string8 azuracast_val = get_url_param_value(stream_url.c_str(), "azuracast_api");
     pfc::string8 radioreg_val = get_url_param_value(stream_url.c_str(), "radioreg_api");
 
@@ -1310,17 +1661,408 @@ void artwork_manager::start_external_stream_api_poller(const pfc::string8& strea
 
     foo_artwork::log_printf("foo_artwork: Starting external now-playing API poller for endpoint: %s", endpoint_url.c_str());
 
-    // Schedule initial poll after 500ms delay via async_io_manager worker and post back to main thread
-    async_io_manager::instance().submit_task([endpoint_url, current_token]() {
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    // Schedule initial poll after 500ms delay via the async_io_manager timer and post back to main thread
+    async_io_manager::instance().submit_task_after(500, [endpoint_url, current_token]() {
         if (g_is_shutting_down.load() || g_external_api_session_token != current_token) return;
 
-        async_io_manager::instance().post_to_main_thread([endpoint_url, current_token]() {
+        async_io_manager::instance().post_to_main_thread("external_stream_poll", [endpoint_url, current_token]() {
             poll_external_stream_api(endpoint_url, current_token);
         });
     });
 }
 
+// Returned when a now-playing payload carries no song timing
+static const int NOW_PLAYING_TIMING_UNKNOWN = INT_MIN;
+
+// Seconds left in the current song from a now-playing object, NOW_PLAYING_TIMING_UNKNOWN if the
+// payload does not say. Negative once the song has overrun, so the poller can tell how late the
+// change is. "played_at" + "duration" is preferred because AzuraCast serves a cached payload whose
+// "remaining" is only correct at the moment it was generated.
+static int get_now_playing_remaining_seconds(const json& np) {
+    if (!np.is_object()) return NOW_PLAYING_TIMING_UNKNOWN;
+    if (np.contains("played_at") && np["played_at"].is_number() && np.contains("duration") && np["duration"].is_number()) {
+        long long duration = np["duration"].get<long long>();
+        long long ends_at = np["played_at"].get<long long>() + duration;
+        long long remaining = ends_at - (long long)time(nullptr);
+        // Ignore if the clocks disagree by more than a song
+        if (duration > 0 && remaining > -duration && remaining <= duration) {
+            return (int)remaining;
+        }
+    }
+    if (np.contains("remaining") && np["remaining"].is_number()) {
+        return np["remaining"].get<int>();
+    }
+    if (np.contains("duration") && np["duration"].is_number() && np.contains("elapsed") && np["elapsed"].is_number()) {
+        int duration = np["duration"].get<int>();
+        if (duration > 0) return duration - np["elapsed"].get<int>();
+    }
+    return NOW_PLAYING_TIMING_UNKNOWN;
+}
+
+// Start downloading the artwork of the song AzuraCast announces in playing_next,
+// so the switch at the song boundary is served from memory
+static void prefetch_playing_next_artwork(const json& station_payload) {
+    if (!station_payload.contains("playing_next") || !station_payload["playing_next"].is_object()) return;
+    auto& next = station_payload["playing_next"];
+    if (!next.contains("song") || !next["song"].is_object()) return;
+
+    auto& song = next["song"];
+    std::string artist, title, art_url;
+    if (song.contains("artist") && song["artist"].is_string()) artist = song["artist"].get<std::string>();
+    if (song.contains("title") && song["title"].is_string()) title = song["title"].get<std::string>();
+    if (song.contains("art") && song["art"].is_string()) art_url = song["art"].get<std::string>();
+    if (art_url.empty() || (artist.empty() && title.empty())) return;
+    if (art_url.find("http://") != 0 && art_url.find("https://") != 0) return;
+
+    if (artwork_manager::has_url_flag(g_current_stream_url.c_str(), "inverted")) {
+        std::swap(artist, title);
+    }
+    pfc::string8 cache_key = artwork_manager::generate_cache_key(artist.c_str(), title.c_str());
+    artwork_manager::prefetch_broadcast_artwork_async(art_url.c_str(), cache_key);
+}
+
+// Apply a now-playing payload from AzuraCast / RadioReg, whether polled or pushed over SSE.
+// Starts the artwork search when the song differs from the last one seen.
+// Returns the seconds remaining in the current song (negative if overrun), NOW_PLAYING_TIMING_UNKNOWN if unknown.
+static int apply_external_now_playing(json& j) {
+    std::string artist, title, art_url;
+    int remaining_seconds = NOW_PLAYING_TIMING_UNKNOWN;
+
+    if (j.is_object() && j.contains("now_playing") && j["now_playing"].is_object()) {
+        auto& np = j["now_playing"];
+        remaining_seconds = get_now_playing_remaining_seconds(np);
+        prefetch_playing_next_artwork(j);
+        if (np.contains("song") && np["song"].is_object()) {
+            auto& song = np["song"];
+            if (song.contains("artist") && song["artist"].is_string()) artist = song["artist"].get<std::string>();
+            if (song.contains("title") && song["title"].is_string()) title = song["title"].get<std::string>();
+            if (song.contains("art") && song["art"].is_string()) art_url = song["art"].get<std::string>();
+            if (song.contains("text") && song["text"].is_string() && (artist.empty() || title.empty())) {
+                std::string text = song["text"].get<std::string>();
+                size_t dash = text.find(" - ");
+                if (dash != std::string::npos) {
+                    artist = text.substr(0, dash);
+                    title = text.substr(dash + 3);
+                }
+            }
+        }
+    } else if (j.is_array() && !j.empty()) {
+        const json* matched_station = find_matching_station_in_array(j, g_current_stream_url.c_str());
+        if (matched_station && matched_station->is_object()) {
+            if (matched_station->contains("now_playing") && (*matched_station)["now_playing"].is_object()) {
+                auto& np = (*matched_station)["now_playing"];
+                remaining_seconds = get_now_playing_remaining_seconds(np);
+                prefetch_playing_next_artwork(*matched_station);
+                if (np.contains("song") && np["song"].is_object()) {
+                    auto& song = np["song"];
+                    if (song.contains("artist") && song["artist"].is_string()) artist = song["artist"].get<std::string>();
+                    if (song.contains("title") && song["title"].is_string()) title = song["title"].get<std::string>();
+                    if (song.contains("art") && song["art"].is_string()) art_url = song["art"].get<std::string>();
+                    if (song.contains("text") && song["text"].is_string() && (artist.empty() || title.empty())) {
+                        std::string text = song["text"].get<std::string>();
+                        size_t dash = text.find(" - ");
+                        if (dash != std::string::npos) {
+                            artist = text.substr(0, dash);
+                            title = text.substr(dash + 3);
+                        }
+                    }
+                }
+            } else if (matched_station->contains("song") && (*matched_station)["song"].is_object()) {
+                auto& song = (*matched_station)["song"];
+                if (song.contains("artist") && song["artist"].is_string()) artist = song["artist"].get<std::string>();
+                if (song.contains("title") && song["title"].is_string()) title = song["title"].get<std::string>();
+                if (song.contains("art") && song["art"].is_string()) art_url = song["art"].get<std::string>();
+            }
+        }
+    } else if (j.is_object()) {
+        remaining_seconds = get_now_playing_remaining_seconds(j);
+        if (j.contains("artist") && j["artist"].is_string()) artist = j["artist"].get<std::string>();
+        if (j.contains("title") && j["title"].is_string()) title = j["title"].get<std::string>();
+        if (j.contains("cover_url") && j["cover_url"].is_string()) art_url = j["cover_url"].get<std::string>();
+        else if (j.contains("art") && j["art"].is_string()) art_url = j["art"].get<std::string>();
+        else if (j.contains("image") && j["image"].is_string()) art_url = j["image"].get<std::string>();
+        else if (j.contains("cover") && j["cover"].is_string()) art_url = j["cover"].get<std::string>();
+        else if (j.contains("artwork") && j["artwork"].is_string()) art_url = j["artwork"].get<std::string>();
+        
+        if (j.contains("song") && j["song"].is_object()) {
+            auto& song = j["song"];
+            if (artist.empty() && song.contains("artist") && song["artist"].is_string()) artist = song["artist"].get<std::string>();
+            if (title.empty() && song.contains("title") && song["title"].is_string()) title = song["title"].get<std::string>();
+            if (art_url.empty() && song.contains("art") && song["art"].is_string()) art_url = song["art"].get<std::string>();
+            if (art_url.empty() && song.contains("cover_url") && song["cover_url"].is_string()) art_url = song["cover_url"].get<std::string>();
+            if (art_url.empty() && song.contains("image") && song["image"].is_string()) art_url = song["image"].get<std::string>();
+            if (art_url.empty() && song.contains("cover") && song["cover"].is_string()) art_url = song["cover"].get<std::string>();
+            if (art_url.empty() && song.contains("artwork") && song["artwork"].is_string()) art_url = song["artwork"].get<std::string>();
+        }
+    }
+
+    if (!artist.empty() || !title.empty()) {
+        if (artwork_manager::has_url_flag(g_current_stream_url.c_str(), "inverted")) {
+            std::swap(artist, title);
+        }
+
+        if (artist != g_last_stream_artist.c_str() || title != g_last_stream_title.c_str()) {
+            foo_artwork::log_printf("foo_artwork: External API cue - Track changed: '%s - %s'", artist.c_str(), title.c_str());
+            g_rejected_providers_for_current_track.clear();
+            g_active_resolved_provider.reset();
+            g_active_artwork_url.reset();
+
+            metadb_handle_ptr track;
+            if (playback_control::get()->get_now_playing(track) && track.is_valid()) {
+                titleformat_provider::set_track_artwork_info(track, artist.c_str(), title.c_str(), "", "");
+            }
+
+            if (!art_url.empty() && (art_url.find("http://") == 0 || art_url.find("https://") == 0) &&
+                (g_rejected_providers_for_current_track.find("Broadcast Artwork") == g_rejected_providers_for_current_track.end())) {
+                pfc::string8 cache_key = cfg_single_file_cache ? pfc::string8("current") : generate_cache_key(artist.c_str(), title.c_str());
+                search_broadcast_artwork_async(art_url.c_str(), cache_key, [artist, title, cache_key](const artwork_result& res) {
+                    if (res.success) {
+                        g_last_stream_artist = artist.c_str();
+                        g_last_stream_title = title.c_str();
+                        g_stream_monitor_token++;
+                        stop_rms_silence_detector();
+                        reset_acrcloud_cooldown();
+                        log_simplified_track_info(artist.c_str(), title.c_str());
+
+                        g_active_source = res.source;
+                        g_active_resolved_provider = res.source;
+
+                        if (res.data.get_size() > 0) {
+                            create_bitmap_from_image_data(res.data);
+                        }
+
+                        metadb_handle_ptr track;
+                        if (playback_control::get()->get_now_playing(track) && track.is_valid()) {
+                            pfc::string8 cache_file = async_io_manager::instance().get_cache_file_path(cache_key);
+                            titleformat_provider::set_track_artwork_info(track, artist.c_str(), title.c_str(), cache_file.c_str(), res.source.c_str());
+                        }
+
+                        request_panel_refresh(panel_refresh_artwork_ready);
+                    } else {
+                        artwork_manager::on_stream_metadata_changed(artist.c_str(), title.c_str());
+                    }
+                });
+            } else {
+                artwork_manager::on_stream_metadata_changed(artist.c_str(), title.c_str());
+            }
+        }
+    }
+
+    return remaining_seconds;
+}
+
+// Reconnect policy for the SSE feed. A connection that drops sooner than
+// SSE_STABLE_SECONDS counts as a failure; after SSE_MAX_RECONNECTS of those in a row
+// the session falls back to polling.
+static const int SSE_IDLE_TIMEOUT_SECONDS = 60;    // Centrifugo pings every ~25 s
+static const int SSE_STABLE_SECONDS = 30;
+static const int SSE_MAX_RECONNECTS = 5;
+static const int SSE_MAX_BACKOFF_MS = 30000;
+
+// SSE URL for an AzuraCast now-playing endpoint, from the station shortcode in its payload.
+// Empty if the payload is not AzuraCast's.
+static pfc::string8 get_azuracast_sse_url(const pfc::string8& endpoint_url, json& j) {
+    if (!contains_case_insensitive(endpoint_url.c_str(), "/api/nowplaying")) return "";
+
+    json* station_entry = &j;
+    if (j.is_array()) {
+        station_entry = const_cast<json*>(find_matching_station_in_array(j, g_current_stream_url.c_str()));
+    }
+    if (!station_entry || !station_entry->is_object() || !station_entry->contains("station")) return "";
+
+    json& station = (*station_entry)["station"];
+    if (!station.is_object() || !station.contains("shortcode") || !station["shortcode"].is_string()) return "";
+    std::string shortcode = station["shortcode"].get<std::string>();
+    if (shortcode.empty()) return "";
+
+    std::string s = endpoint_url.c_str();
+    size_t proto = s.find("://");
+    if (proto == std::string::npos) return "";
+    size_t host_end = s.find('/', proto + 3);
+    std::string base = (host_end != std::string::npos) ? s.substr(0, host_end) : s;
+
+    // Subscribe to the station channel; "recover" replays the current song on connect
+    std::string subscription = "{\"subs\":{\"station:" + shortcode + "\":{\"recover\":true}}}";
+    pfc::string8 url = (base + "/api/live/nowplaying/sse?cf_connect=").c_str();
+    url << artwork_manager::url_encode(subscription.c_str());
+    return url;
+}
+
+// Main thread handler for one SSE message. Centrifugo wraps the now-playing payload as
+// {"pub":{"data":{"np":{...}}}} for updates and inside connect.subs.<channel>.publications
+// for the replay sent on connect.
+static void on_external_now_playing_event(const pfc::string8& data, uint64_t session_token) {
+    ASSERT_MAIN_THREAD();
+    if (g_is_shutting_down.load() || g_external_api_session_token != session_token) return;
+
+    static_api_ptr_t<playback_control> pc;
+    if (!pc->is_playing() && !pc->is_paused()) {
+        stop_external_now_playing_sse();
+        return;
+    }
+
+    try {
+        json j = json::parse(data.c_str(), nullptr, false);
+        if (j.is_discarded() || !j.is_object()) return;
+
+        json* np = nullptr;
+        if (j.contains("pub") && j["pub"].is_object()) {
+            json& pub = j["pub"];
+            if (pub.contains("data") && pub["data"].is_object() && pub["data"].contains("np")) {
+                np = &pub["data"]["np"];
+            }
+        } else if (j.contains("connect") && j["connect"].is_object() && j["connect"].contains("subs") && j["connect"]["subs"].is_object()) {
+            for (auto& sub : j["connect"]["subs"].items()) {
+                json& channel = sub.value();
+                if (!channel.is_object() || !channel.contains("publications") || !channel["publications"].is_array()) continue;
+                for (auto& publication : channel["publications"]) {
+                    if (publication.is_object() && publication.contains("data") && publication["data"].is_object() && publication["data"].contains("np")) {
+                        np = &publication["data"]["np"];  // Latest publication wins
+                    }
+                }
+            }
+        }
+
+        if (np && np->is_object()) {
+            apply_external_now_playing(*np);
+        }
+    } catch (...) {}
+}
+
+// Resume polling after the SSE feed turned out to be unavailable or unreliable
+static void fall_back_to_polling(const pfc::string8& endpoint_url, uint64_t session_token) {
+    async_io_manager::instance().post_to_main_thread("external_stream_poll", [endpoint_url, session_token]() {
+        if (g_is_shutting_down.load() || g_external_api_session_token != session_token) return;
+        artwork_manager::poll_external_stream_api(endpoint_url, session_token);
+    });
+}
+
+// Switch the session from polling to the SSE feed when the server offers one.
+// Returns true if the subscription was started and polling should stop.
+static bool try_start_external_now_playing_sse(const pfc::string8& endpoint_url, json& j, uint64_t session_token) {
+    {
+        std::lock_guard<std::mutex> lock(g_probe_cache_mutex);
+        auto it = g_sse_support_cache.find(endpoint_url.c_str());
+        if (it != g_sse_support_cache.end() && it->second == StreamProbeStatus::FAILED) return false;
+    }
+
+    pfc::string8 sse_url = get_azuracast_sse_url(endpoint_url, j);
+    if (sse_url.is_empty()) return false;
+
+    auto client = std::make_shared<sse_client>();
+    {
+        std::lock_guard<std::mutex> lock(g_sse_mutex);
+        if (g_sse_client) g_sse_client->stop();
+        g_sse_client = client;
+    }
+
+    foo_artwork::log_printf("foo_artwork: Subscribing to real-time now-playing feed: %s", sse_url.c_str());
+
+    int connect_timeout = (std::max)(1, (int)cfg_http_timeout.get_value());
+
+    // The connection stays open for the whole session, so it gets its own thread instead of a pool worker
+    std::thread([client, endpoint_url, sse_url, session_token, connect_timeout]() {
+        auto session_active = [&]() {
+            return !client->is_stopped() && !g_is_shutting_down.load() && g_external_api_session_token == session_token;
+        };
+
+        bool ever_connected = false;
+        int failures = 0;
+
+        while (session_active()) {
+            bool connected = false;
+            pfc::string8 error;
+            auto started = std::chrono::steady_clock::now();
+
+            client->run(sse_url, connect_timeout, SSE_IDLE_TIMEOUT_SECONDS, [session_token](const std::string& data) {
+                pfc::string8 payload(data.c_str(), data.size());
+                async_io_manager::instance().post_to_main_thread([payload, session_token]() {
+                    on_external_now_playing_event(payload, session_token);
+                });
+            }, connected, error);
+
+            if (!session_active()) return;
+
+            if (!connected && !ever_connected) {
+                // Server has no real-time feed - remember it and keep polling this endpoint
+                foo_artwork::log_printf("foo_artwork: Real-time now-playing feed unavailable (%s), polling instead", error.c_str());
+                {
+                    std::lock_guard<std::mutex> lock(g_probe_cache_mutex);
+                    g_sse_support_cache[endpoint_url.c_str()] = StreamProbeStatus::FAILED;
+                }
+                fall_back_to_polling(endpoint_url, session_token);
+                return;
+            }
+
+            if (connected && !ever_connected) {
+                ever_connected = true;
+                std::lock_guard<std::mutex> lock(g_probe_cache_mutex);
+                g_sse_support_cache[endpoint_url.c_str()] = StreamProbeStatus::SUCCESS;
+            }
+
+            bool was_stable = connected && std::chrono::steady_clock::now() - started >= std::chrono::seconds(SSE_STABLE_SECONDS);
+            failures = was_stable ? 1 : failures + 1;
+            if (failures > SSE_MAX_RECONNECTS) {
+                foo_artwork::log_printf("foo_artwork: Real-time now-playing feed keeps dropping (%s), polling instead", error.c_str());
+                {
+                    std::lock_guard<std::mutex> lock(g_probe_cache_mutex);
+                    g_sse_support_cache[endpoint_url.c_str()] = StreamProbeStatus::FAILED;
+                }
+                fall_back_to_polling(endpoint_url, session_token);
+                return;
+            }
+
+            // Exponential backoff with jitter before reconnecting, checking for session changes meanwhile.
+            // A retry: sent by the server sets the shortest wait.
+            int server_retry_ms = (int)(std::min)(client->retry_ms(), (unsigned)SSE_MAX_BACKOFF_MS);
+            int backoff_ms = (std::min)(SSE_MAX_BACKOFF_MS, (std::max)(1000 << (failures - 1), server_retry_ms));
+            backoff_ms += (int)(GetTickCount() % 500);
+            foo_artwork::log_printf("foo_artwork: Real-time now-playing feed disconnected (%s), reconnecting in %d ms", error.c_str(), backoff_ms);
+            for (int waited = 0; waited < backoff_ms && session_active(); waited += 250) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(250));
+            }
+        }
+    }).detach();
+
+    return true;
+}
+
+// Adaptive poll interval. Mid-song the poller sleeps until shortly before the expected
+// song boundary (at most POLL_MAX_INTERVAL_MS at a time, so skips are still noticed),
+// then polls densely and backs off again if the change is late.
+static const DWORD POLL_DEFAULT_INTERVAL_MS = 5000;   // Payload has no timing information
+static const DWORD POLL_MIN_INTERVAL_MS = 500;
+static const DWORD POLL_MAX_INTERVAL_MS = 30000;
+static const int POLL_BOUNDARY_LEAD_MS = 500;         // Wake this long before the expected boundary
+
+// Expected end of the current song for the polling session that measured it (main thread only)
+static std::chrono::steady_clock::time_point g_external_song_ends_at;
+static uint64_t g_external_song_ends_session = 0;
+
+static DWORD next_external_poll_delay_ms(uint64_t session_token) {
+    if (g_external_song_ends_session != session_token) return POLL_DEFAULT_INTERVAL_MS;
+
+    auto until_ms = std::chrono::duration_cast<std::chrono::milliseconds>(g_external_song_ends_at - std::chrono::steady_clock::now()).count();
+
+    long long delay_ms;
+    if (until_ms > POLL_BOUNDARY_LEAD_MS * 3) {
+        // Mid-song: wake just before the boundary
+        delay_ms = until_ms - POLL_BOUNDARY_LEAD_MS;
+    } else {
+        // At or past the boundary: servers publish the change a little late, so poll
+        // every second at first and widen the gap the longer the change takes
+        long long overdue_ms = -until_ms;
+        if (overdue_ms < 5000) delay_ms = 1000;
+        else if (overdue_ms < 15000) delay_ms = 2000;
+        else if (overdue_ms < 30000) delay_ms = 4000;
+        else delay_ms = POLL_DEFAULT_INTERVAL_MS;  // Timing looks stale, poll normally
+    }
+
+    if (delay_ms < POLL_MIN_INTERVAL_MS) delay_ms = POLL_MIN_INTERVAL_MS;
+    if (delay_ms > POLL_MAX_INTERVAL_MS) delay_ms = POLL_MAX_INTERVAL_MS;
+    return (DWORD)delay_ms;
+}
+
 void artwork_manager::poll_external_stream_api(const pfc::string8& endpoint_url, uint64_t session_token) {
     ASSERT_MAIN_THREAD();
     if (g_is_shutting_down.load() || g_external_api_session_token != session_token) return;
@@ -1328,7 +2070,8 @@ void artwork_manager::poll_external_stream_api(const pfc::string8& endpoint_url,
     static_api_ptr_t<playback_control> pc;
     if (!pc->is_playing() && !pc->is_paused()) return;
 
-    async_io_manager::instance().http_get_async(endpoint_url.c_str(), [endpoint_url, session_token](bool success, const pfc::string8& json_response, const pfc::string8& error) {
+    // Conditional GET - an unchanged now-playing payload comes back as 304 and is not parsed again
+    async_io_manager::instance().http_get_conditional_async(endpoint_url.c_str(), [endpoint_url, session_token](bool success, bool not_modified, const pfc::string8& json_response, const pfc::string8& error) {
         ASSERT_MAIN_THREAD();
         if (g_is_shutting_down.load() || g_external_api_session_token != session_token) {
             return;
@@ -1339,141 +2082,33 @@ void artwork_manager::poll_external_stream_api(const pfc::string8& endpoint_url,
             return;
         }
 
-        if (success && !json_response.is_empty()) {
+        bool switched_to_sse = false;
+        if (success && !not_modified && !json_response.is_empty()) {
             try {
                 json j = json::parse(json_response.c_str(), nullptr, false);
                 if (!j.is_discarded()) {
-                    std::string artist, title, art_url;
-
-                    if (j.is_object() && j.contains("now_playing") && j["now_playing"].is_object()) {
-                        auto& np = j["now_playing"];
-                        if (np.contains("song") && np["song"].is_object()) {
-                            auto& song = np["song"];
-                            if (song.contains("artist") && song["artist"].is_string()) artist = song["artist"].get<std::string>();
-                            if (song.contains("title") && song["title"].is_string()) title = song["title"].get<std::string>();
-                            if (song.contains("art") && song["art"].is_string()) art_url = song["art"].get<std::string>();
-                            if (song.contains("text") && song["text"].is_string() && (artist.empty() || title.empty())) {
-                                std::string text = song["text"].get<std::string>();
-                                size_t dash = text.find(" - ");
-                                if (dash != std::string::npos) {
-                                    artist = text.substr(0, dash);
-                                    title = text.substr(dash + 3);
-                                }
-                            }
-                        }
-                    } else if (j.is_array() && !j.empty()) {
-                        const json* matched_station = find_matching_station_in_array(j, g_current_stream_url.c_str());
-                        if (matched_station && matched_station->is_object()) {
-                            if (matched_station->contains("now_playing") && (*matched_station)["now_playing"].is_object()) {
-                                auto& np = (*matched_station)["now_playing"];
-                                if (np.contains("song") && np["song"].is_object()) {
-                                    auto& song = np["song"];
-                                    if (song.contains("artist") && song["artist"].is_string()) artist = song["artist"].get<std::string>();
-                                    if (song.contains("title") && song["title"].is_string()) title = song["title"].get<std::string>();
-                                    if (song.contains("art") && song["art"].is_string()) art_url = song["art"].get<std::string>();
-                                    if (song.contains("text") && song["text"].is_string() && (artist.empty() || title.empty())) {
-                                        std::string text = song["text"].get<std::string>();
-                                        size_t dash = text.find(" - ");
-                                        if (dash != std::string::npos) {
-                                            artist = text.substr(0, dash);
-                                            title = text.substr(dash + 3);
-                                        }
-                                    }
-                                }
-                            } else if (matched_station->contains("song") && (*matched_station)["song"].is_object()) {
-                                auto& song = (*matched_station)["song"];
-                                if (song.contains("artist") && song["artist"].is_string()) artist = song["artist"].get<std::string>();
-                                if (song.contains("title") && song["title"].is_string()) title = song["title"].get<std::string>();
-                                if (song.contains("art") && song["art"].is_string()) art_url = song["art"].get<std::string>();
-                            }
-                        }
-                    } else if (j.is_object()) {
-                        if (j.contains("artist") && j["artist"].is_string()) artist = j["artist"].get<std::string>();
-                        if (j.contains("title") && j["title"].is_string()) title = j["title"].get<std::string>();
-                        if (j.contains("cover_url") && j["cover_url"].is_string()) art_url = j["cover_url"].get<std::string>();
-                        else if (j.contains("art") && j["art"].is_string()) art_url = j["art"].get<std::string>();
-                        else if (j.contains("image") && j["image"].is_string()) art_url = j["image"].get<std::string>();
-                        else if (j.contains("cover") && j["cover"].is_string()) art_url = j["cover"].get<std::string>();
-                        else if (j.contains("artwork") && j["artwork"].is_string()) art_url = j["artwork"].get<std::string>();
-                        
-                        if (j.contains("song") && j["song"].is_object()) {
-                            auto& song = j["song"];
-                            if (artist.empty() && song.contains("artist") && song["artist"].is_string()) artist = song["artist"].get<std::string>();
-                            if (title.empty() && song.contains("title") && song["title"].is_string()) title = song["title"].get<std::string>();
-                            if (art_url.empty() && song.contains("art") && song["art"].is_string()) art_url = song["art"].get<std::string>();
-                            if (art_url.empty() && song.contains("cover_url") && song["cover_url"].is_string()) art_url = song["cover_url"].get<std::string>();
-                            if (art_url.empty() && song.contains("image") && song["image"].is_string()) art_url = song["image"].get<std::string>();
-                            if (art_url.empty() && song.contains("cover") && song["cover"].is_string()) art_url = song["cover"].get<std::string>();
-                            if (art_url.empty() && song.contains("artwork") && song["artwork"].is_string()) art_url = song["artwork"].get<std::string>();
-                        }
+                    int remaining_seconds = apply_external_now_playing(j);
+                    // An overrun song keeps its past end time, so the back-off below can widen
+                    if (remaining_seconds != NOW_PLAYING_TIMING_UNKNOWN) {
+                        g_external_song_ends_at = std::chrono::steady_clock::now() + std::chrono::seconds(remaining_seconds);
+                        g_external_song_ends_session = session_token;
                     }
 
-                    if (!artist.empty() || !title.empty()) {
-                        if (artwork_manager::has_url_flag(g_current_stream_url.c_str(), "inverted")) {
-                            std::swap(artist, title);
-                        }
-
-                        if (artist != g_last_stream_artist.c_str() || title != g_last_stream_title.c_str()) {
-                            foo_artwork::log_printf("foo_artwork: External API cue - Track changed: '%s - %s'", artist.c_str(), title.c_str());
-                            g_rejected_providers_for_current_track.clear();
-                            g_active_resolved_provider.reset();
-
-                            metadb_handle_ptr track;
-                            if (playback_control::get()->get_now_playing(track) && track.is_valid()) {
-                                titleformat_provider::set_track_artwork_info(track, artist.c_str(), title.c_str(), "", "");
-                            }
-
-                            if (!art_url.empty() && (art_url.find("http://") == 0 || art_url.find("https://") == 0) &&
-                                (g_rejected_providers_for_current_track.find("Broadcast Artwork") == g_rejected_providers_for_current_track.end())) {
-                                pfc::string8 cache_key = cfg_single_file_cache ? pfc::string8("current") : generate_cache_key(artist.c_str(), title.c_str());
-                                search_broadcast_artwork_async(art_url.c_str(), cache_key, [artist, title, cache_key](const artwork_result& res) {
-                                    if (res.success) {
-                                        g_last_stream_artist = artist.c_str();
-                                        g_last_stream_title = title.c_str();
-                                        g_stream_monitor_token++;
-                                        stop_rms_silence_detector();
-                                        reset_acrcloud_cooldown();
-                                        log_simplified_track_info(artist.c_str(), title.c_str());
-
-                                        g_active_source = res.source;
-                                        g_active_resolved_provider = res.source;
-
-                                        if (res.data.get_size() > 0) {
-                                            std::vector<BYTE> vec(res.data.get_ptr(), res.data.get_ptr() + res.data.get_size());
-                                            create_bitmap_from_image_data(vec);
-                                        }
-
-                                        metadb_handle_ptr track;
-                                        if (playback_control::get()->get_now_playing(track) && track.is_valid()) {
-                                            pfc::string8 cache_file = async_io_manager::instance().get_cache_file_path(cache_key);
-                                            titleformat_provider::set_track_artwork_info(track, artist.c_str(), title.c_str(), cache_file.c_str(), res.source.c_str());
-                                        }
-
-                                        refresh_all_dui_artwork_panels();
-                                        refresh_all_cui_artwork_panels();
-                                    } else {
-                                        artwork_manager::on_stream_metadata_changed(artist.c_str(), title.c_str());
-                                    }
-                                });
-                            } else {
-                                artwork_manager::on_stream_metadata_changed(artist.c_str(), title.c_str());
-                            }
-                        }
-                    }
+                    // AzuraCast servers with the real-time feed push later changes instead of being polled
+                    switched_to_sse = try_start_external_now_playing_sse(endpoint_url, j, session_token);
                 }
             } catch (...) {}
         }
 
-        // Schedule next poll iteration after 5 seconds on background thread, then post back to main thread
+        if (switched_to_sse) return;
+
+        // Schedule the next poll around the expected song boundary through the timer, then post back to main thread
         if (g_external_api_session_token == session_token && !g_is_shutting_down.load()) {
-            async_io_manager::instance().submit_task([endpoint_url, session_token]() {
-                for (int i = 0; i < 10; ++i) {
-                    if (g_external_api_session_token != session_token || g_is_shutting_down.load()) return;
-                    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-                }
+            DWORD delay_ms = next_external_poll_delay_ms(session_token);
+            async_io_manager::instance().submit_task_after(delay_ms, [endpoint_url, session_token]() {
                 if (g_external_api_session_token != session_token || g_is_shutting_down.load()) return;
 
-                async_io_manager::instance().post_to_main_thread([endpoint_url, session_token]() {
+                async_io_manager::instance().post_to_main_thread("external_stream_poll", [endpoint_url, session_token]() {
                     poll_external_stream_api(endpoint_url, session_token);
                 });
             });
@@ -1525,15 +2160,17 @@ void artwork_manager::reject_current_artwork() {
     }
 
     foo_artwork::log_printf("foo_artwork: Rejecting artwork from '%s' for current track. Searching next provider in chain...", source_to_reject.c_str());
+    titleformat_provider::forget_track_artwork(track);
     g_rejected_providers_for_current_track.insert(source_to_reject.c_str());
     g_active_resolved_provider.reset();
+    g_active_artwork_url.reset();
     g_active_source.reset();
 
-    // Invalidate current cache on disk
-    pfc::string8 cache_key = cfg_single_file_cache ? pfc::string8("current") : generate_cache_key_for_track(track);
-    async_io_manager::instance().cache_remove(cache_key);
+    // Invalidate the cached artwork on disk, in every size tier, so it does not come back
+    // when the panel size changes
+    remove_cached_artwork(generate_cache_key_for_track(track));
     if (cfg_single_file_cache) {
-        async_io_manager::instance().cache_remove("current");
+        remove_cached_artwork("current");
     }
 
     // Clear in-memory deduplication and in-flight records
@@ -1544,8 +2181,7 @@ void artwork_manager::reject_current_artwork() {
     }
 
     // Refresh active panels to trigger re-query with rejected provider excluded
-    refresh_all_dui_artwork_panels();
-    refresh_all_cui_artwork_panels();
+    request_panel_refresh(panel_refresh_provider_rejected);
 }
 
 struct PerceptualVector {
@@ -1734,8 +2370,7 @@ static void start_rms_silence_detector(const pfc::string8& stream_url) {
                                 if (current_token == g_rms_detector_token.load() && g_current_stream_url == stream_url) {
                                     foo_artwork::log_printf("foo_artwork: Settling period complete. Initiating ACRCloud audio recognition...");
                                     g_acrcloud_cooldown_until = std::chrono::steady_clock::time_point{};
-                                    refresh_all_dui_artwork_panels();
-                                    refresh_all_cui_artwork_panels();
+                                    request_panel_refresh(panel_refresh_recognition_due);
                                 }
                             });
                         });
@@ -1801,6 +2436,7 @@ void artwork_manager::on_stream_metadata_changed(const char* raw_artist, const c
     // Reset rejected providers and active provider for the new stream song
     g_rejected_providers_for_current_track.clear();
     g_active_resolved_provider.reset();
+    g_active_artwork_url.reset();
 
     // Increment monitor token to cancel any pending 10s initial metadata fallback monitor
     g_stream_monitor_token++;
@@ -1812,6 +2448,7 @@ void artwork_manager::on_stream_metadata_changed(const char* raw_artist, const c
     reset_acrcloud_cooldown();
 
     uint64_t gen = ++g_search_generation;
+    g_expected_track_seconds = 0;
 
     log_simplified_track_info(clean_art.c_str(), clean_tit.c_str());
 
@@ -1845,8 +2482,7 @@ void artwork_manager::on_stream_metadata_changed(const char* raw_artist, const c
             async_io_manager::instance().cache_set_async(key, res.data);
         }
         if (res.data.get_size() > 0) {
-            std::vector<BYTE> vec(res.data.get_ptr(), res.data.get_ptr() + res.data.get_size());
-            create_bitmap_from_image_data(vec);
+            create_bitmap_from_image_data(res.data);
         }
 
         metadb_handle_ptr now_track;
@@ -1855,8 +2491,7 @@ void artwork_manager::on_stream_metadata_changed(const char* raw_artist, const c
             titleformat_provider::set_track_artwork_info(now_track, clean_art.c_str(), clean_tit.c_str(), cache_file.c_str(), effective_source.c_str());
         }
 
-        refresh_all_dui_artwork_panels();
-        refresh_all_cui_artwork_panels();
+        request_panel_refresh(panel_refresh_artwork_ready);
     };
 
     if (try_broadcast_artwork) {
@@ -1888,7 +2523,7 @@ void artwork_manager::on_stream_metadata_changed(const char* raw_artist, const c
         }
     } else {
         // Multi-file cache mode: check disk cache first for this specific song
-        async_io_manager::instance().cache_get_async(cache_key, [broadcast_art_url, try_broadcast_artwork, clean_art, clean_tit, cache_key, apply_success_result](bool cache_hit, const pfc::array_t<t_uint8>& data, const pfc::string8& err) {
+        cache_get_tiered_async(cache_key, [broadcast_art_url, try_broadcast_artwork, clean_art, clean_tit, cache_key, apply_success_result](bool cache_hit, const image_buffer& data, const pfc::string8& found_key) {
             if (cache_hit && data.get_size() > 0) {
                 pfc::string8 effective_source = (!g_active_resolved_provider.is_empty() && g_active_resolved_provider != "Cache") ? g_active_resolved_provider : pfc::string8("Cache");
                 if (effective_source == "Cache") {
@@ -1939,7 +2574,7 @@ void artwork_manager::start_initial_stream_metadata_monitor(const pfc::string8&
                 return; // Stream changed, stopped, valid meta found, or app exiting
             }
 
-            async_io_manager::instance().post_to_main_thread([stream_url, current_token, last_artist, last_title, valid_meta_found]() {
+            async_io_manager::instance().post_to_main_thread("initial_stream_metadata", [stream_url, current_token, last_artist, last_title, valid_meta_found]() {
                 if (g_is_shutting_down.load() || valid_meta_found->load() || current_token != g_stream_monitor_token.load() || g_current_stream_url != stream_url || g_current_stream_url.is_empty()) {
                     return;
                 }
@@ -1950,11 +2585,8 @@ void artwork_manager::start_initial_stream_metadata_monitor(const pfc::string8&
                 metadb_handle_ptr track;
                 if (pc->get_now_playing(track) && track.is_valid() && track->get_path() == stream_url) {
                     pfc::string8 artist, title;
-                    service_ptr_t<titleformat_object> script_art, script_tit;
-                    static_api_ptr_t<titleformat_compiler>()->compile_safe(script_art, "%artist%");
-                    static_api_ptr_t<titleformat_compiler>()->compile_safe(script_tit, "%title%");
-                    pc->playback_format_title(nullptr, artist, script_art, nullptr, playback_control::display_level_titles);
-                    pc->playback_format_title(nullptr, title, script_tit, nullptr, playback_control::display_level_titles);
+                    pc->playback_format_title(nullptr, artist, titleformat_script_cache::get("%artist%"), nullptr, playback_control::display_level_titles);
+                    pc->playback_format_title(nullptr, title, titleformat_script_cache::get("%title%"), nullptr, playback_control::display_level_titles);
 
                     if (artist.is_empty() && !title.is_empty()) {
                         std::string t_str = title.c_str();
@@ -1994,8 +2626,7 @@ void artwork_manager::start_initial_stream_metadata_monitor(const pfc::string8&
                                 pfc::string8 cache_key = cfg_single_file_cache ? pfc::string8("current") : pfc::string8("stream_fallback");
                                 search_acrcloud_fallback_async(cache_key, [](const artwork_result& res) {
                                     if (res.success && res.data.get_size() > 0) {
-                                        refresh_all_dui_artwork_panels();
-                                        refresh_all_cui_artwork_panels();
+                                        request_panel_refresh(panel_refresh_artwork_ready);
                                     }
                                 });
                             }
@@ -2058,11 +2689,8 @@ void artwork_manager::force_acrcloud_lookup() {
                 async_io_manager::instance().cache_set_async(key_to_use, result.data);
             }
 
-            // Post UI refresh onto main thread to update all active panels
-            async_io_manager::instance().post_to_main_thread([]() {
-                refresh_all_dui_artwork_panels();
-                refresh_all_cui_artwork_panels();
-            });
+            // Update all active panels on the next main-thread turn
+            request_panel_refresh(panel_refresh_artwork_ready);
         } else {
             foo_artwork::log_printf("foo_artwork: Manual ACRCloud lookup FAILED: %s", result.error_message.c_str());
         }
@@ -2082,68 +2710,182 @@ static void schedule_periodic_acrcloud_rescan(uint32_t delay_ms) {
                 g_last_recognized_result = artwork_manager::artwork_result();
                 g_acrcloud_cooldown_until = std::chrono::steady_clock::time_point{};
                 g_vis_stream.release();
-                refresh_all_dui_artwork_panels();
-                refresh_all_cui_artwork_panels();
+                request_panel_refresh(panel_refresh_recognition_due);
             }
         });
     });
 }
 
-static void extract_track_metadata_dynamic(metadb_handle_ptr track, pfc::string8& out_artist, pfc::string8& out_title) {
-    out_artist.reset();
-    out_title.reset();
+static void extract_track_metadata_dynamic(metadb_handle_ptr track, pfc::string8& out_artist, pfc::string8& out_title) {
+    out_artist.reset();
+    out_title.reset();
+
+    if (!track.is_valid()) return;
+
+    pfc::string8 file_path = track->get_path();
+    bool is_youtube = !artwork_manager::extract_youtube_video_id(file_path.c_str()).is_empty();
+    bool is_internet_stream = is_youtube ||
+                              (strstr(file_path.c_str(), "://") && !(strstr(file_path.c_str(), "file://") == file_path.c_str()));
+
+    static_api_ptr_t<playback_control> pc;
+    metadb_handle_ptr now_playing;
+    if (pc->get_now_playing(now_playing) && now_playing == track) {
+        pfc::string8 dyn_art, dyn_tit;
+        if (pc->playback_format_title(nullptr, dyn_art, titleformat_script_cache::get("%artist%"), nullptr, playback_control::display_level_titles)) {
+            if (!dyn_art.is_empty() && dyn_art != "?") out_artist = dyn_art;
+        }
+        if (pc->playback_format_title(nullptr, dyn_tit, titleformat_script_cache::get("%title%"), nullptr, playback_control::display_level_titles)) {
+            if (!dyn_tit.is_empty() && dyn_tit != "?") out_title = dyn_tit;
+        }
+    }
+
+    if (out_artist.is_empty() || out_title.is_empty()) {
+        try {
+            metadb_info_container::ptr info_container = track->get_info_ref();
+            if (info_container.is_valid()) {
+                const file_info& info = info_container->info();
+                if (out_artist.is_empty() && info.meta_get("ARTIST", 0)) out_artist = info.meta_get("ARTIST", 0);
+                if (out_title.is_empty() && info.meta_get("TITLE", 0)) out_title = info.meta_get("TITLE", 0);
+            }
+        } catch (...) {}
+    }
+
+    if (is_internet_stream && (out_artist.is_empty() || out_artist == "Unknown Artist" || out_title.is_empty() || out_title == "Unknown Track")) {
+        if (!g_last_stream_artist.is_empty() && !g_last_stream_title.is_empty()) {
+            out_artist = g_last_stream_artist;
+            out_title = g_last_stream_title;
+        }
+    }
+
+    if (is_internet_stream) {
+        if (artwork_manager::has_url_flag(file_path.c_str(), "inverted") ||
+            artwork_manager::has_url_flag(g_current_stream_url.c_str(), "inverted")) {
+            std::swap(out_artist, out_title);
+        }
+    }
+
+    if (out_artist.is_empty()) out_artist = "Unknown Artist";
+    if (out_title.is_empty()) out_title = "Unknown Track";
+}
+
+static bool is_internet_stream_track(const pfc::string8& file_path) {
+    bool is_youtube = !artwork_manager::extract_youtube_video_id(file_path.c_str()).is_empty() ||
+                      !artwork_manager::extract_youtube_video_id(g_current_stream_url.c_str()).is_empty();
+    return is_youtube ||
+           (strstr(file_path.c_str(), "://") && !(strstr(file_path.c_str(), "file://") == file_path.c_str()));
+}
+
+// Search inputs of one track, derived once per (path, artist, title, size tier) instead of in every
+// pipeline stage: the raw metadata, its sanitized form (streams only) and the disk cache key
+struct track_search_context {
+    pfc::string8 path;
+    pfc::string8 artist;
+    pfc::string8 title;
+    bool is_internet_stream = false;
+    StreamMetadataResult meta;
+    unsigned size_tier = 0;         // get_target_artwork_size() the cache key was built for
+    pfc::string8 cache_key;
+};
+
+static pfc::string8 build_track_cache_key(const track_search_context& ctx) {
+    const pfc::string8& artist = ctx.artist;
+    const pfc::string8& track_name = ctx.title;
+
+    if (ctx.is_internet_stream) {
+        const StreamMetadataResult& meta = ctx.meta;
+        if (meta.is_valid_search && !meta.clean_artist.empty() && !meta.clean_title.empty()) {
+            return artwork_manager::generate_cache_key(meta.clean_artist.c_str(), meta.clean_title.c_str());
+        }
+        if (!artist.is_empty() && !track_name.is_empty()) {
+            return artwork_manager::generate_cache_key(artist.c_str(), track_name.c_str());
+        }
+        return artwork_manager::generate_cache_key(artist.is_empty() ? "Unknown Artist" : artist.c_str(),
+                                                   track_name.is_empty() ? "Unknown Track" : track_name.c_str());
+    } else {
+        // Offline / local track
+        if (!artist.is_empty() && !track_name.is_empty() &&
+            artist != "Unknown Artist" && track_name != "Unknown Track") {
+            return artwork_manager::generate_cache_key(artist.c_str(), track_name.c_str());
+        }
+
+        // Untagged or missing metadata: generate key from local file name
+        pfc::string8 clean_path = ctx.path;
+        if (clean_path.find_first("file://") == 0) {
+            clean_path = clean_path.get_ptr() + 7;
+        }
+        t_size last_slash = clean_path.find_last('\\');
+        if (last_slash == pfc_infinite) last_slash = clean_path.find_last('/');
+        pfc::string8 filename = (last_slash != pfc_infinite) ? pfc::string8(clean_path.get_ptr() + last_slash + 1) : clean_path;
+
+        pfc::string8 key = "_local_";
+        key << filename;
+        key.replace_char('\\', '_');
+        key.replace_char('/', '_');
+        key.replace_char(':', '_');
+        key.replace_char('*', '_');
+        key.replace_char('?', '_');
+        key.replace_char('"', '_');
+        key.replace_char('<', '_');
+        key.replace_char('>', '_');
+        key.replace_char('|', '_');
+        append_size_tier(key);
+        return key;
+    }
+}
+
+// Reads the inputs of a context; derive_track_search_context fills in the rest
+static std::shared_ptr<track_search_context> read_track_search_context(metadb_handle_ptr track) {
+    auto ctx = std::make_shared<track_search_context>();
+    if (!track.is_valid()) {
+        ctx->cache_key = "unknown";
+        return ctx;
+    }
 
-    if (!track.is_valid()) return;
+    ctx->path = track->get_path();
+    ctx->is_internet_stream = is_internet_stream_track(ctx->path);
+    extract_track_metadata_dynamic(track, ctx->artist, ctx->title);
+    ctx->size_tier = artwork_manager::get_target_artwork_size();
+    return ctx;
+}
 
-    pfc::string8 file_path = track->get_path();
-    bool is_youtube = !artwork_manager::extract_youtube_video_id(file_path.c_str()).is_empty();
-    bool is_internet_stream = is_youtube ||
-                              (strstr(file_path.c_str(), "://") && !(strstr(file_path.c_str(), "file://") == file_path.c_str()));
+static void derive_track_search_context(track_search_context& ctx) {
+    if (ctx.is_internet_stream) {
+        ctx.meta = MetadataCleaner::sanitize_stream_metadata(ctx.artist.c_str(), ctx.title.c_str());
+    }
+    ctx.cache_key = build_track_cache_key(ctx);
+}
 
-    static_api_ptr_t<playback_control> pc;
-    metadb_handle_ptr now_playing;
-    if (pc->get_now_playing(now_playing) && now_playing == track) {
-        static_api_ptr_t<titleformat_compiler> compiler;
-        service_ptr_t<titleformat_object> script_artist, script_title;
-        compiler->compile_force(script_artist, "%artist%");
-        compiler->compile_force(script_title, "%title%");
+// Most recently used contexts of the search pipeline; the metadata is re-read on every
+// call because stream titles change under the same handle, only the derived values are
+// reused. Playlist row lookups do not go through it (see generate_cache_key_for_track).
+static const size_t MAX_TRACK_SEARCH_CONTEXTS = 8;
+static std::mutex g_track_search_context_mutex;
+static std::vector<std::shared_ptr<const track_search_context>> g_track_search_contexts;
 
-        pfc::string8 dyn_art, dyn_tit;
-        if (pc->playback_format_title(nullptr, dyn_art, script_artist, nullptr, playback_control::display_level_titles)) {
-            if (!dyn_art.is_empty() && dyn_art != "?") out_artist = dyn_art;
-        }
-        if (pc->playback_format_title(nullptr, dyn_tit, script_title, nullptr, playback_control::display_level_titles)) {
-            if (!dyn_tit.is_empty() && dyn_tit != "?") out_title = dyn_tit;
-        }
-    }
+static std::shared_ptr<const track_search_context> get_track_search_context(metadb_handle_ptr track) {
+    std::shared_ptr<track_search_context> ctx = read_track_search_context(track);
+    if (!track.is_valid()) return ctx;
 
-    if (out_artist.is_empty() || out_title.is_empty()) {
-        try {
-            metadb_info_container::ptr info_container = track->get_info_ref();
-            if (info_container.is_valid()) {
-                const file_info& info = info_container->info();
-                if (out_artist.is_empty() && info.meta_get("ARTIST", 0)) out_artist = info.meta_get("ARTIST", 0);
-                if (out_title.is_empty() && info.meta_get("TITLE", 0)) out_title = info.meta_get("TITLE", 0);
+    {
+        std::lock_guard<std::mutex> lock(g_track_search_context_mutex);
+        for (size_t i = 0; i < g_track_search_contexts.size(); i++) {
+            const auto& cached = g_track_search_contexts[i];
+            if (cached->is_internet_stream == ctx->is_internet_stream && cached->path == ctx->path &&
+                cached->artist == ctx->artist && cached->title == ctx->title && cached->size_tier == ctx->size_tier) {
+                auto hit = cached;
+                g_track_search_contexts.erase(g_track_search_contexts.begin() + i);
+                g_track_search_contexts.insert(g_track_search_contexts.begin(), hit);
+                return hit;
             }
-        } catch (...) {}
-    }
-
-    if (is_internet_stream && (out_artist.is_empty() || out_artist == "Unknown Artist" || out_title.is_empty() || out_title == "Unknown Track")) {
-        if (!g_last_stream_artist.is_empty() && !g_last_stream_title.is_empty()) {
-            out_artist = g_last_stream_artist;
-            out_title = g_last_stream_title;
         }
     }
 
-    if (is_internet_stream) {
-        if (artwork_manager::has_url_flag(file_path.c_str(), "inverted") ||
-            artwork_manager::has_url_flag(g_current_stream_url.c_str(), "inverted")) {
-            std::swap(out_artist, out_title);
-        }
-    }
+    derive_track_search_context(*ctx);
 
-    if (out_artist.is_empty()) out_artist = "Unknown Artist";
-    if (out_title.is_empty()) out_title = "Unknown Track";
+    std::lock_guard<std::mutex> lock(g_track_search_context_mutex);
+    g_track_search_contexts.insert(g_track_search_contexts.begin(), ctx);
+    if (g_track_search_contexts.size() > MAX_TRACK_SEARCH_CONTEXTS) g_track_search_contexts.pop_back();
+    return ctx;
 }
 
 void artwork_manager::search_artwork_pipeline(metadb_handle_ptr track, artwork_callback callback) {
@@ -2171,22 +2913,22 @@ void artwork_manager::search_artwork_pipeline(metadb_handle_ptr track, artwork_c
 
     bool is_youtube = !extract_youtube_video_id(file_path.c_str()).is_empty() || 
                       !extract_youtube_video_id(g_current_stream_url.c_str()).is_empty();
-    bool is_internet_stream = is_youtube ||
-                              (strstr(file_path.c_str(), "://") && !(strstr(file_path.c_str(), "file://") == file_path.c_str()));
 
-    pfc::string8 artist, track_name;
-    extract_track_metadata_dynamic(track, artist, track_name);
+    std::shared_ptr<const track_search_context> ctx = get_track_search_context(track);
+    bool is_internet_stream = ctx->is_internet_stream;
+    pfc::string8 artist = ctx->artist;
+    pfc::string8 track_name = ctx->title;
 
     if (!is_internet_stream) {
         log_simplified_track_info(artist.c_str(), track_name.c_str());
     } else {
-        StreamMetadataResult meta = MetadataCleaner::sanitize_stream_metadata(artist.c_str(), track_name.c_str());
+        const StreamMetadataResult& meta = ctx->meta;
         if (meta.is_valid_search && !meta.is_station_or_url) {
             log_simplified_track_info(meta.first_artist.c_str(), meta.clean_title.c_str());
         }
     }
     
-    pfc::string8 cache_key = cfg_single_file_cache ? pfc::string8("current") : generate_cache_key_for_track(track);
+    pfc::string8 cache_key = cfg_single_file_cache ? pfc::string8("current") : ctx->cache_key;
 
     bool is_different_track = false;
     if (!g_active_playing_track.is_valid() || !track.is_valid()) {
@@ -2199,10 +2941,14 @@ void artwork_manager::search_artwork_pipeline(metadb_handle_ptr track, artwork_c
         g_active_playing_track = track;
         g_rejected_providers_for_current_track.clear();
         g_active_resolved_provider.reset();
+        g_active_artwork_url.reset();
     }
     g_active_cache_key = cache_key;
 
     uint64_t gen = ++g_search_generation;
+
+    double track_length = is_internet_stream ? 0.0 : track->get_length();
+    g_expected_track_seconds = track_length > 0 ? (unsigned)(track_length + 0.5) : 0;
     auto original_callback = callback;
     auto wrapped_callback = [gen, track, artist, track_name, cache_key, original_callback](const artwork_result& res) {
         if (gen != g_search_generation.load()) {
@@ -2231,7 +2977,7 @@ void artwork_manager::search_artwork_pipeline(metadb_handle_ptr track, artwork_c
     callback = wrapped_callback;
 
     if (is_internet_stream) {
-        StreamMetadataResult meta = MetadataCleaner::sanitize_stream_metadata(artist.c_str(), track_name.c_str());
+        const StreamMetadataResult& meta = ctx->meta;
         bool force_acrcloud = has_url_flag(file_path.c_str(), "forceacr") || has_url_flag(g_current_stream_url.c_str(), "forceacr");
         bool is_reject_station_covers = has_url_flag(file_path.c_str(), "rejectstationcovers") || has_url_flag(g_current_stream_url.c_str(), "rejectstationcovers");
 
@@ -2428,8 +3174,8 @@ void artwork_manager::search_artwork_pipeline(metadb_handle_ptr track, artwork_c
 }
 
 void artwork_manager::check_cache_async(const pfc::string8& cache_key, metadb_handle_ptr track, artwork_callback callback) {
-    async_io_manager::instance().cache_get_async(cache_key, 
-        [cache_key, track, callback](bool success, const pfc::array_t<t_uint8>& data, const pfc::string8& error) {
+    cache_get_tiered_async(cache_key,
+        [cache_key, track, callback](bool success, const image_buffer& data, const pfc::string8& found_key) {
             if (success && data.get_size() > 0) {
                 bool is_already_resolved = (!g_active_resolved_provider.is_empty() && g_active_resolved_provider != "Cache");
                 if (!is_already_resolved) {
@@ -2455,8 +3201,8 @@ void artwork_manager::check_cache_async(const pfc::string8& cache_key, metadb_ha
                 // CACHE PRIORITY & INVALIDATION CHECK:
                 // For local tracks, check if local artwork (embedded or in folder) was added or updated after cache was generated
                 if (track.is_valid() && !is_stream && !cfg_skip_local_artwork) {
-                    async_io_manager::instance().submit_task([cache_key, track, file_path, data, callback, is_already_resolved]() {
-                        bool local_art_newer = is_local_artwork_newer_than_cache(file_path, cache_key);
+                    async_io_manager::instance().submit_task([cache_key, found_key, track, file_path, data, callback, is_already_resolved]() {
+                        bool local_art_newer = is_local_artwork_newer_than_cache(file_path, found_key);
                         if (local_art_newer) {
                             find_local_artwork_async(track, [cache_key, track, data, callback](const artwork_result& local_result) {
                                 if (local_result.success && local_result.data.get_size() > 0) {
@@ -2498,8 +3244,8 @@ void artwork_manager::check_cache_async(const pfc::string8& cache_key, metadb_ha
 
 void artwork_manager::check_cache_async_metadata(const pfc::string8& cache_key, const pfc::string8& artist, const pfc::string8& track, artwork_callback callback) {
     // Check cache first, then fall back to Broadcast Artwork / API search on miss
-    async_io_manager::instance().cache_get_async(cache_key,
-        [cache_key, artist, track, callback](bool success, const pfc::array_t<t_uint8>& data, const pfc::string8& error) {
+    cache_get_tiered_async(cache_key,
+        [cache_key, artist, track, callback](bool success, const image_buffer& data, const pfc::string8& found_key) {
             if (success && data.get_size() > 0) {
                 bool is_already_resolved = (!g_active_resolved_provider.is_empty() && g_active_resolved_provider != "Cache");
                 if (!is_already_resolved) {
@@ -2547,8 +3293,9 @@ void artwork_manager::search_local_async(const pfc::string8& file_path, const pf
     bool is_youtube = !extract_youtube_video_id(file_path.c_str()).is_empty() || 
                       !extract_youtube_video_id(g_current_stream_url.c_str()).is_empty();
 
-    pfc::string8 artist, track_name;
-    extract_track_metadata_dynamic(track, artist, track_name);
+    std::shared_ptr<const track_search_context> ctx = get_track_search_context(track);
+    pfc::string8 artist = ctx->artist;
+    pfc::string8 track_name = ctx->title;
 
     // If user wants to skip local artwork or if this is a YouTube stream, go directly to API search
     if (cfg_skip_local_artwork || is_youtube) {
@@ -2981,11 +3728,11 @@ void artwork_manager::search_acrcloud_fallback_async(const pfc::string8& cache_k
     });
 }
 
-void artwork_manager::search_apis_by_priority(const pfc::string8& artist, const pfc::string8& track, const pfc::string8& cache_key, artwork_callback callback, const std::vector<ApiType>& api_order, size_t index, bool force_enable_apis) {
+void artwork_manager::search_apis_by_priority(const pfc::string8& artist, const pfc::string8& track, const pfc::string8& cache_key, artwork_callback callback, const std::vector<ApiType>& api_order, size_t index, bool force_enable_apis, bool report_only) {
     ASSERT_MAIN_THREAD();
     if (g_is_shutting_down.load() || core_api::is_shutting_down()) return;
     
-    if (index == 0) {
+    if (index == 0 && !report_only) {
         StreamMetadataResult meta = MetadataCleaner::sanitize_stream_metadata(artist.c_str(), track.c_str());
         if (meta.is_valid_search && !meta.is_station_or_url) {
             log_simplified_track_info(meta.first_artist.c_str(), meta.clean_title.c_str());
@@ -3028,7 +3775,7 @@ void artwork_manager::search_apis_by_priority(const pfc::string8& artist, const
     
     if (!api_enabled) {
         // Skip this API and try the next one
-        search_apis_by_priority(artist, track, cache_key, callback, api_order, index + 1, force_enable_apis);
+        search_apis_by_priority(artist, track, cache_key, callback, api_order, index + 1, force_enable_apis, report_only);
         return;
     }
     
@@ -3044,7 +3791,14 @@ void artwork_manager::search_apis_by_priority(const pfc::string8& artist, const
     // Check if this provider has been rejected by user for current track
     if (g_rejected_providers_for_current_track.find(current_api_name.c_str()) != g_rejected_providers_for_current_track.end()) {
         foo_artwork::log_printf("foo_artwork: Skipping rejected provider '%s' for current track.", current_api_name.c_str());
-        search_apis_by_priority(artist, track, cache_key, callback, api_order, index + 1, force_enable_apis);
+        search_apis_by_priority(artist, track, cache_key, callback, api_order, index + 1, force_enable_apis, report_only);
+        return;
+    }
+
+    // Skip providers whose circuit breaker is open after repeated failures
+    if (!provider_health::instance().allow_request(current_api_name.c_str())) {
+        foo_artwork::log_printf("foo_artwork: Skipping %s - provider is failing, circuit breaker open.", current_api_name.c_str());
+        search_apis_by_priority(artist, track, cache_key, callback, api_order, index + 1, force_enable_apis, report_only);
         return;
     }
 
@@ -3053,6 +3807,8 @@ void artwork_manager::search_apis_by_priority(const pfc::string8& artist, const
     api_dedup_key += artist.c_str();
     api_dedup_key += "|";
     api_dedup_key += track.c_str();
+    // A report-only lookup never caches, so an ordinary one must not merge into it
+    if (report_only) api_dedup_key += "|report";
 
     {
         std::lock_guard<std::mutex> lock(g_in_flight_mutex);
@@ -3094,7 +3850,13 @@ void artwork_manager::search_apis_by_priority(const pfc::string8& artist, const
     }
     
     // Create a callback that will either return success or try the next API for all pending callbacks
-    auto api_callback = [artist, track, cache_key, api_order, index, force_enable_apis, api_dedup_key](const artwork_result& result) {
+    auto api_callback = [artist, track, cache_key, api_order, index, force_enable_apis, report_only, api_dedup_key](const artwork_result& provider_result) {
+        // Reject placeholders and tiny thumbnails before they reach the cache or the panels
+        artwork_result result = provider_result;
+        if (result.success) {
+            check_artwork_dimensions(result, (unsigned)(cfg_min_artwork_size > 0 ? (int)cfg_min_artwork_size : 0));
+        }
+
         pfc::string8 api_name;
         switch (api_order[index]) {
             case ApiType::iTunes: api_name = "iTunes"; break;
@@ -3116,30 +3878,83 @@ void artwork_manager::search_apis_by_priority(const pfc::string8& artist, const
             }
         }
 
-        if (result.success) {
-            foo_artwork::log_printf("foo_artwork: SUCCESS - Artwork retrieved from %s for '%s - %s' (%u bytes)", api_name.c_str(), artist.c_str(), track.c_str(), (unsigned int)result.data.get_size());
-            g_active_resolved_provider = api_name;
-            g_active_source = api_name;
+        // Makes the artwork the active one and caches it, then hands it to the callbacks.
+        // A report-only lookup leaves that to the search that started it.
+        auto accept = [api_name, artist, track, cache_key, report_only](const artwork_result& accepted, const std::vector<artwork_callback>& callbacks) {
+            if (report_only) {
+                for (const auto& cb : callbacks) {
+                    if (cb) cb(accepted);
+                }
+                return;
+            }
+
+            // The winner of a hedged lookup can come from a later provider
+            pfc::string8 provider = accepted.source.is_empty() ? api_name : accepted.source;
+            foo_artwork::log_printf("foo_artwork: SUCCESS - Artwork retrieved from %s for '%s - %s' (%u bytes, match %.2f)", provider.c_str(), artist.c_str(), track.c_str(), (unsigned int)accepted.data.get_size(), accepted.match_score);
+            image_buffer::log_stats("after download");
+            g_active_resolved_provider = provider;
+            g_active_source = provider;
+            g_active_artwork_url = accepted.url;
             cancel_acrcloud_tasks(); // Cancel any pending background ACRCloud sampling tasks
             if (cfg_enable_disk_cache || cfg_single_file_cache) {
+                // Keep the full resolution URL next to a panel-sized image so the viewer
+                // can still fetch the original when the artwork later comes from the cache
+                pfc::string8 full_url = get_full_resolution_url(accepted.url.c_str());
+                auto cache_image = [&full_url](const pfc::string8& key, const image_buffer& data) {
+                    async_io_manager::instance().cache_set_async(key, data);
+                    set_full_resolution_url(key, full_url);
+                };
                 if (!cache_key.is_empty()) {
-                    async_io_manager::instance().cache_set_async(cache_key, result.data);
+                    cache_image(cache_key, accepted.data);
                 }
                 if (cfg_single_file_cache) {
-                    async_io_manager::instance().cache_set_async("current", result.data);
+                    cache_image("current", accepted.data);
                 }
             }
-            for (const auto& cb : callbacks_to_call) {
-                if (cb) cb(result);
+            for (const auto& cb : callbacks) {
+                if (cb) cb(accepted);
             }
+        };
+
+        if (result.success && result.match_score < candidate_ranker::STRONG_SCORE && index + 1 < api_order.size()) {
+            // Weak match: ask the next providers once for all merged callbacks, and keep this
+            // artwork unless they find a better match within HEDGE_BUDGET_MS. The later
+            // providers run one after another, so without the budget a weak hit would wait
+            // for all of them. Only one result is accepted, whichever is decided first.
+            foo_artwork::log_printf("foo_artwork: Weak match from %s for '%s - %s' (match %.2f), trying next provider",
+                           api_name.c_str(), artist.c_str(), track.c_str(), result.match_score);
+            auto decided = std::make_shared<std::atomic<bool>>(false);
+            search_apis_by_priority(artist, track, cache_key, [accept, result, callbacks_to_call, decided](const artwork_result& next) {
+                bool better = next.success && next.match_score > result.match_score;
+                if (decided->exchange(true)) {
+                    if (better) {
+                        foo_artwork::log_printf("foo_artwork: Better match (%.2f) arrived after the weak match was shown, ignored",
+                                       next.match_score);
+                    }
+                    return;
+                }
+                accept(better ? next : result, callbacks_to_call);
+            }, api_order, index + 1, force_enable_apis, true);
+
+            async_io_manager::instance().submit_task_after(candidate_ranker::HEDGE_BUDGET_MS, [accept, result, callbacks_to_call, decided]() {
+                async_io_manager::instance().post_to_main_thread([accept, result, callbacks_to_call, decided]() {
+                    if (decided->exchange(true)) return;
+                    foo_artwork::log_printf("foo_artwork: No better match within %u ms, keeping the weak match", candidate_ranker::HEDGE_BUDGET_MS);
+                    accept(result, callbacks_to_call);
+                });
+            });
+        } else if (result.success) {
+            accept(result, callbacks_to_call);
         } else {
             foo_artwork::log_printf("foo_artwork: API FAILED - %s failed for '%s - %s' (error: %s)", 
                            api_name.c_str(), artist.c_str(), track.c_str(), result.error_message.c_str());
             
             // This API failed, try the next one for all merged callbacks
-            for (const auto& cb : callbacks_to_call) {
-                search_apis_by_priority(artist, track, cache_key, cb, api_order, index + 1, force_enable_apis);
-            }
+            search_apis_by_priority(artist, track, cache_key, [callbacks_to_call](const artwork_result& next) {
+                for (const auto& cb : callbacks_to_call) {
+                    if (cb) cb(next);
+                }
+            }, api_order, index + 1, force_enable_apis, report_only);
         }
     };
 
@@ -3209,8 +4024,7 @@ void artwork_manager::find_local_artwork_async(metadb_handle_ptr track, artwork_
                     
                     auto art_data = extractor->query(artwork_ids[i], fb2k::noAbort);
                     if (art_data.is_valid() && art_data->get_size() > 0) {
-                        result.data.set_size(art_data->get_size());
-                        memcpy(result.data.get_ptr(), art_data->get_ptr(), art_data->get_size());
+                        result.data = image_buffer::copy_of(art_data->get_ptr(), art_data->get_size());
                         result.mime_type = detect_mime_type(result.data.get_ptr(), result.data.get_size());
                         
                         // Check if the tagged artwork format is supported
@@ -3274,7 +4088,8 @@ void artwork_manager::search_itunes_api_async(const char* artist, const char* tr
        
         // Parse JSON response to extract artwork URL
         pfc::string8 artwork_url;
-        if (!parse_itunes_json(artist_str, track_str, response, artwork_url)) {
+        double match_score = 1.0;
+        if (!parse_itunes_json(artist_str, track_str, response, artwork_url, match_score)) {
             artwork_result result;
             result.success = false;
             result.error_message = "No artwork found in itunes response";
@@ -3285,25 +4100,29 @@ void artwork_manager::search_itunes_api_async(const char* artist, const char* tr
         
         
         // Download the artwork image with 600x600 fallback if 1200x1200 fails
-        async_io_manager::instance().http_get_binary_async(artwork_url, [callback, artwork_url](bool success, const pfc::array_t<t_uint8>& data, const pfc::string8& error) {
+        async_io_manager::instance().http_get_binary_async(artwork_url, [callback, artwork_url, match_score](bool success, const image_buffer& data, const pfc::string8& error) {
             if (success && data.get_size() > 0) {
                 artwork_result result;
                 result.success = true;
                 result.data = data;
                 result.mime_type = detect_mime_type(data.get_ptr(), data.get_size());
                 result.source = "iTunes";  // Set source for OSD display
+                result.url = artwork_url;
+                result.match_score = match_score;
                 callback(result);
             } else {
                 pfc::string8 fallback_url = artwork_url;
                 fallback_url.replace_string("1200x1200", "600x600");
                 if (fallback_url != artwork_url) {
-                    async_io_manager::instance().http_get_binary_async(fallback_url, [callback](bool success2, const pfc::array_t<t_uint8>& data2, const pfc::string8& error2) {
+                    async_io_manager::instance().http_get_binary_async(fallback_url, [callback, fallback_url, match_score](bool success2, const image_buffer& data2, const pfc::string8& error2) {
                         artwork_result result;
                         if (success2 && data2.get_size() > 0) {
                             result.success = true;
                             result.data = data2;
                             result.mime_type = detect_mime_type(data2.get_ptr(), data2.get_size());
                             result.source = "iTunes";
+                            result.url = fallback_url;
+                            result.match_score = match_score;
                         } else {
                             result.success = false;
                             result.error_message = "Failed to download iTunes artwork: ";
@@ -3374,7 +4193,8 @@ void artwork_manager::search_discogs_api_async(const char* artist, const char* t
         
         // Parse JSON response to extract artwork URL
         pfc::string8 artwork_url;
-        if (!parse_discogs_json(artist_str, track_str, response, artwork_url)) {
+        double match_score = 1.0;
+        if (!parse_discogs_json(artist_str, track_str, response, artwork_url, match_score)) {
             artwork_result result;
             result.success = false;
             result.error_message = "No artwork found in Discogs response";
@@ -3384,13 +4204,15 @@ void artwork_manager::search_discogs_api_async(const char* artist, const char* t
        
         
         // Download the artwork image
-        async_io_manager::instance().http_get_binary_async(artwork_url, [callback, artwork_url](bool success, const pfc::array_t<t_uint8>& data, const pfc::string8& error) {
+        async_io_manager::instance().http_get_binary_async(artwork_url, [callback, artwork_url, match_score](bool success, const image_buffer& data, const pfc::string8& error) {
             artwork_result result;
             if (success && data.get_size() > 0) {
                 result.success = true;
                 result.data = data;
                 result.mime_type = detect_mime_type(data.get_ptr(), data.get_size());
                 result.source = "Discogs";  // Set source for OSD display
+                result.url = artwork_url;
+                result.match_score = match_score;
             } else {
                 result.success = false;
                 result.error_message = "Failed to download Discogs artwork: ";
@@ -3419,8 +4241,12 @@ void artwork_manager::search_lastfm_api_async(const char* artist, const char* ti
     url << "&track=" << url_encode(title);
     url << "&autocorrect=1&format=json";
     
+    // Copy parameters to avoid lambda capture issues
+    pfc::string8 artist_str = artist;
+    pfc::string8 title_str = title;
+
     // Make async HTTP request
-    async_io_manager::instance().http_get_async(url, [callback](bool success, const pfc::string8& response, const pfc::string8& error) {
+    async_io_manager::instance().http_get_async(url, [callback, artist_str, title_str](bool success, const pfc::string8& response, const pfc::string8& error) {
         if (!success) {
             artwork_result result;
             result.success = false;
@@ -3431,7 +4257,8 @@ void artwork_manager::search_lastfm_api_async(const char* artist, const char* ti
         }
         // Parse JSON response to extract artwork URL
         pfc::string8 artwork_url;
-        if (!parse_lastfm_json(response, artwork_url)) {
+        double match_score = 1.0;
+        if (!parse_lastfm_json(artist_str, title_str, response, artwork_url, match_score)) {
             artwork_result result;
             result.success = false;
             result.error_message = "No artwork found in Last.fm response";
@@ -3440,13 +4267,15 @@ void artwork_manager::search_lastfm_api_async(const char* artist, const char* ti
         }
         
         // Download the artwork image
-        async_io_manager::instance().http_get_binary_async(artwork_url, [callback](bool success, const pfc::array_t<t_uint8>& data, const pfc::string8& error) {
+        async_io_manager::instance().http_get_binary_async(artwork_url, [callback, artwork_url, match_score](bool success, const image_buffer& data, const pfc::string8& error) {
             artwork_result result;
             if (success && data.get_size() > 0) {
                 result.success = true;
                 result.data = data;
                 result.mime_type = detect_mime_type(data.get_ptr(), data.get_size());
                 result.source = "Last.fm";  // Set source for OSD display
+                result.url = artwork_url;
+                result.match_score = match_score;
             } else {
                 result.success = false;
                 result.error_message = "Failed to download Last.fm artwork: ";
@@ -3480,15 +4309,18 @@ void artwork_manager::perform_deezer_fallback_search(const char* artist, const c
         async_io_manager::instance().http_get_async(artist_only_url, [artist_copy, track_copy, callback](bool success, const pfc::string8& response, const pfc::string8& error) {
             if (success) {
                 pfc::string8 artwork_url;
-                if (artwork_manager::parse_deezer_json(artist_copy, track_copy, response, artwork_url)) {
+                double match_score = 1.0;
+                if (artwork_manager::parse_deezer_json(artist_copy, track_copy, response, artwork_url, match_score)) {
                     // Download artwork
-                    async_io_manager::instance().http_get_binary_async(artwork_url, [callback](bool dl_success, const pfc::array_t<t_uint8>& data, const pfc::string8& dl_error) {
+                    async_io_manager::instance().http_get_binary_async(artwork_url, [callback, artwork_url, match_score](bool dl_success, const image_buffer& data, const pfc::string8& dl_error) {
                         artwork_result result;
                         if (dl_success && data.get_size() > 0) {
                             result.success = true;
                             result.data = data;
                             result.mime_type = artwork_manager::detect_mime_type(data.get_ptr(), data.get_size());
                             result.source = "Deezer";
+                            result.url = artwork_url;
+                            result.match_score = match_score;
                         } else {
                             result.success = false;
                             result.error_message = "Failed to download Deezer artwork";
@@ -3559,20 +4391,23 @@ void artwork_manager::search_deezer_api_async(const char* artist, const char* tr
         
         // Parse JSON response to extract artwork URL
         pfc::string8 artwork_url;
-        if (!artwork_manager::parse_deezer_json(artist_str, track_str, response, artwork_url)) {
+        double match_score = 1.0;
+        if (!artwork_manager::parse_deezer_json(artist_str, track_str, response, artwork_url, match_score)) {
             // Try fallback search strategies
             artwork_manager::perform_deezer_fallback_search(artist_str, track_str, callback);
             return;
         }
         
         // Download the artwork image
-        async_io_manager::instance().http_get_binary_async(artwork_url, [callback](bool success, const pfc::array_t<t_uint8>& data, const pfc::string8& error) {
+        async_io_manager::instance().http_get_binary_async(artwork_url, [callback, artwork_url, match_score](bool success, const image_buffer& data, const pfc::string8& error) {
             artwork_result result;
             if (success && data.get_size() > 0) {
                 result.success = true;
                 result.data = data;
                 result.mime_type = artwork_manager::detect_mime_type(data.get_ptr(), data.get_size());
                 result.source = "Deezer";  // Set source for OSD display
+                result.url = artwork_url;
+                result.match_score = match_score;
             } else {
                 result.success = false;
                 result.error_message = "Failed to download Deezer artwork: ";
@@ -3607,12 +4442,13 @@ void artwork_manager::download_image_async(const char* url, artwork_callback cal
     }
 
     pfc::string8 download_url = url;
-    async_io_manager::instance().http_get_binary_async(download_url, [callback](bool success, const pfc::array_t<t_uint8>& data, const pfc::string8& error) {
+    async_io_manager::instance().http_get_binary_async(download_url, [callback](bool success, const image_buffer& data, const pfc::string8& error) {
         if (success && data.get_size() > 0 && is_valid_image_data(data.get_ptr(), data.get_size())) {
             artwork_result result;
             result.data = data;
             result.mime_type = detect_mime_type(data.get_ptr(), data.get_size());
             result.success = true;
+            check_artwork_dimensions(result, 0);
             async_io_manager::instance().post_to_main_thread([callback, result]() {
                 callback(result);
             });
@@ -3627,7 +4463,7 @@ void artwork_manager::download_image_async(const char* url, artwork_callback cal
     });
 }
 
-void artwork_manager::validate_and_complete_result(const pfc::array_t<t_uint8>& data, artwork_callback callback) {
+void artwork_manager::validate_and_complete_result(const image_buffer& data, artwork_callback callback) {
     if (data.get_size() == 0) {
         artwork_result result;
         result.success = false;
@@ -3653,6 +4489,7 @@ void artwork_manager::validate_and_complete_result(const pfc::array_t<t_uint8>&
     result.mime_type = detect_mime_type(data.get_ptr(), data.get_size());
     result.success = true;
     result.source = (!g_active_resolved_provider.is_empty() && g_active_resolved_provider != "Cache") ? g_active_resolved_provider : pfc::string8("Cache");
+    check_artwork_dimensions(result, 0);
     
     async_io_manager::instance().post_to_main_thread([callback, result]() {
         callback(result);
@@ -3707,6 +4544,26 @@ pfc::string8 artwork_manager::detect_mime_type(const t_uint8* data, size_t size)
     return "application/octet-stream";
 }
 
+bool artwork_manager::check_artwork_dimensions(artwork_result& result, unsigned min_size) {
+    // Read dimensions from the image header only; the full decode happens later in the UI
+    image_probe_info info;
+    if (!probe_image_header(result.data.get_ptr(), result.data.get_size(), info)) {
+        // Unknown layout but valid signature - let the decoder decide
+        return true;
+    }
+
+    result.width = info.width;
+    result.height = info.height;
+
+    if (min_size > 0 && (info.width < min_size || info.height < min_size)) {
+        result.success = false;
+        result.error_message = "Artwork too small (";
+        result.error_message << info.width << "x" << info.height << " px, minimum " << min_size << " px)";
+        return false;
+    }
+    return true;
+}
+
 bool artwork_manager::is_supported_image_format(const pfc::string8& mime_type) {
     // Supported formats that can be displayed in foobar2000
     return mime_type == "image/jpeg" ||
@@ -3771,7 +4628,8 @@ pfc::string8 artwork_manager::generate_cache_key(const char* artist, const char*
     key.replace_char('<', '_');
     key.replace_char('>', '_');
     key.replace_char('|', '_');
-    
+
+    append_size_tier(key);
     return key;
 }
 
@@ -3788,56 +4646,38 @@ static std::wstring utf8_to_wide(const pfc::string8& utf8_str) {
     return result;
 }
 
+// Called for every visible playlist row (%foo_artwork_cover%), so it builds the key without
+// the pipeline's context cache: a long playlist would evict the now-playing track's context
 pfc::string8 artwork_manager::generate_cache_key_for_track(metadb_handle_ptr track) {
-    if (!track.is_valid()) return pfc::string8("unknown");
-
-    pfc::string8 artist, track_name;
-    pfc::string8 file_path = track->get_path();
-    bool is_youtube = !extract_youtube_video_id(file_path.c_str()).is_empty() || 
-                      !extract_youtube_video_id(g_current_stream_url.c_str()).is_empty();
-    bool is_internet_stream = is_youtube ||
-                              (strstr(file_path.c_str(), "://") && !(strstr(file_path.c_str(), "file://") == file_path.c_str()));
+    std::shared_ptr<track_search_context> ctx = read_track_search_context(track);
+    if (!track.is_valid()) return ctx->cache_key;
+    derive_track_search_context(*ctx);
+    return ctx->cache_key;
+}
 
-    extract_track_metadata_dynamic(track, artist, track_name);
+void artwork_manager::remove_cached_artwork(const pfc::string8& cache_key) {
+    pfc::string8 base = strip_size_tier(cache_key);
+    std::vector<pfc::string8> keys(1, base);
+    for (unsigned tier : ARTWORK_CACHE_TIERS) {
+        pfc::string8 key = base;
+        key << "@" << pfc::format_int(tier);
+        keys.push_back(key);
+    }
 
-    if (is_internet_stream) {
-        StreamMetadataResult meta = MetadataCleaner::sanitize_stream_metadata(artist.c_str(), track_name.c_str());
-        if (meta.is_valid_search && !meta.clean_artist.empty() && !meta.clean_title.empty()) {
-            return generate_cache_key(meta.clean_artist.c_str(), meta.clean_title.c_str());
-        }
-        if (!artist.is_empty() && !track_name.is_empty()) {
-            return generate_cache_key(artist.c_str(), track_name.c_str());
-        }
-        return generate_cache_key(artist.is_empty() ? "Unknown Artist" : artist.c_str(),
-                                  track_name.is_empty() ? "Unknown Track" : track_name.c_str());
-    } else {
-        // Offline / local track
-        if (!artist.is_empty() && !track_name.is_empty() &&
-            artist != "Unknown Artist" && track_name != "Unknown Track") {
-            return generate_cache_key(artist.c_str(), track_name.c_str());
-        }
+    std::vector<pfc::string8> files;
+    for (const auto& key : keys) {
+        async_io_manager::instance().cache_remove(key);
+        files.push_back(async_io_manager::instance().get_cache_file_path(key));
+    }
 
-        // Untagged or missing metadata: generate key from local file name
-        pfc::string8 clean_path = file_path;
-        if (clean_path.find_first("file://") == 0) {
-            clean_path = clean_path.get_ptr() + 7;
-        }
-        t_size last_slash = clean_path.find_last('\\');
-        if (last_slash == pfc_infinite) last_slash = clean_path.find_last('/');
-        pfc::string8 filename = (last_slash != pfc_infinite) ? pfc::string8(clean_path.get_ptr() + last_slash + 1) : clean_path;
+    // %foo_artwork_cover% must not keep pointing at the deleted files
+    titleformat_provider::forget_cover_files(files);
 
-        pfc::string8 key = "_local_";
-        key << filename;
-        key.replace_char('\\', '_');
-        key.replace_char('/', '_');
-        key.replace_char(':', '_');
-        key.replace_char('*', '_');
-        key.replace_char('?', '_');
-        key.replace_char('"', '_');
-        key.replace_char('<', '_');
-        key.replace_char('>', '_');
-        key.replace_char('|', '_');
-        return key;
+    // Also exported to other components, which may call from any thread
+    if (async_io_manager::instance().is_main_thread()) {
+        set_full_resolution_url(base, pfc::string8());
+    } else {
+        async_io_manager::instance().post_to_main_thread([base]() { set_full_resolution_url(base, pfc::string8()); });
     }
 }
 
@@ -3919,83 +4759,174 @@ bool artwork_manager::is_local_artwork_newer_than_cache(const pfc::string8& file
 }
 
 // JSON parsing implementations
-bool artwork_manager::parse_itunes_json(const char* artist, const char* track, const pfc::string8& json_in, pfc::string8& artwork_url) {
-    try {
-        std::string json_data;
-        json_data += json_in;
+// Smallest size tier covering the target edge length; target 0 selects the largest tier
+static unsigned pick_artwork_size_tier(unsigned target, const unsigned* tiers, size_t count) {
+    if (target == 0) return tiers[count - 1];
+    for (size_t i = 0; i < count; i++) {
+        if (tiers[i] >= target) return tiers[i];
+    }
+    return tiers[count - 1];
+}
+
+// Rewrite the "<w>x<h>" token in the last path segment of an Apple/Deezer CDN URL,
+// e.g. ".../100x100bb.jpg" or ".../1000x1000-000000-80-0-0.jpg"
+static pfc::string8 resize_cdn_artwork_url(const char* url, unsigned size) {
+    std::string s(url ? url : "");
+    size_t segment = s.find_last_of('/');
+    if (segment == std::string::npos) return pfc::string8(s.c_str());
+
+    for (size_t i = segment + 1; i < s.size(); i++) {
+        if (!isdigit((unsigned char)s[i])) continue;
+
+        size_t x_pos = i;
+        while (x_pos < s.size() && isdigit((unsigned char)s[x_pos])) x_pos++;
+        if (x_pos < s.size() && s[x_pos] == 'x') {
+            size_t end = x_pos + 1;
+            while (end < s.size() && isdigit((unsigned char)s[end])) end++;
+            if (end > x_pos + 1) {
+                std::string dims = std::to_string(size) + "x" + std::to_string(size);
+                s.replace(i, end - i, dims);
+                return pfc::string8(s.c_str());
+            }
+        }
+        i = x_pos;
+    }
+    return pfc::string8(s.c_str());
+}
 
-        json data = json::parse(json_data);
+// Discogs thumbnails carry no size token to rewrite; parse_discogs_json remembers the
+// "cover_image" of every thumbnail it selects
+static const size_t MAX_DISCOGS_COVER_URLS = 64;
+static std::mutex g_discogs_cover_mutex;
+static std::map<std::string, std::string> g_discogs_cover_urls;
 
-        if (!data.contains("resultCount") || data["resultCount"].get<int>() == 0 || !data.contains("results") || !data["results"].is_array()) {
-            return false;
+static void remember_discogs_cover_url(const std::string& thumb_url, const std::string& cover_url) {
+    std::lock_guard<std::mutex> lock(g_discogs_cover_mutex);
+    if (g_discogs_cover_urls.size() >= MAX_DISCOGS_COVER_URLS) g_discogs_cover_urls.clear();
+    g_discogs_cover_urls[thumb_url] = cover_url;
+}
+
+pfc::string8 artwork_manager::get_full_resolution_url(const char* url) {
+    if (!url || !*url) return pfc::string8();
+
+    pfc::string8 full;
+    if (strstr(url, "mzstatic.com") || strstr(url, "dzcdn.net")) {
+        // Apple and Deezer CDNs render any requested size; 1200 is the largest we use
+        full = resize_cdn_artwork_url(url, 1200);
+    } else if (strstr(url, "coverartarchive.org")) {
+        // "/front-500" -> "/front" (unbounded original)
+        full = url;
+        t_size pos = full.find_first("/front-");
+        if (pos != pfc_infinite) full.truncate(pos + 6);
+    } else if (strstr(url, "last.fm") || strstr(url, "lastfm")) {
+        // ".../i/u/300x300/<hash>.png" -> ".../i/u/<hash>.png"
+        std::string s(url);
+        size_t pos = s.find("/u/");
+        if (pos != std::string::npos) {
+            size_t next = s.find('/', pos + 3);
+            if (next != std::string::npos) s.erase(pos + 2, next - (pos + 2));
         }
+        full = s.c_str();
+    } else if (strstr(url, "discogs.com")) {
+        std::lock_guard<std::mutex> lock(g_discogs_cover_mutex);
+        auto it = g_discogs_cover_urls.find(url);
+        if (it != g_discogs_cover_urls.end()) full = it->second.c_str();
+    }
 
-        const auto& results = data["results"];
-        std::string artist_str(artist ? artist : "");
-        std::string track_str(track ? track : "");
-
-        auto extract_url = [](const json& item, pfc::string8& out_url) -> bool {
-            std::string url_str;
-            if (item.contains("artworkUrl600") && item["artworkUrl600"].is_string()) {
-                url_str = item["artworkUrl600"].get<std::string>();
-            } else if (item.contains("artworkUrl512") && item["artworkUrl512"].is_string()) {
-                url_str = item["artworkUrl512"].get<std::string>();
-            } else if (item.contains("artworkUrl100") && item["artworkUrl100"].is_string()) {
-                url_str = item["artworkUrl100"].get<std::string>();
-            } else if (item.contains("artworkUrl60") && item["artworkUrl60"].is_string()) {
-                url_str = item["artworkUrl60"].get<std::string>();
-            } else if (item.contains("artworkUrl30") && item["artworkUrl30"].is_string()) {
-                url_str = item["artworkUrl30"].get<std::string>();
-            }
+    if (full == url) return pfc::string8();
+    return full;
+}
 
-            if (url_str.empty()) return false;
+void artwork_manager::fetch_full_resolution_artwork_async(artwork_callback callback) {
+    auto download = [](const pfc::string8& full_url, artwork_callback done) {
+        if (full_url.is_empty()) {
+            artwork_result result;
+            result.success = false;
+            result.error_message = "Current artwork is already full resolution";
+            async_io_manager::instance().post_to_main_thread([done, result]() {
+                done(result);
+            });
+            return;
+        }
 
-            out_url = url_str.c_str();
-            // Upgrade resolution to 1200x1200 while preserving valid Apple CDN format
-            out_url.replace_string("100x100", "1200x1200");
-            out_url.replace_string("600x600", "1200x1200");
-            out_url.replace_string("512x512", "1200x1200");
-            out_url.replace_string("60x60", "1200x1200");
-            out_url.replace_string("30x30", "1200x1200");
+        foo_artwork::log_printf("foo_artwork: Fetching full resolution artwork: %s", full_url.c_str());
+        download_image_async(full_url.c_str(), [done, full_url](const artwork_result& res) {
+            artwork_result result = res;
+            result.url = full_url;
+            done(result);
+        });
+    };
 
-            return !out_url.is_empty() && strstr(out_url.get_ptr(), "http") == out_url.get_ptr();
-        };
+    if (!g_active_artwork_url.is_empty()) {
+        download(get_full_resolution_url(g_active_artwork_url.c_str()), callback);
+        return;
+    }
 
-        // 1. Search for exact artist + track match
-        for (const auto& item : results) {
-            std::string result_track;
-            if (item.contains("trackName") && item["trackName"].is_string()) {
-                result_track = item["trackName"].get<std::string>();
-            } else if (item.contains("collectionName") && item["collectionName"].is_string()) {
-                result_track = item["collectionName"].get<std::string>();
-            }
+    // Artwork served from the cache: the URL of the original was recorded when it was cached
+    pfc::string8 cache_key = cfg_single_file_cache ? pfc::string8("current") : g_active_cache_key;
+    if (cache_key.is_empty()) {
+        download(pfc::string8(), callback);
+        return;
+    }
+    download(get_full_resolution_url_of_cached(cache_key), callback);
+}
 
-            std::string result_artist;
-            if (item.contains("artistName") && item["artistName"].is_string()) {
-                result_artist = item["artistName"].get<std::string>();
+bool artwork_manager::parse_itunes_json(const char* artist, const char* track, const pfc::string8& json_in, pfc::string8& artwork_url, double& match_score) {
+    try {
+        enum { F_TRACK, F_COLLECTION, F_ARTIST, F_TIME, F_ART600, F_ART512, F_ART100, F_ART60, F_ART30 };
+        json_extractor extractor("results", { "trackName", "collectionName", "artistName", "trackTimeMillis",
+            "artworkUrl600", "artworkUrl512", "artworkUrl100", "artworkUrl60", "artworkUrl30" });
+
+        // Query keys are normalized once; each result is normalized once as well
+        artist_match_key artist_key(artist ? artist : "");
+        std::string track_key = normalize_for_matching(track ? track : "");
+        unsigned expected_seconds = g_expected_track_seconds.load();
+
+        // Apple's CDN renders any NxN size; stick to common tiers for better CDN cache hits
+        static const unsigned itunes_tiers[] = { 100, 200, 300, 600, 1200 };
+        unsigned itunes_size = pick_artwork_size_tier(get_target_artwork_size(), itunes_tiers, _countof(itunes_tiers));
+
+        auto extract_url = [itunes_size](const json_record& item, pfc::string8& out_url) -> bool {
+            const std::string* url_str = nullptr;
+            for (int field = F_ART600; field <= F_ART30 && !url_str; field++) {
+                url_str = item.get(field);
             }
 
-            if (!result_track.empty() && !result_artist.empty()) {
-                if (strings_match_fuzzy(result_track, track_str) && artists_match(result_artist, artist_str)) {
-                    if (extract_url(item, artwork_url)) {
-                        return true;
-                    }
-                }
-            }
-        }
+            if (!url_str || url_str->empty()) return false;
 
-        // 2. Fallback: match by artist
-        for (const auto& item : results) {
-            std::string result_artist;
-            if (item.contains("artistName") && item["artistName"].is_string()) {
-                result_artist = item["artistName"].get<std::string>();
-            }
+            // Rewrite to the panel-sized variant while preserving valid Apple CDN format
+            out_url = resize_cdn_artwork_url(url_str->c_str(), itunes_size);
 
-            if (!result_artist.empty() && artists_match(result_artist, artist_str)) {
-                if (extract_url(item, artwork_url)) {
-                    return true;
-                }
+            return !out_url.is_empty() && strstr(out_url.get_ptr(), "http") == out_url.get_ptr();
+        };
+
+        // Every result is scored and the best one wins; a perfect score cannot be beaten, so it ends the parse
+        double best_score = 0.0;
+        pfc::string8 best_url;
+        bool ok = extractor.parse(json_in.get_ptr(), json_in.get_length(), [&](const json_record& item) -> bool {
+            const std::string* result_track = item.get(F_TRACK);
+            if (!result_track) result_track = item.get(F_COLLECTION);
+            const std::string* result_artist = item.get(F_ARTIST);
+            if (!result_artist || result_artist->empty()) return true;
+
+            const std::string* collection = item.get(F_COLLECTION);
+            double score = score_candidate(artist_key, track_key, expected_seconds, *result_artist,
+                                           result_track ? *result_track : std::string(),
+                                           collection ? *collection : std::string(), ms_to_seconds(item.get(F_TIME)));
+            if (score < candidate_ranker::ACCEPT_SCORE || score <= best_score) return true;
+
+            pfc::string8 url;
+            if (extract_url(item, url)) {
+                best_url = url;
+                best_score = score;
             }
+            return best_score < 1.0;
+        });
+
+        if (!best_url.is_empty() && (ok || extractor.stopped_early())) {
+            artwork_url = best_url;
+            match_score = best_score;
+            return true;
         }
     } catch (...) {
         return false;
@@ -4004,27 +4935,31 @@ bool artwork_manager::parse_itunes_json(const char* artist, const char* track, c
     return false;
 }
 
-bool artwork_manager::parse_deezer_json(const char* artist, const char* track ,const pfc::string8& json_in, pfc::string8& artwork_url) {
+bool artwork_manager::parse_deezer_json(const char* artist, const char* track ,const pfc::string8& json_in, pfc::string8& artwork_url, double& match_score) {
     try {
-        std::string json_data;
-        json_data += json_in;
-
-        json data = json::parse(json_data);
-
-        if (!data.contains("total") || data["total"] == 0 || !data.contains("data") || !data["data"].is_array()) return false;
+        enum { F_TITLE, F_ARTIST, F_RANK, F_DURATION, F_ALBUM_TITLE, F_COVER_SMALL, F_COVER_MEDIUM, F_COVER_BIG, F_COVER_XL };
+        json_extractor extractor("data", { "title", "artist.name", "rank", "duration", "album.title",
+            "album.cover_small", "album.cover_medium", "album.cover_big", "album.cover_xl" });
+
+        // Ranking needs every result, so collect just the fields used below
+        std::vector<json_record> results;
+        if (!extractor.parse(json_in.get_ptr(), json_in.get_length(), [&results](const json_record& item) -> bool {
+                results.push_back(item);
+                return true;
+            }) || results.empty()) {
+            return false;
+        }
 
         //sort by rank to get higher ratings values first
-        std::sort(data["data"].begin(), data["data"].end(),
-            [](const json& a, const json& b) {
-                int rank_a = (a.contains("rank") && a["rank"].is_number()) ? a["rank"].get<int>() : 0;
-                int rank_b = (b.contains("rank") && b["rank"].is_number()) ? b["rank"].get<int>() : 0;
-                return rank_a > rank_b;
+        auto rank_of = [](const json_record& item) -> long long {
+            const std::string* rank = item.get(F_RANK);
+            return rank ? _atoi64(rank->c_str()) : 0;
+        };
+        std::stable_sort(results.begin(), results.end(),
+            [&rank_of](const json_record& a, const json_record& b) {
+                return rank_of(a) > rank_of(b);
             });
 
-        json s = data["data"];
-        std::string artist_str(artist ? artist : "");
-        std::string track_str(track ? track : "");
-
         auto unescape_url = [](const std::string& in_url) -> pfc::string8 {
             pfc::string8 unescaped;
             const char* src = in_url.c_str();
@@ -4041,45 +4976,69 @@ bool artwork_manager::parse_deezer_json(const char* artist, const char* track ,c
             return unescaped;
         };
 
-        // 1. Search for exact same artist track values first
-        for (const auto& item : s.items()) {
-            if (!item.value().contains("title") || !item.value().contains("artist")) continue;
-            std::string result_title = item.value()["title"].is_string() ? item.value()["title"].get<std::string>() : "";
-            std::string result_artist = (item.value()["artist"].contains("name") && item.value()["artist"]["name"].is_string()) ? item.value()["artist"]["name"].get<std::string>() : "";
-
-            if (strings_match_fuzzy(result_title, track_str) && artists_match(result_artist, artist_str)) {
-                if (item.value().contains("album") && item.value()["album"].is_object()) {
-                    if (item.value()["album"].contains("cover_xl") && item.value()["album"]["cover_xl"].is_string()) {
-                        artwork_url = unescape_url(item.value()["album"]["cover_xl"].get<std::string>());
-                        artwork_url = artwork_url.replace("1000x1000", "1200x1200");
-                        return true;
-                    }
-                    if (item.value()["album"].contains("cover_big") && item.value()["album"]["cover_big"].is_string()) {
-                        artwork_url = unescape_url(item.value()["album"]["cover_big"].get<std::string>());
+        // Deezer album covers: cover_small 56, cover_medium 250, cover_big 500, cover_xl 1000 px.
+        // Pick the smallest one covering the panel; full resolution upgrades cover_xl to 1200.
+        unsigned target_size = get_target_artwork_size();
+        auto select_cover = [&unescape_url, target_size](const json_record& item, pfc::string8& out_url) -> bool {
+            static const struct { int field; unsigned size; } covers[] = {
+                { F_COVER_SMALL, 56 }, { F_COVER_MEDIUM, 250 }, { F_COVER_BIG, 500 }, { F_COVER_XL, 1000 }
+            };
+
+            if (target_size > 0 && target_size <= 1000) {
+                for (const auto& cover : covers) {
+                    const std::string* url = item.get(cover.field);
+                    if (cover.size >= target_size && url) {
+                        out_url = unescape_url(*url);
                         return true;
                     }
                 }
             }
-        }
 
-        // 2. Fallback: first result matching artist
-        for (const auto& item : s.items()) {
-            if (!item.value().contains("artist")) continue;
-            std::string result_artist = (item.value()["artist"].contains("name") && item.value()["artist"]["name"].is_string()) ? item.value()["artist"]["name"].get<std::string>() : "";
-            if (!artists_match(result_artist, artist_str)) continue;
+            if (const std::string* xl = item.get(F_COVER_XL)) {
+                out_url = unescape_url(*xl);
+                out_url = out_url.replace("1000x1000", "1200x1200");
+                return true;
+            }
+            if (const std::string* big = item.get(F_COVER_BIG)) {
+                out_url = unescape_url(*big);
+                return true;
+            }
+            return false;
+        };
+
+        // Best score wins; on equal scores the higher ranked result comes first and is kept.
+        // Deezer reports duration in seconds.
+        artist_match_key artist_key(artist ? artist : "");
+        std::string track_key = normalize_for_matching(track ? track : "");
+        unsigned expected_seconds = g_expected_track_seconds.load();
 
-            if (item.value().contains("album") && item.value()["album"].is_object()) {
-                if (item.value()["album"].contains("cover_xl") && item.value()["album"]["cover_xl"].is_string()) {
-                    artwork_url = unescape_url(item.value()["album"]["cover_xl"].get<std::string>());
-                    artwork_url = artwork_url.replace("1000x1000", "1200x1200");
-                    return true;
-                }
-                if (item.value()["album"].contains("cover_big") && item.value()["album"]["cover_big"].is_string()) {
-                    artwork_url = unescape_url(item.value()["album"]["cover_big"].get<std::string>());
-                    return true;
-                }
+        double best_score = 0.0;
+        pfc::string8 best_url;
+        for (const auto& item : results) {
+            const std::string* result_artist = item.get(F_ARTIST);
+            if (!result_artist) continue;
+
+            const std::string* result_title = item.get(F_TITLE);
+            const std::string* album_title = item.get(F_ALBUM_TITLE);
+            const std::string* duration = item.get(F_DURATION);
+            double score = score_candidate(artist_key, track_key, expected_seconds, *result_artist,
+                                           result_title ? *result_title : std::string(),
+                                           album_title ? *album_title : std::string(),
+                                           duration ? (unsigned)atoi(duration->c_str()) : 0);
+            if (score < candidate_ranker::ACCEPT_SCORE || score <= best_score) continue;
+
+            pfc::string8 url;
+            if (select_cover(item, url)) {
+                best_url = url;
+                best_score = score;
             }
         }
+
+        if (!best_url.is_empty()) {
+            artwork_url = best_url;
+            match_score = best_score;
+            return true;
+        }
     } catch (...) {
         return false;
     }
@@ -4087,38 +5046,61 @@ bool artwork_manager::parse_deezer_json(const char* artist, const char* track ,c
     return false;
 }
 
-bool artwork_manager::parse_lastfm_json(const pfc::string8& json_in, pfc::string8& artwork_url) {
+bool artwork_manager::parse_lastfm_json(const char* artist, const char* track, const pfc::string8& json_in, pfc::string8& artwork_url, double& match_score) {
     try {
-        std::string json_data;
-        json_data += json_in;
-
-        json data = json::parse(json_data);
-
-        if (data.contains("message") && data["message"] == "Track not found") return false;
-        if (!data.contains("track") || !data["track"].contains("album") || !data["track"]["album"].contains("image") || !data["track"]["album"]["image"].is_array()) {
+        // "Track not found" errors carry no track.album.image array and yield no records
+        enum { F_SIZE, F_TEXT };
+        enum { H_NAME, H_ARTIST, H_DURATION, H_ALBUM };
+        json_extractor extractor("track.album.image", { "size", "#text" },
+            { "track.name", "track.artist.name", "track.duration", "track.album.title" });
+
+        // Last.fm size tiers: large 174 px, extralarge 300 px; stripping the size
+        // segment from the URL ("u/300x300/") yields the original upload
+        unsigned target_size = get_target_artwork_size();
+        std::string large_url, extralarge_url;
+        if (!extractor.parse(json_in.get_ptr(), json_in.get_length(), [&](const json_record& item) -> bool {
+                const std::string* size = item.get(F_SIZE);
+                const std::string* text = item.get(F_TEXT);
+                if (!size || !text) return true;
+                if (*size == "extralarge") extralarge_url = *text;
+                else if (*size == "large") large_url = *text;
+                return true;
+            })) {
             return false;
         }
 
-        json s = data["track"]["album"]["image"];
+        // track.getinfo answers with a single track, possibly autocorrected to a different one
+        const json_record& info = extractor.header();
+        const std::string* result_artist = info.get(H_ARTIST);
+        if (result_artist) {
+            const std::string* result_name = info.get(H_NAME);
+            const std::string* album_title = info.get(H_ALBUM);
+            match_score = score_candidate(artist_match_key(artist ? artist : ""), normalize_for_matching(track ? track : ""),
+                                          g_expected_track_seconds.load(), *result_artist,
+                                          result_name ? *result_name : std::string(),
+                                          album_title ? *album_title : std::string(), ms_to_seconds(info.get(H_DURATION)));
+            if (match_score < candidate_ranker::ACCEPT_SCORE) return false;
+        }
 
-        for (const auto& item : s.items()) {
-            if (item.value().contains("size") && item.value()["size"].is_string() && item.value()["size"].get<std::string>() == "extralarge") {
-                if (item.value().contains("#text") && item.value()["#text"].is_string()) {
-                    artwork_url = item.value()["#text"].get<std::string>().c_str();
-                    artwork_url = artwork_url.replace("u/300x300", "u/");
-                    return true;
-                }
-            }
+        if (target_size > 0 && target_size <= 174 && !large_url.empty()) {
+            artwork_url = large_url.c_str();
+            return true;
+        }
+        if (target_size > 0 && target_size <= 300 && !extralarge_url.empty()) {
+            artwork_url = extralarge_url.c_str();
+            return true;
         }
 
-        for (const auto& item : s.items()) {
-            if (item.value().contains("size") && item.value()["size"].is_string() && item.value()["size"].get<std::string>() == "large") {
-                if (item.value().contains("#text") && item.value()["#text"].is_string()) {
-                    artwork_url = item.value()["#text"].get<std::string>().c_str();
-                    artwork_url = artwork_url.replace("u/174s", "u/");
-                    return true;
-                }
-            }
+        if (!extralarge_url.empty()) {
+            artwork_url = extralarge_url.c_str();
+            artwork_url = artwork_url.replace("u/300x300", "u/");
+            return true;
+        }
+
+        if (!large_url.empty()) {
+            artwork_url = large_url.c_str();
+            artwork_url = artwork_url.replace("u/174s", "u/");
+            return true;
         }
     } catch (...) {
         return false;
@@ -4127,62 +5109,70 @@ bool artwork_manager::parse_lastfm_json(const pfc::string8& json_in, pfc::string
     return false;
 }
 
-bool artwork_manager::parse_discogs_json(const char* artist, const char* track, const pfc::string8& json_in, pfc::string8& artwork_url) {
+bool artwork_manager::parse_discogs_json(const char* artist, const char* track, const pfc::string8& json_in, pfc::string8& artwork_url, double& match_score) {
     try {
-        std::string json_data;
-        json_data += json_in;
-
-        json data = json::parse(json_data);
-
-        if (data.contains("pagination") && data["pagination"].contains("items") && data["pagination"]["items"].get<int>() == 0) return false;
-        if (!data.contains("results") || !data["results"].is_array()) return false;
-
-        json s = data["results"];
-        std::string artist_str(artist ? artist : "");
-
-        std::string artist_title;
-        artist_title += (artist ? artist : "");
-        artist_title += " - ";
-        artist_title += (track ? track : "");
-
-        for (const auto& item : s.items()) {
-            if (!item.value().contains("title") || !item.value()["title"].is_string()) continue;
-            std::string result_title = item.value()["title"].get<std::string>();
-            if (strings_match_fuzzy(result_title, artist_title)) {
-                if (item.value().contains("cover_image") && item.value()["cover_image"].is_string()) {
-                    artwork_url = item.value()["cover_image"].get<std::string>().c_str();
-                    return true;
-                } else if (item.value().contains("thumb") && item.value()["thumb"].is_string()) {
-                    artwork_url = item.value()["thumb"].get<std::string>().c_str();
-                    return true;
-                }
+        enum { F_TITLE, F_THUMB, F_COVER };
+        json_extractor extractor("results", { "title", "thumb", "cover_image" });
+
+        artist_match_key artist_key(artist ? artist : "");
+        std::string track_key = normalize_for_matching(track ? track : "");
+
+        // Discogs "thumb" is a 150 px preview; "cover_image" is the full image
+        unsigned target_size = get_target_artwork_size();
+        bool prefer_thumb = target_size > 0 && target_size <= 150;
+        auto select_image = [prefer_thumb](const json_record& item, pfc::string8& out_url) -> bool {
+            const std::string* cover = item.get(F_COVER);
+            const std::string* thumb = item.get(F_THUMB);
+            if (thumb && (prefer_thumb || !cover)) {
+                out_url = thumb->c_str();
+                if (cover) remember_discogs_cover_url(*thumb, *cover);
+                return true;
             }
-        }
-
-        for (const auto& item : s.items()) {
-            if (!item.value().contains("title") || !item.value()["title"].is_string()) continue;
-            std::string result_title = item.value()["title"].get<std::string>();
-
-            bool artist_matches = false;
-            std::string artist_stripped = strip_the_prefix(artist_str);
-            std::string title_stripped = strip_the_prefix(result_title);
+            if (cover) {
+                out_url = cover->c_str();
+                return true;
+            }
+            return false;
+        };
 
-            if (result_title.size() >= artist_str.size()) {
-                artist_matches = strings_equal_ignore_case(result_title.substr(0, artist_str.size()), artist_str);
+        // Release search results are titled "Artist - Release"; the release title is both the
+        // title to match and the release to penalize. Discogs reports no track lengths here.
+        double best_score = 0.0;
+        pfc::string8 best_url;
+        bool ok = extractor.parse(json_in.get_ptr(), json_in.get_length(), [&](const json_record& item) -> bool {
+            const std::string* title = item.get(F_TITLE);
+            if (!title) return true;
+
+            std::string result_artist = *title;
+            std::string result_release;
+            size_t separator = title->find(" - ");
+            if (separator != std::string::npos) {
+                result_artist = title->substr(0, separator);
+                result_release = title->substr(separator + 3);
             }
-            if (!artist_matches && title_stripped.size() >= artist_stripped.size()) {
-                artist_matches = strings_equal_ignore_case(title_stripped.substr(0, artist_stripped.size()), artist_stripped);
+
+            // Artists sharing a name are disambiguated as "Name (2)"
+            size_t paren = result_artist.rfind(" (");
+            if (paren != std::string::npos && result_artist.back() == ')' &&
+                result_artist.find_first_not_of("0123456789", paren + 2) == result_artist.size() - 1) {
+                result_artist.erase(paren);
             }
 
-            if (!artist_matches) continue;
+            double score = score_candidate(artist_key, track_key, 0, result_artist, result_release, result_release, 0);
+            if (score < candidate_ranker::ACCEPT_SCORE || score <= best_score) return true;
 
-            if (item.value().contains("cover_image") && item.value()["cover_image"].is_string()) {
-                artwork_url = item.value()["cover_image"].get<std::string>().c_str();
-                return true;
-            } else if (item.value().contains("thumb") && item.value()["thumb"].is_string()) {
-                artwork_url = item.value()["thumb"].get<std::string>().c_str();
-                return true;
+            pfc::string8 url;
+            if (select_image(item, url)) {
+                best_url = url;
+                best_score = score;
             }
+            return best_score < 1.0;
+        });
+
+        if (!best_url.is_empty() && (ok || extractor.stopped_early())) {
+            artwork_url = best_url;
+            match_score = best_score;
+            return true;
         }
     } catch (...) {
         return false;
@@ -4209,7 +5199,7 @@ void artwork_manager::search_musicbrainz_api_async(const char* artist, const cha
     pfc::string8 artist_str = artist;
     pfc::string8 track_str = track;
 
-    async_io_manager::instance().http_get_async(url, [callback, artist_str](bool success, const pfc::string8& response, const pfc::string8& error) {
+    async_io_manager::instance().http_get_async(url, [callback, artist_str, track_str](bool success, const pfc::string8& response, const pfc::string8& error) {
         if (!success) {
             artwork_result result;
             result.success = false;
@@ -4218,9 +5208,10 @@ void artwork_manager::search_musicbrainz_api_async(const char* artist, const cha
             return;
         }
 
-        // Parse JSON response to collect release IDs (filter by artist)
+        // Parse JSON response to collect release IDs, best matching release first
         std::vector<pfc::string8> release_ids;
-        if (!parse_musicbrainz_json(response, release_ids, artist_str.c_str()) || release_ids.empty()) {
+        std::vector<double> release_scores;
+        if (!parse_musicbrainz_json(response, release_ids, release_scores, artist_str.c_str(), track_str.c_str()) || release_ids.empty()) {
             artwork_result result;
             result.success = false;
             result.error_message = "No valid release IDs found in MusicBrainz response";
@@ -4232,7 +5223,7 @@ void artwork_manager::search_musicbrainz_api_async(const char* artist, const cha
         std::shared_ptr<std::function<void(size_t)>> try_release =
             std::make_shared<std::function<void(size_t)>>();
 
-        *try_release = [release_ids, callback, try_release](size_t index) {
+        *try_release = [release_ids, release_scores, callback, try_release](size_t index) {
             if (index >= release_ids.size()) {
                 // Exhausted all release IDs
                 artwork_result result;
@@ -4242,23 +5233,36 @@ void artwork_manager::search_musicbrainz_api_async(const char* artist, const cha
                 return;
             }
 
+            // Cover Art Archive serves 250/500/1200 px thumbnails next to the unbounded original
             pfc::string8 coverart_url = "http://coverartarchive.org/release/";
             coverart_url << release_ids[index] << "/front";
+            unsigned target_size = get_target_artwork_size();
+            if (target_size > 0 && target_size <= 1200) {
+                coverart_url << (target_size <= 250 ? "-250" : target_size <= 500 ? "-500" : "-1200");
+            }
 
             async_io_manager::instance().http_get_binary_async(coverart_url,
-                [callback, try_release, index, release_ids, coverart_url](bool success, const pfc::array_t<t_uint8>& data, const pfc::string8& error) {
+                [callback, try_release, index, release_ids, release_scores, coverart_url](bool success, const image_buffer& data, const pfc::string8& error) {
                     if (success && data.get_size() > 0) {
                         bool is_valid_image = is_valid_image_data(data.get_ptr(), data.get_size());
                         pfc::string8 mime_type = detect_mime_type(data.get_ptr(), data.get_size());
 
-                        if (is_valid_image && data.get_size() > 512) {
+                        if (is_valid_image) {
                             artwork_result result;
                             result.success = true;
                             result.data = data;
                             result.mime_type = mime_type;
                             result.source = "MusicBrainz";
-                            callback(result);
-                            return;
+                            result.url = coverart_url;
+                            result.match_score = release_scores[index];
+
+                            // Skip placeholder/thumbnail releases and try the next release instead
+                            unsigned min_size = (unsigned)(cfg_min_artwork_size > 0 ? (int)cfg_min_artwork_size : 0);
+                            if (check_artwork_dimensions(result, min_size)) {
+                                callback(result);
+                                return;
+                            }
+                            foo_artwork::log_printf("foo_artwork: MusicBrainz release %s rejected: %s", release_ids[index].c_str(), result.error_message.c_str());
                         }
                     }
                     // Try next release ID
@@ -4272,48 +5276,59 @@ void artwork_manager::search_musicbrainz_api_async(const char* artist, const cha
 }
 
 
-bool artwork_manager::parse_musicbrainz_json(const pfc::string8& json_in, std::vector<pfc::string8>& release_ids, const char* artist) {
+bool artwork_manager::parse_musicbrainz_json(const pfc::string8& json_in, std::vector<pfc::string8>& release_ids, std::vector<double>& release_scores, const char* artist, const char* track) {
     try {
-        std::string json_data(json_in.c_str());
-        json data = json::parse(json_data);
-
-        if (!data.contains("recordings") || data["count"].get<int>() == 0)
-            return false;
-
-        std::string artist_str(artist);
-
-        for (const auto& rec : data["recordings"]) {
-            // Check if recording's artist-credit matches the requested artist (case-insensitive)
-            bool artist_matches = false;
-            if (rec.contains("artist-credit")) {
-                for (const auto& ac : rec["artist-credit"]) {
-                    if (ac.contains("name") && ac["name"].is_string()) {
-                        std::string credit_name = ac["name"].get<std::string>();
-                        if (artists_match(credit_name, artist_str)) {
-                            artist_matches = true;
-                            break;
-                        }
-                    }
-                    // Also check nested artist object
-                    if (ac.contains("artist") && ac["artist"].contains("name")) {
-                        std::string nested_name = ac["artist"]["name"].get<std::string>();
-                        if (artists_match(nested_name, artist_str)) {
-                            artist_matches = true;
-                            break;
-                        }
-                    }
-                }
-            }
+        enum { F_TITLE, F_LENGTH, F_CREDIT_NAME, F_CREDIT_ARTIST_NAME, F_RELEASE_ID, F_RELEASE_TITLE };
+        json_extractor extractor("recordings", { "title", "length", "artist-credit[].name", "artist-credit[].artist.name",
+            "releases[].id", "releases[].title" });
+
+        artist_match_key artist_key(artist ? artist : "");
+        std::string track_key = normalize_for_matching(track ? track : "");
+        unsigned expected_seconds = g_expected_track_seconds.load();
+
+        std::vector<std::pair<double, pfc::string8>> candidates;
+        bool ok = extractor.parse(json_in.get_ptr(), json_in.get_length(), [&](const json_record& rec) -> bool {
+            // Score the recording against the best matching name in its artist-credit (or nested artist object)
+            const std::string* title = rec.get(F_TITLE);
+            std::string recording_title = title ? *title : std::string();
+            unsigned seconds = ms_to_seconds(rec.get(F_LENGTH));
+
+            double recording_score = 0.0;
+            auto check_credit = [&](const std::string& credit_name) {
+                recording_score = (std::max)(recording_score,
+                    score_candidate(artist_key, track_key, expected_seconds, credit_name, recording_title, std::string(), seconds));
+            };
+            rec.for_each(F_CREDIT_NAME, check_credit);
+            rec.for_each(F_CREDIT_ARTIST_NAME, check_credit);
 
             // Skip recordings from different artists to avoid "Best Of" compilations
-            if (!artist_matches) continue;
-
-            if (!rec.contains("releases")) continue;
-            for (const auto& rel : rec["releases"]) {
-                if (rel.contains("id") && rel["id"].is_string()) {
-                    release_ids.push_back(rel["id"].get<std::string>().c_str());
+            if (recording_score < candidate_ranker::ACCEPT_SCORE) return true;
+
+            // Every release of the recording gets its own score, so the original album
+            // is tried before compilations and karaoke releases carrying the same recording.
+            // Id and title are taken from the same release object; either may be missing.
+            rec.for_each_pair(F_RELEASE_ID, F_RELEASE_TITLE, [&](const std::string& id, const std::string* release_title) {
+                double score = recording_score;
+                if (release_title) {
+                    score *= candidate_ranker::release_factor(normalize_for_matching(*release_title), track_key);
                 }
-            }
+                if (score >= candidate_ranker::ACCEPT_SCORE) candidates.emplace_back(score, id.c_str());
+            });
+            return true;
+        });
+        if (!ok) {
+            foo_artwork::log_info("MusicBrainz JSON parse error");
+            return false;
+        }
+
+        // Best first; ties keep MusicBrainz's own search order
+        std::stable_sort(candidates.begin(), candidates.end(),
+            [](const std::pair<double, pfc::string8>& a, const std::pair<double, pfc::string8>& b) {
+                return a.first > b.first;
+            });
+        for (const auto& candidate : candidates) {
+            release_scores.push_back(candidate.first);
+            release_ids.push_back(candidate.second);
         }
         return !release_ids.empty();
     }
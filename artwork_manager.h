@@ -13,13 +13,17 @@
 class artwork_manager {
 public:
     struct artwork_result {
-        pfc::array_t<t_uint8> data;
+        image_buffer data;  // Shared, immutable image bytes - copying a result does not copy the image
         pfc::string8 mime_type;
         bool success;
         pfc::string8 error_message;
         pfc::string8 source;  // Source of the artwork (e.g., "iTunes", "Deezer", "Local file")
+        unsigned width;   // Pixel dimensions from the image header (0 if unknown)
+        unsigned height;
+        pfc::string8 url;  // Download URL for online artwork (empty for cache/local)
+        double match_score;  // How well the provider's result matched the track (candidate_ranker), 1.0 if not ranked
         
-        artwork_result() : success(false) {}
+        artwork_result() : success(false), width(0), height(0), match_score(1.0) {}
     };
 
     // Callback for async artwork retrieval
@@ -53,6 +57,8 @@ public:
     static void probe_external_stream_api(const pfc::string8& stream_url, uint64_t session_token);
     static void poll_external_stream_api(const pfc::string8& endpoint_url, uint64_t session_token);
     static void search_broadcast_artwork_async(const pfc::string8& cover_url, const pfc::string8& cache_key, artwork_callback callback);
+    // Download artwork announced for an upcoming song so search_broadcast_artwork_async can serve it from memory
+    static void prefetch_broadcast_artwork_async(const pfc::string8& cover_url, const pfc::string8& cache_key);
 
     // Initialize/shutdown async I/O system & playback lifecycle
     static void initialize();
@@ -66,6 +72,17 @@ public:
 
     // Utility functions
     static pfc::string8 detect_mime_type(const t_uint8* data, size_t size);
+    static pfc::string8 url_encode(const char* str);
+
+    // Right-sized artwork downloads
+    // Panels report their largest edge in device pixels (0 when destroyed)
+    static void set_panel_artwork_size(const void* panel, unsigned pixels);
+    // Edge length provider URLs should cover, 0 = full resolution
+    static unsigned get_target_artwork_size();
+    // Full resolution variant of a provider URL, empty if none is known
+    static pfc::string8 get_full_resolution_url(const char* url);
+    // Download the full resolution variant of the current artwork (viewer/saving)
+    static void fetch_full_resolution_artwork_async(artwork_callback callback);
     
 private:
     // Internal async pipeline methods
@@ -79,7 +96,8 @@ private:
     static void search_local_async(const pfc::string8& file_path, const pfc::string8& cache_key, metadb_handle_ptr track, artwork_callback callback);
     static void search_apis_async(const pfc::string8& artist, const pfc::string8& album, const pfc::string8& cache_key, artwork_callback callback);
     static void start_initial_stream_metadata_monitor(const pfc::string8& stream_url);
-    static void search_apis_by_priority(const pfc::string8& artist, const pfc::string8& track, const pfc::string8& cache_key, artwork_callback callback, const std::vector<ApiType>& api_order, size_t index, bool force_enable_apis = false);
+    // report_only: hand the result to callback without caching it or making it the active artwork
+    static void search_apis_by_priority(const pfc::string8& artist, const pfc::string8& track, const pfc::string8& cache_key, artwork_callback callback, const std::vector<ApiType>& api_order, size_t index, bool force_enable_apis = false, bool report_only = false);
     
     // Async local artwork search (uses SDK only)
     static void find_local_artwork_async(metadb_handle_ptr track, artwork_callback callback);
@@ -97,27 +115,29 @@ private:
     static void download_image_async(const char* url, artwork_callback callback);
     
     // Helper functions for async operations
-    static void validate_and_complete_result(const pfc::array_t<t_uint8>& data, artwork_callback callback);
+    static void validate_and_complete_result(const image_buffer& data, artwork_callback callback);
     
     // Utility functions (private)
     static bool is_valid_image_data(const t_uint8* data, size_t size);
     static bool is_supported_image_format(const pfc::string8& mime_type);
+    static bool check_artwork_dimensions(artwork_result& result, unsigned min_size);
     static pfc::string8 get_file_directory(const char* file_path);
-    static pfc::string8 url_encode(const char* str);
     static bool is_local_artwork_newer_than_cache(const pfc::string8& file_path, const pfc::string8& cache_key);
 
 public:
     static pfc::string8 generate_cache_key(const char* artist, const char* track);
     static pfc::string8 generate_cache_key_for_track(metadb_handle_ptr track);
+    // Remove the artwork cached under cache_key in every size tier, with its full resolution URL
+    static void remove_cached_artwork(const pfc::string8& cache_key);
 
 private:
     
     // JSON parsing functions
-    static bool parse_itunes_json(const char* artist, const char* track, const pfc::string8& json, pfc::string8& artwork_url);
-    static bool parse_deezer_json(const char* artist, const char* track, const pfc::string8& json, pfc::string8& artwork_url);
-    static bool parse_lastfm_json(const pfc::string8& json, pfc::string8& artwork_url);
-    static bool parse_discogs_json(const char* artist, const char* track, const pfc::string8& json, pfc::string8& artwork_url);
-    static bool parse_musicbrainz_json(const pfc::string8& json, std::vector<pfc::string8>& release_ids, const char* artist);
+    static bool parse_itunes_json(const char* artist, const char* track, const pfc::string8& json, pfc::string8& artwork_url, double& match_score);
+    static bool parse_deezer_json(const char* artist, const char* track, const pfc::string8& json, pfc::string8& artwork_url, double& match_score);
+    static bool parse_lastfm_json(const char* artist, const char* track, const pfc::string8& json, pfc::string8& artwork_url, double& match_score);
+    static bool parse_discogs_json(const char* artist, const char* track, const pfc::string8& json, pfc::string8& artwork_url, double& match_score);
+    static bool parse_musicbrainz_json(const pfc::string8& json, std::vector<pfc::string8>& release_ids, std::vector<double>& release_scores, const char* artist, const char* track);
     
     // Initialization flag
     static std::atomic<bool> initialized_;
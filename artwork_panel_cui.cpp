@@ -49,6 +49,7 @@
 #include "artwork_viewer_popup.h"
 #include "metadata_cleaner.h"
 #include "artwork_manager.h"
+#include "artwork_events.h"
 
 // Include necessary foobar2000 SDK headers for artwork and playback callbacks
 #include "columns_ui/foobar2000/SDK/album_art.h"
@@ -84,12 +85,6 @@ extern cfg_string cfg_logos_folder;
 extern cfg_bool cfg_clear_panel_when_not_playing;
 extern cfg_bool cfg_use_noart_image;
 
-// Access to main component's artwork bitmap
-extern HBITMAP get_main_component_artwork_bitmap();
-
-// Shared bitmap from standalone search
-extern HBITMAP g_shared_artwork_bitmap;
-
 // Logo loading functions (declared in sdk_main.cpp)
 
 extern pfc::string8 extract_domain_from_stream_url(metadb_handle_ptr track);
@@ -110,52 +105,6 @@ extern void trigger_main_component_search(metadb_handle_ptr track);
 extern void trigger_main_component_search_with_metadata(const std::string& artist, const std::string& title);
 extern void trigger_main_component_local_search(metadb_handle_ptr track);
 
-//=============================================================================
-// Event-Driven Artwork System (Forward Declarations)
-//=============================================================================
-
-// Artwork event types
-enum class ArtworkEventType {
-    ARTWORK_LOADED,     // New artwork loaded successfully
-    ARTWORK_LOADING,    // Search started
-    ARTWORK_FAILED,     // Search failed
-    ARTWORK_CLEARED     // Artwork cleared
-};
-
-// Artwork event data
-struct ArtworkEvent {
-    ArtworkEventType type;
-    HBITMAP bitmap;
-    std::string source;
-    std::string artist;
-    std::string title;
-    
-    ArtworkEvent(ArtworkEventType t, HBITMAP bmp = nullptr, const std::string& src = "", 
-                 const std::string& art = "", const std::string& ttl = "")
-        : type(t), bitmap(bmp), source(src), artist(art), title(ttl) {}
-};
-
-// Artwork event listener interface
-class IArtworkEventListener {
-public:
-    virtual ~IArtworkEventListener() = default;
-    virtual void on_artwork_event(const ArtworkEvent& event) = 0;
-};
-
-// Forward declare the event manager (implemented in main component)
-class ArtworkEventManager {
-public:
-    static ArtworkEventManager& get();
-    void subscribe(IArtworkEventListener* listener);
-    void unsubscribe(IArtworkEventListener* listener);
-    void notify(const ArtworkEvent& event);
-};
-
-// External references to event manager methods (defined in sdk_main.cpp)
-extern ArtworkEventManager& get_artwork_event_manager();
-extern void subscribe_to_artwork_events(IArtworkEventListener* listener);
-extern void unsubscribe_from_artwork_events(IArtworkEventListener* listener);
-
 //=============================================================================
 // CUI Artwork Panel Class Definition - Full Implementation
 //=============================================================================
@@ -264,8 +213,9 @@ private:
     BYTE m_download_fade_alpha;
     UINT_PTR m_download_fade_timer_id;
 
-    // Event-driven artwork system (replaces polling)
-    HBITMAP m_last_event_bitmap;
+    // Event-driven artwork system (replaces polling). Holding the image keeps its
+    // handle from being reused, so comparing against it is a safe dedup check.
+    shared_hbitmap m_last_event_image;
     
     // Container window message handling (used by container_uie_window_v3)
     // Note: LRESULT on_message() is already declared in public section
@@ -489,7 +439,6 @@ CUIArtworkPanel::CUIArtworkPanel()
     , m_osd_slide_offset(OSD_SLIDE_DISTANCE)
     , m_osd_timer_id(0)
     , m_osd_visible(false)
-    , m_last_event_bitmap(nullptr)
     , m_artwork_stream(nullptr)
     , m_scaled_gdi_bitmap(NULL)
     , m_download_fade_alpha(0)
@@ -607,6 +556,8 @@ LRESULT CUIArtworkPanel::on_message(HWND wnd, UINT msg, WPARAM wParam, LPARAM lP
         }
         // Note: No artwork polling timer to stop - using event-driven system
         
+        artwork_manager::set_panel_artwork_size(this, 0);
+
         // Unregister callbacks
         now_playing_album_art_notify_manager::get()->remove(this);
         play_callback_manager::get()->unregister_callback(this);
@@ -681,12 +632,18 @@ LRESULT CUIArtworkPanel::on_message(HWND wnd, UINT msg, WPARAM wParam, LPARAM lP
         return 0;
     }
 
-    case WM_SIZE:
+    case WM_SIZE: {
+        // Client size is in device pixels (DPI aware host), so this already includes the DPI scale
+        RECT size_rect;
+        GetClientRect(m_hWnd, &size_rect);
+        artwork_manager::set_panel_artwork_size(this, (unsigned)(std::max)(size_rect.right, size_rect.bottom));
+
         // Resize artwork to fit new window size
         resize_artwork_to_fit();
         // Use RedrawWindow for flicker-free resizing
         RedrawWindow(m_hWnd, NULL, NULL, RDW_INVALIDATE | RDW_UPDATENOW | RDW_NOCHILDREN);
         return 0;  // Prevent default processing
+    }
         
     case WM_ERASEBKGND:
         // Always return 1 to prevent background erasing (causes flicker)
@@ -781,24 +738,20 @@ LRESULT CUIArtworkPanel::on_message(HWND wnd, UINT msg, WPARAM wParam, LPARAM lP
         }
         break;
         
-    case WM_USER + 10: // Artwork event update (from background thread)
+    case WM_USER + 10: // Artwork loaded event (sent by on_artwork_event, lParam = const ArtworkEvent*)
         {
-            HBITMAP bitmap = (HBITMAP)wParam;
-            std::string* source_ptr = (std::string*)lParam;
-
-            // Extract the source string from the message
-            std::string artwork_source = source_ptr ? *source_ptr : "";
-
-            // Clean up the allocated source string
-            if (source_ptr) {
-                delete source_ptr;
+            const ArtworkEvent* event = (const ArtworkEvent*)lParam;
+            if (!event || !event->image) {
+                break;
             }
+            HBITMAP bitmap = event->bitmap;
+            std::string artwork_source = event->source;
 
-            // Dedup check and cancel fallback timer (safe on main thread)
-            if (bitmap == m_last_event_bitmap) {
+            // Dedup check and cancel fallback timer
+            if (event->image == m_last_event_image) {
                 break; // Already processed this bitmap
             }
-            m_last_event_bitmap = bitmap;
+            m_last_event_image = event->image;
             KillTimer(m_hWnd, 100); // Cancel fallback timer since artwork was found
 
             // PRIORITY CHECK: Don't let API results override tagged artwork, only overide when radio
@@ -945,10 +898,6 @@ LRESULT CUIArtworkPanel::on_message(HWND wnd, UINT msg, WPARAM wParam, LPARAM lP
         }
         break;
 
-    case WM_USER + 12: // Artwork cleared — reset dedup state on main thread
-        m_last_event_bitmap = nullptr;
-        break;
-
     case WM_MOUSEMOVE:
     {
         if (!m_mouse_hovering) {
@@ -1107,11 +1056,11 @@ void CUIArtworkPanel::on_album_art(album_art_data::ptr data) noexcept {
                     
                     if (is_local_file) {
                         // Check if main component already found local artwork
-                        HBITMAP main_bitmap = get_main_component_artwork_bitmap();
-                        if (main_bitmap) {
+                        shared_hbitmap main_image = get_main_component_artwork_image();
+                        if (main_image) {
                             should_prefer_local = true;
                             
-                            if (copy_bitmap_from_main_component(main_bitmap)) {
+                            if (copy_bitmap_from_main_component(main_image.get())) {
                                 m_artwork_source = "Local file";
                                 // No OSD for local files - they should load silently
                                 InvalidateRect(m_hWnd, NULL, FALSE);
@@ -1259,11 +1208,11 @@ void CUIArtworkPanel::on_playback_new_track(metadb_handle_ptr p_track) {
         }
         
         // Check if main component's artwork manager has artwork for this track
-        HBITMAP main_bitmap = get_main_component_artwork_bitmap();
+        shared_hbitmap main_image = get_main_component_artwork_image();
         
-        if (main_bitmap) {
-            if (copy_bitmap_from_main_component(main_bitmap)) {
-                m_last_event_bitmap = main_bitmap;
+        if (main_image) {
+            if (copy_bitmap_from_main_component(main_image.get())) {
+                m_last_event_image = main_image;
                 m_artwork_source = "Local file";
                 // No OSD for local files - they should load silently
                 InvalidateRect(m_hWnd, NULL, FALSE);
@@ -2107,23 +2056,13 @@ void CUIArtworkPanel::cleanup_gdiplus() {
 void CUIArtworkPanel::on_artwork_event(const ArtworkEvent& event) {
     if (!m_hWnd) return;
 
-    // THREAD SAFETY: This event handler can be called from background threads
-    // We must NOT directly call UI functions like InvalidateRect or copy_bitmap_from_main_component
-    // Instead, post a message to the main thread to handle the update
-
+    // Events are delivered on the main thread, already coalesced, so the window
+    // handlers can run directly. SendMessage keeps the event (and its image)
+    // alive for the whole handler.
     switch (event.type) {
         case ArtworkEventType::ARTWORK_LOADED:
-            if (event.bitmap) {
-                // Pass the source string through the message to avoid race conditions
-                // Allocate a copy of the source string that the main thread will free
-                std::string* source_copy = new std::string(event.source);
-
-                // Post message to main thread to handle the UI update safely
-                // The main thread handler will do KillTimer, m_last_event_bitmap update, etc.
-                // wParam = bitmap, lParam = source string pointer
-                if (!PostMessage(m_hWnd, WM_USER + 10, (WPARAM)event.bitmap, (LPARAM)source_copy)) {
-                    delete source_copy;
-                }
+            if (event.image) {
+                SendMessage(m_hWnd, WM_USER + 10, 0, (LPARAM)&event);
             }
             break;
 
@@ -2132,22 +2071,12 @@ void CUIArtworkPanel::on_artwork_event(const ArtworkEvent& event) {
             break;
 
         case ArtworkEventType::ARTWORK_FAILED:
-            {
-                // THREAD SAFETY: Post message to main thread to handle -noart fallback
-                // Cannot access foobar2000 APIs or UI functions from background thread
-                if (m_hWnd) {
-                    PostMessage(m_hWnd, WM_USER + 11, 0, 0); // WM_USER + 11 for -noart fallback
-                }
-
-                // Keep previous artwork visible - don't clear on failure
-                break;
-            }
+            // -noart fallback; keep previous artwork visible - don't clear on failure
+            SendMessage(m_hWnd, WM_USER + 11, 0, 0);
+            break;
 
         case ArtworkEventType::ARTWORK_CLEARED:
-            // Post to main thread to clear dedup state
-            if (m_hWnd) {
-                PostMessage(m_hWnd, WM_USER + 12, 0, 0);
-            }
+            m_last_event_image.reset();
             break;
     }
 }
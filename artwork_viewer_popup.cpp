@@ -1,11 +1,14 @@
 #include "stdafx.h"
 #include "artwork_viewer_popup.h"
+#include "artwork_manager.h"
+#include "webp_decoder.h"
 #include <commdlg.h>
 #include <shlobj.h>
 #include <gdiplus.h>
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
+#include <vector>
 #include <dwmapi.h>
 
 #pragma comment(lib, "dwmapi.lib")
@@ -129,7 +132,66 @@ void ArtworkViewerPopup::ShowPopup(HWND parent_hwnd) {
         
         // Set focus
         SetFocus();
+
+        RequestFullResolutionArtwork();
+    }
+}
+
+void ArtworkViewerPopup::RequestFullResolutionArtwork() {
+    // Panels may hold a panel-sized download; the viewer and Save always get the original
+    HWND target = m_hWnd;
+    artwork_manager::fetch_full_resolution_artwork_async([target](const artwork_manager::artwork_result& result) {
+        if (!result.success || result.data.get_size() == 0 || !::IsWindow(target)) return;
+
+        image_buffer* data = new image_buffer(result.data);
+        if (!::PostMessage(target, WM_FULL_RESOLUTION_READY, 0, reinterpret_cast<LPARAM>(data))) {
+            delete data;
+        }
+    });
+}
+
+LRESULT ArtworkViewerPopup::OnFullResolutionReady(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled) {
+    bHandled = TRUE;
+    std::unique_ptr<image_buffer> data(reinterpret_cast<image_buffer*>(lParam));
+    if (!data || data->is_empty()) return 0;
+
+    Gdiplus::Bitmap* bitmap = nullptr;
+    if (is_webp_signature(data->get_ptr(), data->get_size())) {
+        bitmap = decode_webp_via_wic(data->get_ptr(), data->get_size());
+    } else {
+        IStream* stream = data->create_stream();
+        if (stream) {
+            // Clone so the bitmap does not depend on the stream staying alive
+            Gdiplus::Bitmap* stream_bitmap = Gdiplus::Bitmap::FromStream(stream);
+            if (stream_bitmap && stream_bitmap->GetLastStatus() == Gdiplus::Ok) {
+                bitmap = stream_bitmap->Clone(0, 0, stream_bitmap->GetWidth(), stream_bitmap->GetHeight(), stream_bitmap->GetPixelFormat());
+            }
+            delete stream_bitmap;
+            stream->Release();
+        }
     }
+
+    if (!bitmap || bitmap->GetLastStatus() != Gdiplus::Ok) {
+        delete bitmap;
+        return 0;
+    }
+
+    // Only upgrade - never replace with a smaller image
+    if (m_artwork_image && bitmap->GetWidth() <= m_artwork_image->GetWidth()) {
+        delete bitmap;
+        return 0;
+    }
+
+    m_artwork_image.reset(bitmap);
+    m_pan_offset_x = 0;
+    m_pan_offset_y = 0;
+    m_image_info = GetImageInfo();
+    if (m_info_label) {
+        ::SetWindowTextA(m_info_label, m_image_info.c_str());
+    }
+    CalculateImageRect();
+    Invalidate(FALSE);
+    return 0;
 }
 
 LRESULT ArtworkViewerPopup::OnCreate(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled) {
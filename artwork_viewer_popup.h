@@ -34,6 +34,7 @@ public:
         MESSAGE_HANDLER(WM_COMMAND, OnCommand)
         MESSAGE_HANDLER(WM_CTLCOLORSTATIC, OnCtlColorStatic)
         MESSAGE_HANDLER(WM_CLOSE, OnClose)
+        MESSAGE_HANDLER(WM_FULL_RESOLUTION_READY, OnFullResolutionReady)
     END_MSG_MAP()
 
     // Show the popup window
@@ -55,6 +56,7 @@ private:
     LRESULT OnCommand(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);
     LRESULT OnCtlColorStatic(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);
     LRESULT OnClose(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);
+    LRESULT OnFullResolutionReady(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled);
 
     // Drawing functions
     void PaintArtwork(HDC hdc);
@@ -67,6 +69,9 @@ private:
     void SaveArtwork();
     void CreateControls();
 
+    // Replace the panel-sized image with the provider's full resolution original
+    void RequestFullResolutionArtwork();
+
     // Utility functions
     std::string GetImageInfo() const;
     void CenterWindow(HWND parent_hwnd);
@@ -106,6 +111,9 @@ private:
     // Control IDs
     static const int ID_FIT_BUTTON = 1001;
     static const int ID_SAVE_BUTTON = 1002;
+
+    // Posted with a heap-allocated image_buffer in lParam
+    static const UINT WM_FULL_RESOLUTION_READY = WM_APP + 1;
     
     // Layout constants
     static const int CONTROL_HEIGHT = 30;
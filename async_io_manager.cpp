@@ -1,11 +1,14 @@
 #include "stdafx.h"
 #include "async_io_manager.h"
 #include "artwork_manager.h"
+#include "host_rate_limiter.h"
+#include "provider_health.h"
 #include <shlwapi.h>
 #include <shlobj.h>
 #include <winhttp.h>
 #include <chrono>
 #include <algorithm>
+#include <random>
 
 #pragma comment(lib, "shlwapi.lib")
 #pragma comment(lib, "winhttp.lib")
@@ -15,35 +18,133 @@ extern cfg_int cfg_http_timeout;
 extern cfg_int cfg_retry_count;
 extern cfg_string cfg_cache_folder;
 extern cfg_uint cfg_cache_size;
+extern cfg_int cfg_max_artwork_download_size;
 
-// MusicBrainz rate limiter - enforces 1 request per second
-static std::mutex g_musicbrainz_rate_mutex;
-static std::chrono::steady_clock::time_point g_last_musicbrainz_request = std::chrono::steady_clock::now() - std::chrono::seconds(2);
+// Read the Retry-After header (delta-seconds or HTTP-date). Returns -1 if absent or unparseable.
+static int query_retry_after_seconds(HINTERNET hRequest) {
+    wchar_t value[64] = {};
+    DWORD value_size = sizeof(value);
+    if (!WinHttpQueryHeaders(hRequest, WINHTTP_QUERY_RETRY_AFTER, WINHTTP_HEADER_NAME_BY_INDEX,
+                             value, &value_size, WINHTTP_NO_HEADER_INDEX)) {
+        return -1;
+    }
 
-static void enforce_musicbrainz_rate_limit() {
-    std::lock_guard<std::mutex> lock(g_musicbrainz_rate_mutex);
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - g_last_musicbrainz_request);
+    if (value[0] >= L'0' && value[0] <= L'9') {
+        return _wtoi(value);
+    }
 
-    // MusicBrainz requires minimum 1 second between requests
-    if (elapsed.count() < 1000) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(1000 - elapsed.count()));
+    SYSTEMTIME retry_time;
+    if (!WinHttpTimeToSystemTime(value, &retry_time)) {
+        return -1;
     }
-    g_last_musicbrainz_request = std::chrono::steady_clock::now();
+
+    FILETIME retry_ft, now_ft;
+    SystemTimeToFileTime(&retry_time, &retry_ft);
+    GetSystemTimeAsFileTime(&now_ft);
+
+    ULARGE_INTEGER retry_ul, now_ul;
+    retry_ul.LowPart = retry_ft.dwLowDateTime;
+    retry_ul.HighPart = retry_ft.dwHighDateTime;
+    now_ul.LowPart = now_ft.dwLowDateTime;
+    now_ul.HighPart = now_ft.dwHighDateTime;
+
+    if (retry_ul.QuadPart <= now_ul.QuadPart) return 0;
+    return (int)((retry_ul.QuadPart - now_ul.QuadPart) / 10000000ULL);
 }
 
-// Helper to check if an error is retryable (network issues, timeouts, server errors)
-static bool is_retryable_error(const pfc::string8& error) {
-    // Retryable: connection failures, timeouts, 5xx server errors
-    if (error.find_first("connect") != pfc_infinite) return true;
-    if (error.find_first("timeout") != pfc_infinite) return true;
-    if (error.find_first("503") != pfc_infinite) return true;  // Service Unavailable
-    if (error.find_first("502") != pfc_infinite) return true;  // Bad Gateway
-    if (error.find_first("504") != pfc_infinite) return true;  // Gateway Timeout
-    if (error.find_first("429") != pfc_infinite) return true;  // Too Many Requests
+// Read a string response header such as ETag or Last-Modified. Empty if absent.
+static pfc::string8 query_header_string(HINTERNET hRequest, DWORD query) {
+    DWORD value_size = 0;
+    WinHttpQueryHeaders(hRequest, query, WINHTTP_HEADER_NAME_BY_INDEX, WINHTTP_NO_OUTPUT_BUFFER, &value_size, WINHTTP_NO_HEADER_INDEX);
+    if (GetLastError() != ERROR_INSUFFICIENT_BUFFER || value_size == 0) return pfc::string8();
+
+    std::wstring value(value_size / sizeof(wchar_t), L'\0');
+    if (!WinHttpQueryHeaders(hRequest, query, WINHTTP_HEADER_NAME_BY_INDEX, &value[0], &value_size, WINHTTP_NO_HEADER_INDEX)) {
+        return pfc::string8();
+    }
+    value.resize(value_size / sizeof(wchar_t));
+    return pfc::string8(pfc::stringcvt::string_utf8_from_wide(value.c_str()));
+}
+
+// Outcome of a single HTTP attempt, used to decide whether and when to retry
+struct http_attempt_info {
+    DWORD status_code;          // 0 if no response was received
+    int retry_after_seconds;    // -1 if the server sent no Retry-After
+    bool transport_error;       // Connect/send/receive failure or timeout
+
+    http_attempt_info() : status_code(0), retry_after_seconds(-1), transport_error(false) {}
+};
+
+// Retryable: connection failures, timeouts, 502/503/504 and 429
+static bool is_retryable_attempt(const http_attempt_info& info) {
+    if (info.transport_error) return true;
+    switch (info.status_code) {
+        case 429:  // Too Many Requests
+        case 502:  // Bad Gateway
+        case 503:  // Service Unavailable
+        case 504:  // Gateway Timeout
+            return true;
+    }
     return false;
 }
 
+// Retry delay bounds for decorrelated jitter
+static const DWORD RETRY_BASE_DELAY_MS = 500;
+static const DWORD RETRY_MAX_DELAY_MS = 8000;
+
+// Decorrelated jitter: random delay between the base and three times the previous delay.
+// Spreads retries from many requests apart instead of having them retry in lockstep.
+static DWORD next_retry_delay_ms(DWORD previous_delay_ms) {
+    static thread_local std::mt19937 rng(std::random_device{}());
+    DWORD upper = (std::max)(RETRY_BASE_DELAY_MS, previous_delay_ms * 3);
+    std::uniform_int_distribution<DWORD> dist(RETRY_BASE_DELAY_MS, upper);
+    return (std::min)(RETRY_MAX_DELAY_MS, dist(rng));
+}
+
+// Per-attempt timeout for url: the configured timeout, tightened to the provider's
+// observed p99 latency once enough samples exist
+static int provider_timeout_seconds(const pfc::string8& url) {
+    int timeout_seconds = cfg_http_timeout.get_value();
+    if (timeout_seconds < 1) timeout_seconds = 1;
+    return provider_health::instance().timeout_seconds(url, timeout_seconds);
+}
+
+// Overall time budget for one request including retries: a search tier (one provider
+// of the chain) waits at most the configured HTTP timeout for its request. The first
+// attempt may use all of it; retries only fit after attempts that failed fast.
+static std::chrono::steady_clock::time_point request_deadline() {
+    int timeout_seconds = cfg_http_timeout.get_value();
+    if (timeout_seconds < 1) timeout_seconds = 1;
+    return std::chrono::steady_clock::now() + std::chrono::seconds(timeout_seconds);
+}
+
+// End of the next attempt: the provider's timeout from now, but never past the deadline
+static std::chrono::steady_clock::time_point attempt_deadline(const pfc::string8& url, std::chrono::steady_clock::time_point deadline) {
+    auto attempt_end = std::chrono::steady_clock::now() + std::chrono::seconds(provider_timeout_seconds(url));
+    return (std::min)(attempt_end, deadline);
+}
+
+// Gives every WinHTTP phase still to come what is left of the attempt. Called before
+// sending, before waiting for the response and before every read, so a stalled receive
+// ends at the attempt's end instead of after a full timeout of its own. False once
+// nothing is left.
+static bool apply_remaining_timeouts(HINTERNET handle, std::chrono::steady_clock::time_point attempt_end) {
+    auto remaining_ms = std::chrono::duration_cast<std::chrono::milliseconds>(attempt_end - std::chrono::steady_clock::now()).count();
+    if (remaining_ms <= 0) return false;
+    int timeout_ms = (int)remaining_ms;
+    return WinHttpSetTimeouts(handle, timeout_ms, timeout_ms, timeout_ms, timeout_ms) != FALSE;
+}
+
+// Feed one attempt's outcome into the provider's latency histogram and circuit breaker.
+// Transport errors, 5xx and 429 count as failures; any other status is a response.
+static void record_provider_attempt(const pfc::string8& url, const http_attempt_info& info,
+                                    std::chrono::steady_clock::time_point started) {
+    if (!info.transport_error && info.status_code == 0) return;  // Failed before sending, nothing learned
+    bool responded = !info.transport_error && info.status_code < 500 && info.status_code != 429;
+    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started).count();
+    provider_health::instance().record_attempt(url, responded, (unsigned)elapsed_ms);
+}
+
 // Helper to convert UTF-8 pfc::string8 to wide string for Unicode Windows APIs
 static std::wstring utf8_to_wide(const pfc::string8& utf8_str) {
     if (utf8_str.is_empty()) return L"";
@@ -60,7 +161,10 @@ static std::wstring utf8_to_wide(const pfc::string8& utf8_str) {
 
 // Static member definitions
 HWND async_io_manager::main_thread_dispatcher::message_window = nullptr;
-std::queue<async_io_manager::main_thread_callback> async_io_manager::main_thread_dispatcher::callback_queue;
+std::deque<async_io_manager::main_thread_dispatcher::queued_callback> async_io_manager::main_thread_dispatcher::callback_queue;
+std::map<std::string, uint64_t> async_io_manager::main_thread_dispatcher::latest_by_key;
+uint64_t async_io_manager::main_thread_dispatcher::next_sequence = 0;
+bool async_io_manager::main_thread_dispatcher::message_pending = false;
 std::mutex async_io_manager::main_thread_dispatcher::callback_mutex;
 UINT async_io_manager::main_thread_dispatcher::WM_ASYNC_CALLBACK = 0;
 
@@ -86,6 +190,11 @@ void async_io_manager::initialize(size_t thread_count) {
     
     thread_pool_ = std::make_unique<thread_pool>(thread_count);
     cache_ = std::make_unique<async_cache>();
+    scheduler_ = std::make_unique<delayed_scheduler>([this](std::function<void()> task) {
+        if (thread_pool_) {
+            thread_pool_->enqueue(std::move(task));
+        }
+    });
     
     // Initialize cache directory
     // Check if custom cache folder is configured, otherwise use default profile path
@@ -130,6 +239,12 @@ void async_io_manager::initialize(size_t thread_count) {
 void async_io_manager::shutdown() {
     shutdown_requested_ = true;
     
+    // Stop the timer thread before the pool it dispatches into goes away
+    if (scheduler_) {
+        scheduler_->shutdown();
+        scheduler_.reset();
+    }
+    
     if (cache_) {
         cache_->shutdown();
         cache_.reset();
@@ -166,7 +281,7 @@ void async_io_manager::read_file_async(const pfc::string8& file_path, file_read_
     });
 }
 
-void async_io_manager::write_file_async(const pfc::string8& file_path, const pfc::array_t<t_uint8>& data, file_write_callback callback) {
+void async_io_manager::write_file_async(const pfc::string8& file_path, const image_buffer& data, file_write_callback callback) {
     ASSERT_MAIN_THREAD();
     if (g_is_shutting_down.load() || core_api::is_shutting_down() || !thread_pool_) return;
     
@@ -190,19 +305,41 @@ void async_io_manager::http_get_async(const pfc::string8& url, http_request_call
     ASSERT_MAIN_THREAD();
     if (g_is_shutting_down.load() || core_api::is_shutting_down() || !thread_pool_) return;
     
-    thread_pool_->enqueue([this, url, callback]() {
+    // Rate-limited hosts get a later slot instead of a worker sleeping on the limit
+    DWORD delay_ms = host_rate_limiter::instance().reserve(url);
+    http_conditional_callback plain_callback = [callback](bool success, bool, const pfc::string8& response, const pfc::string8& error) {
+        callback(success, response, error);
+    };
+    submit_task_after(delay_ms, [this, url, plain_callback]() {
+        if (g_is_shutting_down.load() || core_api::is_shutting_down()) return;
+        perform_http_get(url, plain_callback, http_retry_state(), false);
+    });
+}
+
+void async_io_manager::http_get_conditional_async(const pfc::string8& url, http_conditional_callback callback) {
+    ASSERT_MAIN_THREAD();
+    if (g_is_shutting_down.load() || core_api::is_shutting_down() || !thread_pool_) return;
+    
+    DWORD delay_ms = host_rate_limiter::instance().reserve(url);
+    submit_task_after(delay_ms, [this, url, callback]() {
         if (g_is_shutting_down.load() || core_api::is_shutting_down()) return;
-        perform_http_get(url, callback);
+        perform_http_get(url, callback, http_retry_state(), true);
     });
 }
 
+void async_io_manager::http_clear_validators() {
+    std::lock_guard<std::mutex> lock(validators_mutex_);
+    validators_.clear();
+}
+
 void async_io_manager::http_get_binary_async(const pfc::string8& url, file_read_callback callback) {
     ASSERT_MAIN_THREAD();
     if (g_is_shutting_down.load() || core_api::is_shutting_down() || !thread_pool_) return;
     
-    thread_pool_->enqueue([this, url, callback]() {
+    DWORD delay_ms = host_rate_limiter::instance().reserve(url);
+    submit_task_after(delay_ms, [this, url, callback]() {
         if (g_is_shutting_down.load() || core_api::is_shutting_down()) return;
-        perform_http_get_binary(url, callback);
+        perform_http_get_binary(url, callback, http_retry_state());
     });
 }
 
@@ -212,7 +349,7 @@ void async_io_manager::cache_get_async(const pfc::string8& key, file_read_callba
     cache_->get_async(key, callback);
 }
 
-void async_io_manager::cache_set_async(const pfc::string8& key, const pfc::array_t<t_uint8>& data, file_write_callback callback) {
+void async_io_manager::cache_set_async(const pfc::string8& key, const image_buffer& data, file_write_callback callback) {
     if (g_is_shutting_down.load() || core_api::is_shutting_down() || !cache_) return;
     cache_->set_async(key, data, callback);
 }
@@ -237,10 +374,13 @@ pfc::string8 async_io_manager::get_cache_file_path(const pfc::string8& key) cons
 }
 
 void async_io_manager::post_to_main_thread(main_thread_callback callback) {
+    post_to_main_thread(nullptr, std::move(callback));
+}
+
+void async_io_manager::post_to_main_thread(const char* coalesce_key, main_thread_callback callback) {
     if (g_is_shutting_down.load() || core_api::is_shutting_down()) return;
 
-    // Simple approach: use fb2k_async which is a common pattern in foobar2000 components
-    fb2k::inMainThread([callback]() {
+    auto guarded = [callback]() {
         if (g_is_shutting_down.load() || core_api::is_shutting_down()) return;
         try {
             callback();
@@ -249,7 +389,12 @@ void async_io_manager::post_to_main_thread(main_thread_callback callback) {
         } catch (...) {
             // Error handling for unknown exceptions
         }
-    });
+    };
+
+    if (!main_thread_dispatcher::post_callback(coalesce_key, guarded)) {
+        // Dispatcher not running (before initialize or after shutdown): no coalescing
+        fb2k::inMainThread(guarded);
+    }
 }
 
 void async_io_manager::submit_task(std::function<void()> task) {
@@ -259,6 +404,16 @@ void async_io_manager::submit_task(std::function<void()> task) {
     thread_pool_->enqueue(task);
 }
 
+void async_io_manager::submit_task_after(DWORD delay_ms, std::function<void()> task) {
+    if (g_is_shutting_down.load() || shutdown_requested_ || !thread_pool_) return;
+    
+    if (delay_ms == 0 || !scheduler_) {
+        thread_pool_->enqueue(std::move(task));
+        return;
+    }
+    scheduler_->schedule(delay_ms, std::move(task));
+}
+
 bool async_io_manager::is_main_thread() const {
     return GetCurrentThreadId() == main_thread_id_;
 }
@@ -405,10 +560,10 @@ void CALLBACK async_io_manager::file_io_completion(DWORD error_code, DWORD bytes
             callback(success, error_message);
         });
     } else if (!context->is_write_operation && context->read_callback) {
-        pfc::array_t<t_uint8> data;
+        image_buffer data;
         if (success && bytes_transferred > 0) {
-            data = std::move(context->buffer);
-            data.set_size(bytes_transferred);
+            context->buffer.set_size(bytes_transferred);
+            data = image_buffer(std::move(context->buffer));
         }
         
         instance().post_to_main_thread([callback = context->read_callback, success, data, error_message]() {
@@ -443,7 +598,7 @@ void async_io_manager::perform_overlapped_read(const pfc::string8& file_path, fi
         post_to_main_thread([callback, error]() {
             pfc::string8 error_msg = "Failed to open file: ";
             error_msg << pfc::format_int(error);
-            callback(false, pfc::array_t<t_uint8>(), error_msg);
+            callback(false, image_buffer(), error_msg);
         });
         return;
     }
@@ -452,7 +607,7 @@ void async_io_manager::perform_overlapped_read(const pfc::string8& file_path, fi
     LARGE_INTEGER file_size;
     if (!GetFileSizeEx(context->file_handle, &file_size)) {
         post_to_main_thread([callback]() {
-            callback(false, pfc::array_t<t_uint8>(), "Failed to get file size");
+            callback(false, image_buffer(), "Failed to get file size");
         });
         return;
     }
@@ -461,7 +616,7 @@ void async_io_manager::perform_overlapped_read(const pfc::string8& file_path, fi
     const LONGLONG MAX_FILE_SIZE = 50 * 1024 * 1024; // 50MB
     if (file_size.QuadPart > MAX_FILE_SIZE) {
         post_to_main_thread([callback]() {
-            callback(false, pfc::array_t<t_uint8>(), "File too large");
+            callback(false, image_buffer(), "File too large");
         });
         return;
     }
@@ -472,7 +627,7 @@ void async_io_manager::perform_overlapped_read(const pfc::string8& file_path, fi
     // Associate with completion port
     if (!CreateIoCompletionPort(context->file_handle, completion_port_, 0, 0)) {
         post_to_main_thread([callback]() {
-            callback(false, pfc::array_t<t_uint8>(), "Failed to associate with completion port");
+            callback(false, image_buffer(), "Failed to associate with completion port");
         });
         return;
     }
@@ -491,18 +646,18 @@ void async_io_manager::perform_overlapped_read(const pfc::string8& file_path, fi
         // Immediate error
         std::unique_ptr<io_context> cleanup_context(context_ptr);
         post_to_main_thread([callback]() {
-            callback(false, pfc::array_t<t_uint8>(), "Failed to start read operation");
+            callback(false, image_buffer(), "Failed to start read operation");
         });
     }
 }
 
-void async_io_manager::perform_overlapped_write(const pfc::string8& file_path, const pfc::array_t<t_uint8>& data, file_write_callback callback) {
+void async_io_manager::perform_overlapped_write(const pfc::string8& file_path, const image_buffer& data, file_write_callback callback) {
     ASSERT_BACKGROUND_THREAD();
     
     auto context = std::make_unique<io_context>();
     context->write_callback = callback;
     context->file_path = file_path;
-    context->buffer = data;
+    context->write_data = data;
     context->is_write_operation = true;
     
     // Create directory if needed (use Wide API for Unicode path support)
@@ -549,8 +704,8 @@ void async_io_manager::perform_overlapped_write(const pfc::string8& file_path, c
     io_context* context_ptr = context.release();
     BOOL result = WriteFile(
         context_ptr->file_handle,
-        context_ptr->buffer.get_ptr(),
-        static_cast<DWORD>(context_ptr->buffer.get_size()),
+        context_ptr->write_data.get_ptr(),
+        static_cast<DWORD>(context_ptr->write_data.get_size()),
         nullptr,
         &context_ptr->overlapped
     );
@@ -674,7 +829,7 @@ void async_io_manager::async_cache::get_async(const pfc::string8& key, file_read
     
     // Load from disk asynchronously
     pfc::string8 file_path = get_cache_file_path(key);
-    instance().read_file_async(file_path, [this, key, callback](bool success, const pfc::array_t<t_uint8>& data, const pfc::string8& error) {
+    instance().read_file_async(file_path, [this, key, callback](bool success, const image_buffer& data, const pfc::string8& error) {
         if (success && data.get_size() > 0) {
             // Store in memory cache
             {
@@ -690,7 +845,7 @@ void async_io_manager::async_cache::get_async(const pfc::string8& key, file_read
     });
 }
 
-void async_io_manager::async_cache::set_async(const pfc::string8& key, const pfc::array_t<t_uint8>& data, file_write_callback callback) {
+void async_io_manager::async_cache::set_async(const pfc::string8& key, const image_buffer& data, file_write_callback callback) {
     // Store in memory cache immediately
     {
         std::lock_guard<std::mutex> lock(cache_mutex);
@@ -919,81 +1074,143 @@ void async_io_manager::main_thread_dispatcher::initialize() {
     wc.lpszClassName = "foo_artwork_async_dispatcher";
     RegisterClassExA(&wc);
     
-    message_window = CreateWindowExA(
+    HWND window = CreateWindowExA(
         0, "foo_artwork_async_dispatcher", "",
         0, 0, 0, 0, 0,
         HWND_MESSAGE, nullptr, GetModuleHandle(nullptr), nullptr
     );
+
+    std::lock_guard<std::mutex> lock(callback_mutex);
+    message_window = window;
 }
 
 void async_io_manager::main_thread_dispatcher::shutdown() {
-    if (message_window) {
-        DestroyWindow(message_window);
+    HWND window;
+    {
+        std::lock_guard<std::mutex> lock(callback_mutex);
+        window = message_window;
         message_window = nullptr;
+        callback_queue.clear();
+        latest_by_key.clear();
+        message_pending = false;
+    }
+    if (window) {
+        DestroyWindow(window);
     }
 }
 
-void async_io_manager::main_thread_dispatcher::post_callback(main_thread_callback callback) {
+bool async_io_manager::main_thread_dispatcher::post_callback(const char* coalesce_key, main_thread_callback callback) {
+    HWND window;
+    bool wake;
     {
         std::lock_guard<std::mutex> lock(callback_mutex);
-        callback_queue.push(std::move(callback));
+        window = message_window;
+        if (!window) return false;
+
+        queued_callback entry;
+        entry.sequence = ++next_sequence;
+        if (coalesce_key && *coalesce_key) {
+            entry.key = coalesce_key;
+            latest_by_key[entry.key] = entry.sequence;
+        }
+        entry.callback = std::move(callback);
+        callback_queue.push_back(std::move(entry));
+
+        // One wake-up covers everything queued until the drain finds the queue empty
+        wake = !message_pending;
+        message_pending = true;
     }
-    
-    if (message_window) {
-        // Validate window handle before posting
-        if (IsWindow(message_window)) {
-            BOOL result = PostMessage(message_window, WM_ASYNC_CALLBACK, 0, 0);
-            if (!result) {
-                // Try to recreate the window and post again
-                message_window = nullptr;
-                initialize();
-                if (message_window && IsWindow(message_window)) {
-                    PostMessage(message_window, WM_ASYNC_CALLBACK, 0, 0);
-                }
+
+    if (wake && !PostMessage(window, WM_ASYNC_CALLBACK, 0, 0)) {
+        // Message queue full or window gone; the callbacks still have to run
+        fb2k::inMainThread([]() { drain(); });
+    }
+    return true;
+}
+
+// Runs queued callbacks until the queue is empty or the frame budget is spent
+void async_io_manager::main_thread_dispatcher::drain() {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(DRAIN_BUDGET_MS);
+
+    for (;;) {
+        main_thread_callback callback;
+        {
+            std::lock_guard<std::mutex> lock(callback_mutex);
+            if (callback_queue.empty()) {
+                message_pending = false;
+                return;
             }
-        } else {
-            message_window = nullptr;
-            initialize();
-            if (message_window && IsWindow(message_window)) {
-                PostMessage(message_window, WM_ASYNC_CALLBACK, 0, 0);
+            if (std::chrono::steady_clock::now() >= deadline) {
+                break;
+            }
+
+            queued_callback entry = std::move(callback_queue.front());
+            callback_queue.pop_front();
+            if (!entry.key.empty()) {
+                auto it = latest_by_key.find(entry.key);
+                if (it == latest_by_key.end() || it->second != entry.sequence) {
+                    continue; // Superseded by a newer callback with the same key
+                }
+                latest_by_key.erase(it);
             }
+            callback = std::move(entry.callback);
         }
-    } else {
-        initialize();
-        if (message_window && IsWindow(message_window)) {
-            PostMessage(message_window, WM_ASYNC_CALLBACK, 0, 0);
+
+        try {
+            callback();
+        } catch (...) {
+            // Callbacks posted through post_to_main_thread handle their own exceptions
         }
     }
+
+    schedule_continuation();
+}
+
+// Posted messages are retrieved ahead of input and WM_PAINT, so re-posting would keep
+// starving the UI. The rest of the queue is picked up from a timer instead, which
+// Windows only delivers once input and paint messages have been handled.
+void async_io_manager::main_thread_dispatcher::schedule_continuation() {
+    HWND window;
+    {
+        std::lock_guard<std::mutex> lock(callback_mutex);
+        window = message_window;
+    }
+    if (!window || !SetTimer(window, DRAIN_TIMER_ID, USER_TIMER_MINIMUM, nullptr)) {
+        fb2k::inMainThread([]() { drain(); });
+    }
 }
 
 LRESULT CALLBACK async_io_manager::main_thread_dispatcher::window_proc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam) {
     if (msg == WM_ASYNC_CALLBACK) {
-        std::queue<main_thread_callback> callbacks;
-        {
-            std::lock_guard<std::mutex> lock(callback_mutex);
-            callbacks.swap(callback_queue);
-        }
-        
-        while (!callbacks.empty()) {
-            try {
-                callbacks.front()();
-            } catch (const std::exception& e) {
-                // Error handling for callback exceptions
-            } catch (...) {
-                // Error handling for unknown exceptions
-            }
-            callbacks.pop();
-        }
+        drain();
+        return 0;
+    }
+
+    if (msg == WM_TIMER && wparam == DRAIN_TIMER_ID) {
+        KillTimer(hwnd, DRAIN_TIMER_ID);
+        drain();
         return 0;
     }
     
     return DefWindowProc(hwnd, msg, wparam, lparam);
 }
 
+// Automatic gzip/deflate decoding, available from Windows 8.1 - older SDK headers lack the names
+#ifndef WINHTTP_OPTION_DECOMPRESSION
+#define WINHTTP_OPTION_DECOMPRESSION 118
+#endif
+#ifndef WINHTTP_DECOMPRESSION_FLAG_ALL
+#define WINHTTP_DECOMPRESSION_FLAG_ALL 0x00000003
+#endif
+
 // Internal HTTP GET implementation (single attempt)
 // Returns: true on success, false on failure
 // On failure, error_message contains the error description
-static bool perform_http_get_internal(const pfc::string8& url, pfc::string8& response, pfc::string8& error_message, int timeout_seconds) {
+// When etag/last_modified are given they are sent as If-None-Match/If-Modified-Since and
+// replaced with the validators of the response; a 304 succeeds with an empty response.
+static bool perform_http_get_internal(const pfc::string8& url, pfc::string8& response, pfc::string8& error_message,
+                                      std::chrono::steady_clock::time_point attempt_end, http_attempt_info& info,
+                                      pfc::string8* etag = nullptr, pfc::string8* last_modified = nullptr) {
     response.reset();
     error_message.reset();
 
@@ -1023,9 +1240,10 @@ static bool perform_http_get_internal(const pfc::string8& url, pfc::string8& res
         return false;
     }
 
-    // Set timeouts using user-configurable value (in milliseconds)
-    int timeout_ms = timeout_seconds * 1000;
-    WinHttpSetTimeouts(hSession, timeout_ms, timeout_ms, timeout_ms, timeout_ms * 2);
+    // Let WinHTTP send Accept-Encoding and decompress JSON responses transparently.
+    // Fails harmlessly on systems without decompression support.
+    DWORD decompression = WINHTTP_DECOMPRESSION_FLAG_ALL;
+    WinHttpSetOption(hSession, WINHTTP_OPTION_DECOMPRESSION, &decompression, sizeof(decompression));
 
     // Connect to server
     std::wstring hostname(urlComp.lpszHostName, urlComp.dwHostNameLength);
@@ -1033,6 +1251,7 @@ static bool perform_http_get_internal(const pfc::string8& url, pfc::string8& res
     if (!hConnect) {
         WinHttpCloseHandle(hSession);
         error_message = "Failed to connect to server";
+        info.transport_error = true;
         return false;
     }
 
@@ -1053,22 +1272,37 @@ static bool perform_http_get_internal(const pfc::string8& url, pfc::string8& res
         return false;
     }
 
+    // Conditional request headers from the previous response
+    pfc::string8 conditional_headers;
+    if (etag && !etag->is_empty()) {
+        conditional_headers << "If-None-Match: " << etag->c_str() << "\r\n";
+    }
+    if (last_modified && !last_modified->is_empty()) {
+        conditional_headers << "If-Modified-Since: " << last_modified->c_str() << "\r\n";
+    }
+    pfc::stringcvt::string_wide_from_utf8 wide_headers(conditional_headers);
+
     // Send request
-    if (!WinHttpSendRequest(hRequest, WINHTTP_NO_ADDITIONAL_HEADERS, 0,
+    if (!apply_remaining_timeouts(hRequest, attempt_end) ||
+        !WinHttpSendRequest(hRequest,
+                           conditional_headers.is_empty() ? WINHTTP_NO_ADDITIONAL_HEADERS : wide_headers.get_ptr(),
+                           conditional_headers.is_empty() ? 0 : (DWORD)-1L,
                            WINHTTP_NO_REQUEST_DATA, 0, 0, 0)) {
         WinHttpCloseHandle(hRequest);
         WinHttpCloseHandle(hConnect);
         WinHttpCloseHandle(hSession);
         error_message = "Failed to send request (timeout or connection error)";
+        info.transport_error = true;
         return false;
     }
 
     // Receive response
-    if (!WinHttpReceiveResponse(hRequest, NULL)) {
+    if (!apply_remaining_timeouts(hRequest, attempt_end) || !WinHttpReceiveResponse(hRequest, NULL)) {
         WinHttpCloseHandle(hRequest);
         WinHttpCloseHandle(hConnect);
         WinHttpCloseHandle(hSession);
         error_message = "Failed to receive response (timeout)";
+        info.transport_error = true;
         return false;
     }
 
@@ -1077,6 +1311,13 @@ static bool perform_http_get_internal(const pfc::string8& url, pfc::string8& res
     DWORD statusCodeSize = sizeof(statusCode);
     WinHttpQueryHeaders(hRequest, WINHTTP_QUERY_STATUS_CODE | WINHTTP_QUERY_FLAG_NUMBER,
                        WINHTTP_HEADER_NAME_BY_INDEX, &statusCode, &statusCodeSize, WINHTTP_NO_HEADER_INDEX);
+    info.status_code = statusCode;
+
+    // Let the host's rate limiter back off on 429/503, honouring Retry-After
+    if (statusCode == 429 || statusCode == 503) {
+        info.retry_after_seconds = query_retry_after_seconds(hRequest);
+        host_rate_limiter::instance().on_response(url, statusCode, info.retry_after_seconds);
+    }
 
     if (statusCode >= 500) {
         WinHttpCloseHandle(hRequest);
@@ -1095,13 +1336,30 @@ static bool perform_http_get_internal(const pfc::string8& url, pfc::string8& res
         return false;
     }
 
+    // Unchanged since the validators we sent - nothing to download or parse
+    if (statusCode == 304) {
+        WinHttpCloseHandle(hRequest);
+        WinHttpCloseHandle(hConnect);
+        WinHttpCloseHandle(hSession);
+        return true;
+    }
+
+    if (etag) *etag = query_header_string(hRequest, WINHTTP_QUERY_ETAG);
+    if (last_modified) *last_modified = query_header_string(hRequest, WINHTTP_QUERY_LAST_MODIFIED);
+
     // Read response data
     DWORD dwSize = 0;
     pfc::string8 temp_response;
+    bool out_of_time = false;
 
     do {
         dwSize = 0;
+        if (!apply_remaining_timeouts(hRequest, attempt_end)) {
+            out_of_time = true;
+            break;
+        }
         if (!WinHttpQueryDataAvailable(hRequest, &dwSize)) {
+            out_of_time = std::chrono::steady_clock::now() >= attempt_end;
             break;
         }
 
@@ -1124,59 +1382,110 @@ static bool perform_http_get_internal(const pfc::string8& url, pfc::string8& res
     WinHttpCloseHandle(hConnect);
     WinHttpCloseHandle(hSession);
 
+    // A body cut off by the request budget is not a response
+    if (out_of_time) {
+        error_message = "Response not received within the request budget";
+        info.transport_error = true;
+        return false;
+    }
+
     response = temp_response;
     return true;
 }
 
-// HTTP Operations Implementation with retry logic
-void async_io_manager::perform_http_get(const pfc::string8& url, http_request_callback callback) {
-    ASSERT_BACKGROUND_THREAD();
+// Decide whether a failed attempt should be retried and after how long.
+// Honours Retry-After and the host's rate limiter, and never plans a retry past the deadline.
+static bool plan_retry(const pfc::string8& url, const http_attempt_info& info, int attempt, DWORD previous_delay_ms,
+                       std::chrono::steady_clock::time_point deadline, DWORD& delay_ms) {
+    if (attempt >= cfg_retry_count.get_value()) return false;
+    if (!is_retryable_attempt(info)) return false;
 
-    // Check if this is a MusicBrainz request and enforce rate limiting
-    if (url.find_first("musicbrainz.org") != pfc_infinite) {
-        enforce_musicbrainz_rate_limit();
+    delay_ms = next_retry_delay_ms(previous_delay_ms);
+    if (info.retry_after_seconds >= 0) {
+        delay_ms = (std::max)(delay_ms, (DWORD)info.retry_after_seconds * 1000);
     }
 
-    bool success = false;
-    pfc::string8 response;
-    pfc::string8 error_message;
+    auto now = std::chrono::steady_clock::now();
+    if (now + std::chrono::milliseconds(delay_ms) >= deadline) {
+        foo_artwork::log_printf("foo_artwork: Not retrying %s - retry would exceed the request budget", url.c_str());
+        return false;
+    }
 
-    int timeout_seconds = cfg_http_timeout.get_value();
-    int max_retries = cfg_retry_count.get_value();
-
-    // Retry loop with exponential backoff
-    for (int attempt = 0; attempt <= max_retries; attempt++) {
-        if (attempt > 0) {
-            // Exponential backoff: 1s, 2s, 4s, ...
-            int delay_ms = 1000 * (1 << (attempt - 1));
-            std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms));
-        }
+    // Retries also take a slot from the host's rate limiter. A slot that would only come
+    // after the deadline is given back, or the next request to the host waits for nothing.
+    DWORD slot_delay_ms = host_rate_limiter::instance().reserve(url);
+    if (now + std::chrono::milliseconds((std::max)(delay_ms, slot_delay_ms)) >= deadline) {
+        host_rate_limiter::instance().release(url, slot_delay_ms);
+        foo_artwork::log_printf("foo_artwork: Not retrying %s - the host's rate limit would exceed the request budget", url.c_str());
+        return false;
+    }
+    delay_ms = (std::max)(delay_ms, slot_delay_ms);
+    return true;
+}
 
-        success = perform_http_get_internal(url, response, error_message, timeout_seconds);
+// HTTP Operations Implementation - one attempt per call, retries are rescheduled
+// through the timer so a failing host never holds a pool worker while backing off
+void async_io_manager::perform_http_get(const pfc::string8& url, http_conditional_callback callback, http_retry_state state, bool conditional) {
+    ASSERT_BACKGROUND_THREAD();
 
-        if (success) {
-            break;  // Success, no need to retry
-        }
+    // The budget starts when the request is first sent, not while it waits for a rate limit slot
+    if (state.attempt == 0) {
+        state.deadline = request_deadline();
+    }
 
-        // Check if error is retryable
-        if (!is_retryable_error(error_message)) {
-            break;  // Non-retryable error, don't retry
+    pfc::string8 etag, last_modified;
+    if (conditional) {
+        std::lock_guard<std::mutex> lock(validators_mutex_);
+        auto it = validators_.find(url.c_str());
+        if (it != validators_.end()) {
+            etag = it->second.etag;
+            last_modified = it->second.last_modified;
         }
+    }
 
-        // Log retry attempt
-        if (attempt < max_retries) {
-            foo_artwork::log_printf("foo_artwork: HTTP request failed (attempt %d/%d), retrying: %s",
-                           attempt + 1, max_retries + 1, error_message.c_str());
+    pfc::string8 response;
+    pfc::string8 error_message;
+    http_attempt_info info;
+    auto started = std::chrono::steady_clock::now();
+    bool success = perform_http_get_internal(url, response, error_message, attempt_deadline(url, state.deadline), info,
+                                             conditional ? &etag : nullptr, conditional ? &last_modified : nullptr);
+    record_provider_attempt(url, info, started);
+
+    bool not_modified = success && info.status_code == 304;
+    if (conditional && success && !not_modified) {
+        std::lock_guard<std::mutex> lock(validators_mutex_);
+        if (etag.is_empty() && last_modified.is_empty()) {
+            validators_.erase(url.c_str());
+        } else {
+            // Only a handful of endpoints are polled at a time; start over if that ever grows
+            if (validators_.size() >= 64) validators_.clear();
+            http_validators& v = validators_[url.c_str()];
+            v.etag = etag;
+            v.last_modified = last_modified;
         }
     }
 
-    post_to_main_thread([callback, success, response, error_message]() {
-        callback(success, response, error_message);
+    DWORD retry_delay_ms = 0;
+    if (!success && plan_retry(url, info, state.attempt, state.previous_delay_ms, state.deadline, retry_delay_ms)) {
+        foo_artwork::log_printf("foo_artwork: HTTP request failed (attempt %d/%d), retrying in %u ms: %s",
+                       state.attempt + 1, cfg_retry_count.get_value() + 1, (unsigned)retry_delay_ms, error_message.c_str());
+        state.attempt++;
+        state.previous_delay_ms = retry_delay_ms;
+        submit_task_after(retry_delay_ms, [this, url, callback, state, conditional]() {
+            if (g_is_shutting_down.load() || core_api::is_shutting_down()) return;
+            perform_http_get(url, callback, state, conditional);
+        });
+        return;
+    }
+
+    post_to_main_thread([callback, success, not_modified, response, error_message]() {
+        callback(success, not_modified, response, error_message);
     });
 }
 
 // Internal binary HTTP GET implementation (single attempt)
-static bool perform_http_get_binary_internal(const pfc::string8& url, pfc::array_t<t_uint8>& data, pfc::string8& error_message, int timeout_seconds) {
+static bool perform_http_get_binary_internal(const pfc::string8& url, pfc::array_t<t_uint8>& data, pfc::string8& error_message,
+                                             std::chrono::steady_clock::time_point attempt_end, http_attempt_info& info) {
     data.set_size(0);
     error_message.reset();
 
@@ -1206,16 +1515,13 @@ static bool perform_http_get_binary_internal(const pfc::string8& url, pfc::array
         return false;
     }
 
-    // Set timeouts using user-configurable value
-    int timeout_ms = timeout_seconds * 1000;
-    WinHttpSetTimeouts(hSession, timeout_ms, timeout_ms, timeout_ms, timeout_ms * 2);
-
     // Connect to server
     std::wstring hostname(urlComp.lpszHostName, urlComp.dwHostNameLength);
     HINTERNET hConnect = WinHttpConnect(hSession, hostname.c_str(), urlComp.nPort, 0);
     if (!hConnect) {
         WinHttpCloseHandle(hSession);
         error_message = "Failed to connect to server";
+        info.transport_error = true;
         return false;
     }
 
@@ -1237,21 +1543,24 @@ static bool perform_http_get_binary_internal(const pfc::string8& url, pfc::array
     }
 
     // Send request
-    if (!WinHttpSendRequest(hRequest, WINHTTP_NO_ADDITIONAL_HEADERS, 0,
+    if (!apply_remaining_timeouts(hRequest, attempt_end) ||
+        !WinHttpSendRequest(hRequest, WINHTTP_NO_ADDITIONAL_HEADERS, 0,
                            WINHTTP_NO_REQUEST_DATA, 0, 0, 0)) {
         WinHttpCloseHandle(hRequest);
         WinHttpCloseHandle(hConnect);
         WinHttpCloseHandle(hSession);
         error_message = "Failed to send request (timeout or connection error)";
+        info.transport_error = true;
         return false;
     }
 
     // Receive response
-    if (!WinHttpReceiveResponse(hRequest, NULL)) {
+    if (!apply_remaining_timeouts(hRequest, attempt_end) || !WinHttpReceiveResponse(hRequest, NULL)) {
         WinHttpCloseHandle(hRequest);
         WinHttpCloseHandle(hConnect);
         WinHttpCloseHandle(hSession);
         error_message = "Failed to receive response (timeout)";
+        info.transport_error = true;
         return false;
     }
 
@@ -1260,6 +1569,13 @@ static bool perform_http_get_binary_internal(const pfc::string8& url, pfc::array
     DWORD statusCodeSize = sizeof(statusCode);
     WinHttpQueryHeaders(hRequest, WINHTTP_QUERY_STATUS_CODE | WINHTTP_QUERY_FLAG_NUMBER,
                        WINHTTP_HEADER_NAME_BY_INDEX, &statusCode, &statusCodeSize, WINHTTP_NO_HEADER_INDEX);
+    info.status_code = statusCode;
+
+    // Let the host's rate limiter back off on 429/503, honouring Retry-After
+    if (statusCode == 429 || statusCode == 503) {
+        info.retry_after_seconds = query_retry_after_seconds(hRequest);
+        host_rate_limiter::instance().on_response(url, statusCode, info.retry_after_seconds);
+    }
 
     if (statusCode >= 500) {
         WinHttpCloseHandle(hRequest);
@@ -1286,30 +1602,69 @@ static bool perform_http_get_binary_internal(const pfc::string8& url, pfc::array
         return false;
     }
 
-    // Read binary data
+    // Hard cap on artwork size (0 = unlimited) - oversized originals are never fully downloaded
+    int max_size_mb = cfg_max_artwork_download_size.get_value();
+    size_t max_bytes = max_size_mb > 0 ? (size_t)max_size_mb * 1024 * 1024 : 0;
+
+    DWORD content_length = 0;
+    DWORD content_length_size = sizeof(content_length);
+    bool has_content_length = WinHttpQueryHeaders(hRequest, WINHTTP_QUERY_CONTENT_LENGTH | WINHTTP_QUERY_FLAG_NUMBER,
+                                                  WINHTTP_HEADER_NAME_BY_INDEX, &content_length, &content_length_size, WINHTTP_NO_HEADER_INDEX) != FALSE;
+
+    if (has_content_length && max_bytes > 0 && content_length > max_bytes) {
+        WinHttpCloseHandle(hRequest);
+        WinHttpCloseHandle(hConnect);
+        WinHttpCloseHandle(hSession);
+        error_message = "Artwork exceeds the ";
+        error_message << max_size_mb << " MB download limit";
+        return false;
+    }
+
+    // Read binary data into a preallocated buffer (exact when Content-Length is known),
+    // growing geometrically otherwise so large images are not copied on every chunk.
+    // Content-Length is only the server's claim, and with no download limit nothing else
+    // bounds it, so at most MAX_DOWNLOAD_PREALLOCATION is reserved up front; a genuinely
+    // larger image grows the buffer as it arrives.
+    static const size_t MAX_DOWNLOAD_PREALLOCATION = 16 * 1024 * 1024;
+    size_t buffer_size = (has_content_length && content_length > 0) ? (std::min)((size_t)content_length, MAX_DOWNLOAD_PREALLOCATION) : 64 * 1024;
+    size_t total_read = 0;
+    data.set_size(buffer_size);
+
     DWORD dwSize = 0;
-    pfc::array_t<t_uint8> temp_data;
+    bool read_ok = true;
+    bool too_large = false;
 
     do {
         dwSize = 0;
+        if (!apply_remaining_timeouts(hRequest, attempt_end)) {
+            read_ok = false;
+            break;
+        }
         if (!WinHttpQueryDataAvailable(hRequest, &dwSize)) {
+            // A read cut off by the request budget leaves a truncated image
+            if (std::chrono::steady_clock::now() >= attempt_end) read_ok = false;
             break;
         }
 
         if (dwSize == 0) break;
 
-        size_t current_size = temp_data.get_size();
-        temp_data.set_size(current_size + dwSize);
+        if (max_bytes > 0 && total_read + dwSize > max_bytes) {
+            too_large = true;
+            break;
+        }
+
+        if (total_read + dwSize > buffer_size) {
+            buffer_size = (std::max)(buffer_size * 2, total_read + dwSize);
+            data.set_size(buffer_size);
+        }
 
         DWORD dwDownloaded = 0;
-        if (!WinHttpReadData(hRequest, temp_data.get_ptr() + current_size, dwSize, &dwDownloaded)) {
+        if (!WinHttpReadData(hRequest, data.get_ptr() + total_read, dwSize, &dwDownloaded)) {
+            read_ok = false;
             break;
         }
 
-        // Adjust size if less data was read
-        if (dwDownloaded < dwSize) {
-            temp_data.set_size(current_size + dwDownloaded);
-        }
+        total_read += dwDownloaded;
 
     } while (dwSize > 0);
 
@@ -1317,55 +1672,124 @@ static bool perform_http_get_binary_internal(const pfc::string8& url, pfc::array
     WinHttpCloseHandle(hConnect);
     WinHttpCloseHandle(hSession);
 
-    data = temp_data;
+    if (too_large) {
+        data.set_size(0);
+        error_message = "Artwork exceeds the ";
+        error_message << max_size_mb << " MB download limit";
+        return false;
+    }
+
+    if (!read_ok) {
+        data.set_size(0);
+        error_message = "Failed to read response data (connection error)";
+        info.transport_error = true;
+        return false;
+    }
+
+    // Trim to the received length (no-op when Content-Length was accurate)
+    if (total_read != buffer_size) {
+        data.set_size(total_read);
+    }
     return true;
 }
 
-void async_io_manager::perform_http_get_binary(const pfc::string8& url, file_read_callback callback) {
+void async_io_manager::perform_http_get_binary(const pfc::string8& url, file_read_callback callback, http_retry_state state) {
     ASSERT_BACKGROUND_THREAD();
 
-    // Check if this is a MusicBrainz/CoverArtArchive request and enforce rate limiting
-    if (url.find_first("musicbrainz.org") != pfc_infinite ||
-        url.find_first("coverartarchive.org") != pfc_infinite) {
-        enforce_musicbrainz_rate_limit();
+    if (state.attempt == 0) {
+        state.deadline = request_deadline();
     }
 
-    bool success = false;
     pfc::array_t<t_uint8> data;
     pfc::string8 error_message;
+    http_attempt_info info;
+    auto started = std::chrono::steady_clock::now();
+    bool success = perform_http_get_binary_internal(url, data, error_message, attempt_deadline(url, state.deadline), info);
+    record_provider_attempt(url, info, started);
+
+    DWORD retry_delay_ms = 0;
+    if (!success && plan_retry(url, info, state.attempt, state.previous_delay_ms, state.deadline, retry_delay_ms)) {
+        foo_artwork::log_printf("foo_artwork: Binary HTTP request failed (attempt %d/%d), retrying in %u ms: %s",
+                       state.attempt + 1, cfg_retry_count.get_value() + 1, (unsigned)retry_delay_ms, error_message.c_str());
+        state.attempt++;
+        state.previous_delay_ms = retry_delay_ms;
+        submit_task_after(retry_delay_ms, [this, url, callback, state]() {
+            if (g_is_shutting_down.load() || core_api::is_shutting_down()) return;
+            perform_http_get_binary(url, callback, state);
+        });
+        return;
+    }
 
-    int timeout_seconds = cfg_http_timeout.get_value();
-    int max_retries = cfg_retry_count.get_value();
-
-    // Retry loop with exponential backoff
-    for (int attempt = 0; attempt <= max_retries; attempt++) {
-        if (attempt > 0) {
-            // Exponential backoff: 1s, 2s, 4s, ...
-            int delay_ms = 1000 * (1 << (attempt - 1));
-            std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms));
-        }
+    // The downloaded bytes become the one shared copy used by the cache, callbacks and decoders
+    image_buffer shared_data = success ? image_buffer(std::move(data)) : image_buffer();
+    post_to_main_thread([callback, success, shared_data, error_message]() {
+        callback(success, shared_data, error_message);
+    });
+}
 
-        success = perform_http_get_binary_internal(url, data, error_message, timeout_seconds);
+// Delayed Scheduler Implementation
+async_io_manager::delayed_scheduler::delayed_scheduler(std::function<void(std::function<void()>)> dispatch_fn)
+    : wake_event(CreateEvent(NULL, FALSE, FALSE, NULL))
+    , stop(false)
+    , dispatch(dispatch_fn) {
+    timer_thread = std::thread([this]() {
+        timer_worker();
+    });
+}
 
-        if (success) {
-            break;  // Success, no need to retry
-        }
+async_io_manager::delayed_scheduler::~delayed_scheduler() {
+    shutdown();
+    if (wake_event != NULL) {
+        CloseHandle(wake_event);
+        wake_event = NULL;
+    }
+}
 
-        // Check if error is retryable
-        if (!is_retryable_error(error_message)) {
-            break;  // Non-retryable error, don't retry
-        }
+void async_io_manager::delayed_scheduler::schedule(DWORD delay_ms, std::function<void()> task) {
+    auto due = std::chrono::steady_clock::now() + std::chrono::milliseconds(delay_ms);
+    {
+        std::lock_guard<std::mutex> lock(tasks_mutex);
+        if (stop) return;
+        tasks.emplace(due, std::move(task));
+    }
+    SetEvent(wake_event);  // Re-evaluate the earliest due time
+}
 
-        // Log retry attempt
-        if (attempt < max_retries) {
-            foo_artwork::log_printf("foo_artwork: Binary HTTP request failed (attempt %d/%d), retrying: %s",
-                           attempt + 1, max_retries + 1, error_message.c_str());
-        }
+void async_io_manager::delayed_scheduler::shutdown() {
+    stop = true;
+    SetEvent(wake_event);
+    if (timer_thread.joinable()) {
+        timer_thread.join();
     }
+    std::lock_guard<std::mutex> lock(tasks_mutex);
+    tasks.clear();  // Pending tasks are dropped, like queued pool tasks on shutdown
+}
 
-    post_to_main_thread([callback, success, data, error_message]() {
-        callback(success, data, error_message);
-    });
+void async_io_manager::delayed_scheduler::timer_worker() {
+    while (!stop) {
+        std::vector<std::function<void()>> due_tasks;
+        DWORD wait_ms = INFINITE;
+        {
+            std::lock_guard<std::mutex> lock(tasks_mutex);
+            auto now = std::chrono::steady_clock::now();
+            while (!tasks.empty() && tasks.begin()->first <= now) {
+                due_tasks.push_back(std::move(tasks.begin()->second));
+                tasks.erase(tasks.begin());
+            }
+            if (!tasks.empty()) {
+                auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(tasks.begin()->first - now).count();
+                wait_ms = (DWORD)(std::max)(1LL, (long long)remaining);
+            }
+        }
+        
+        for (auto& task : due_tasks) {
+            dispatch(std::move(task));
+        }
+        
+        if (due_tasks.empty()) {
+            WaitForSingleObject(wake_event, wait_ms);
+        }
+    }
 }
 
 // Progressive Loader Implementation
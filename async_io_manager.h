@@ -4,9 +4,14 @@
 #include <memory>
 #include <thread>
 #include <queue>
+#include <deque>
 #include <mutex>
 #include <atomic>
 #include <vector>
+#include <map>
+#include <string>
+#include <chrono>
+#include "image_buffer.h"
 
 // Use Windows API instead of std::condition_variable for better compatibility
 // This avoids the _Cnd_init_in_situ issue with some Windows SDK versions
@@ -18,10 +23,11 @@ extern std::atomic<bool> g_is_shutting_down;
 class async_io_manager {
 public:
     // Callback types
-    typedef std::function<void(bool success, const pfc::array_t<t_uint8>& data, const pfc::string8& error)> file_read_callback;
+    typedef std::function<void(bool success, const image_buffer& data, const pfc::string8& error)> file_read_callback;
     typedef std::function<void(bool success, const pfc::string8& error)> file_write_callback;
     typedef std::function<void(bool success, const std::vector<pfc::string8>& files, const pfc::string8& error)> directory_scan_callback;
     typedef std::function<void(bool success, const pfc::string8& response, const pfc::string8& error)> http_request_callback;
+    typedef std::function<void(bool success, bool not_modified, const pfc::string8& response, const pfc::string8& error)> http_conditional_callback;
     typedef std::function<void()> main_thread_callback;
 
     // Singleton access
@@ -29,16 +35,21 @@ public:
 
     // Asynchronous file operations
     void read_file_async(const pfc::string8& file_path, file_read_callback callback);
-    void write_file_async(const pfc::string8& file_path, const pfc::array_t<t_uint8>& data, file_write_callback callback);
+    void write_file_async(const pfc::string8& file_path, const image_buffer& data, file_write_callback callback);
     void scan_directory_async(const pfc::string8& directory, const pfc::string8& pattern, directory_scan_callback callback);
     
     // Asynchronous HTTP operations
     void http_get_async(const pfc::string8& url, http_request_callback callback);
     void http_get_binary_async(const pfc::string8& url, file_read_callback callback);
     
+    // Conditional GET for polled endpoints: sends the ETag/Last-Modified seen for url last time
+    // and reports a 304 as not_modified with an empty response instead of the full body
+    void http_get_conditional_async(const pfc::string8& url, http_conditional_callback callback);
+    void http_clear_validators();
+    
     // Cache operations with write-behind buffering
     void cache_get_async(const pfc::string8& key, file_read_callback callback);
-    void cache_set_async(const pfc::string8& key, const pfc::array_t<t_uint8>& data, file_write_callback callback = nullptr);
+    void cache_set_async(const pfc::string8& key, const image_buffer& data, file_write_callback callback = nullptr);
     void cache_clear_all();
     void cache_remove(const pfc::string8& key);
     pfc::string8 get_cache_file_path(const pfc::string8& key) const;
@@ -47,12 +58,19 @@ public:
     void initialize(size_t thread_count = 4);
     void shutdown();
     
-    // Main thread marshalling
+    // Main thread marshalling. Callbacks run in posting order, a few milliseconds'
+    // worth per message, so a burst of completions cannot stall the UI.
     void post_to_main_thread(main_thread_callback callback);
+    // A callback still queued under the same key is dropped in favour of this one
+    void post_to_main_thread(const char* coalesce_key, main_thread_callback callback);
     
     // Generic task submission
     void submit_task(std::function<void()> task);
     
+    // Run a task on the thread pool after delay_ms without holding a worker while waiting.
+    // Safe to call from any thread.
+    void submit_task_after(DWORD delay_ms, std::function<void()> task);
+    
     // Thread safety checks
     bool is_main_thread() const;
     void assert_main_thread() const;
@@ -93,7 +111,8 @@ private:
         OVERLAPPED overlapped;
         file_read_callback read_callback;
         file_write_callback write_callback;
-        pfc::array_t<t_uint8> buffer;
+        pfc::array_t<t_uint8> buffer;       // Read target, handed off to an image_buffer on completion
+        image_buffer write_data;            // Write source, shared rather than copied
         pfc::string8 file_path;
         pfc::string8 error_message;
         HANDLE file_handle;
@@ -118,7 +137,7 @@ private:
     class async_cache {
     private:
         struct cache_entry {
-            pfc::array_t<t_uint8> data;
+            image_buffer data;  // Shared with callers and the write queue, never copied
             std::chrono::steady_clock::time_point last_access;
             bool dirty;
             
@@ -127,7 +146,7 @@ private:
         
         pfc::map_t<pfc::string8, cache_entry> cache_map;
         std::mutex cache_mutex;
-        std::queue<std::pair<pfc::string8, pfc::array_t<t_uint8>>> write_queue;
+        std::queue<std::pair<pfc::string8, image_buffer>> write_queue;
         std::mutex write_queue_mutex;
         HANDLE write_condition_event;  // Windows Event instead of std::condition_variable
         std::thread write_thread;
@@ -143,7 +162,7 @@ private:
         
         void initialize(const pfc::string8& cache_dir);
         void get_async(const pfc::string8& key, file_read_callback callback);
-        void set_async(const pfc::string8& key, const pfc::array_t<t_uint8>& data, file_write_callback callback = nullptr);
+        void set_async(const pfc::string8& key, const image_buffer& data, file_write_callback callback = nullptr);
         void remove(const pfc::string8& key);
         void clear_all();
         void flush_all();
@@ -151,6 +170,26 @@ private:
         pfc::string8 get_cache_file_path(const pfc::string8& key) const;
     };
     
+    // Timer facility - holds delayed tasks until due, then hands them to the thread pool
+    class delayed_scheduler {
+    private:
+        std::multimap<std::chrono::steady_clock::time_point, std::function<void()>> tasks;
+        std::mutex tasks_mutex;
+        HANDLE wake_event;  // Signalled when an earlier task is added or on shutdown
+        std::thread timer_thread;
+        std::atomic<bool> stop;
+        std::function<void(std::function<void()>)> dispatch;
+        
+        void timer_worker();
+        
+    public:
+        delayed_scheduler(std::function<void(std::function<void()>)> dispatch_fn);
+        ~delayed_scheduler();
+        
+        void schedule(DWORD delay_ms, std::function<void()> task);
+        void shutdown();
+    };
+    
     // Progressive image loader
     class progressive_loader {
     public:
@@ -174,27 +213,50 @@ private:
     // Main thread callback system
     class main_thread_dispatcher {
     private:
+        struct queued_callback {
+            std::string key;            // Empty = never coalesced
+            uint64_t sequence;
+            main_thread_callback callback;
+        };
+
         static HWND message_window;
-        static std::queue<main_thread_callback> callback_queue;
+        static std::deque<queued_callback> callback_queue;
+        static std::map<std::string, uint64_t> latest_by_key;   // Newest queued sequence per coalescing key
+        static uint64_t next_sequence;
+        static bool message_pending;    // A wake-up is queued or the queue is being drained
         static std::mutex callback_mutex;
         static UINT WM_ASYNC_CALLBACK;
-        
+
+        static constexpr DWORD DRAIN_BUDGET_MS = 8;     // Half a 60 Hz frame per message
+        static constexpr UINT_PTR DRAIN_TIMER_ID = 1;
+
         static LRESULT CALLBACK window_proc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam);
-        
+        static void drain();
+        static void schedule_continuation();
+
     public:
         static void initialize();
         static void shutdown();
-        static void post_callback(main_thread_callback callback);
+        // Returns false if the dispatcher window does not exist (before initialize / after shutdown)
+        static bool post_callback(const char* coalesce_key, main_thread_callback callback);
     };
     
     // File operations implementation
     void perform_overlapped_read(const pfc::string8& file_path, file_read_callback callback);
-    void perform_overlapped_write(const pfc::string8& file_path, const pfc::array_t<t_uint8>& data, file_write_callback callback);
+    void perform_overlapped_write(const pfc::string8& file_path, const image_buffer& data, file_write_callback callback);
     void perform_directory_scan(const pfc::string8& directory, const pfc::string8& pattern, directory_scan_callback callback);
     
-    // HTTP operations implementation
-    void perform_http_get(const pfc::string8& url, http_request_callback callback);
-    void perform_http_get_binary(const pfc::string8& url, file_read_callback callback);
+    // HTTP operations implementation - a single attempt per call; failed attempts
+    // reschedule themselves through the timer with the updated retry state
+    struct http_retry_state {
+        int attempt;                // 0 = first attempt
+        DWORD previous_delay_ms;    // Previous retry delay, seeds the jitter
+        std::chrono::steady_clock::time_point deadline;  // Set on the first attempt
+        
+        http_retry_state() : attempt(0), previous_delay_ms(0) {}
+    };
+    void perform_http_get(const pfc::string8& url, http_conditional_callback callback, http_retry_state state, bool conditional);
+    void perform_http_get_binary(const pfc::string8& url, file_read_callback callback, http_retry_state state);
     
     // IOCP completion handling
     void setup_completion_port();
@@ -204,6 +266,7 @@ private:
     // Member variables
     std::unique_ptr<thread_pool> thread_pool_;
     std::unique_ptr<async_cache> cache_;
+    std::unique_ptr<delayed_scheduler> scheduler_;
     HANDLE completion_port_;
     std::vector<std::thread> completion_workers_;
     std::atomic<bool> shutdown_requested_;
@@ -212,6 +275,14 @@ private:
     // Active I/O contexts
     std::mutex active_contexts_mutex_;
     std::vector<std::unique_ptr<io_context>> active_contexts_;
+    
+    // Cache validators from the last response of each conditionally requested URL
+    struct http_validators {
+        pfc::string8 etag;
+        pfc::string8 last_modified;
+    };
+    std::mutex validators_mutex_;
+    std::map<std::string, http_validators> validators_;
 };
 
 // Utility macros for thread safety
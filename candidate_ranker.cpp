@@ -0,0 +1,84 @@
+#include "stdafx.h"
+#include "candidate_ranker.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Trigrams of "  text " packed into integers, sorted for a merge-style intersection
+static void collect_trigrams(const std::string& s, std::vector<uint32_t>& out) {
+    out.clear();
+    std::string padded = "  ";
+    padded += s;
+    padded += ' ';
+    for (size_t i = 0; i + 2 < padded.size(); i++) {
+        out.push_back(((uint32_t)(unsigned char)padded[i] << 16) |
+                      ((uint32_t)(unsigned char)padded[i + 1] << 8) |
+                      (uint32_t)(unsigned char)padded[i + 2]);
+    }
+    std::sort(out.begin(), out.end());
+}
+
+double candidate_ranker::similarity(const std::string& a, const std::string& b) {
+    if (a == b) return 1.0;
+    if (a.empty() || b.empty()) return 0.0;
+
+    std::vector<uint32_t> ta, tb;
+    collect_trigrams(a, ta);
+    collect_trigrams(b, tb);
+
+    size_t common = 0;
+    size_t i = 0, j = 0;
+    while (i < ta.size() && j < tb.size()) {
+        if (ta[i] < tb[j]) i++;
+        else if (tb[j] < ta[i]) j++;
+        else { common++; i++; j++; }
+    }
+    return (2.0 * common) / (double)(ta.size() + tb.size());
+}
+
+double candidate_ranker::release_factor(const std::string& release_name, const std::string& query_title) {
+    if (release_name.empty()) return 1.0;
+
+    struct release_marker { const char* text; double factor; };
+    static const release_marker markers[] = {
+        // Someone else's recording: the artwork is certainly wrong
+        { "karaoke", 0.4 }, { "tribute", 0.5 }, { "in the style of", 0.4 },
+        { "made famous by", 0.4 }, { "originally performed", 0.4 }, { "cover version", 0.5 },
+        { "lullaby", 0.5 }, { "8 bit", 0.5 }, { "8bit", 0.5 },
+        // Right recording, usually the wrong cover
+        { "greatest hits", 0.85 }, { "best of", 0.85 }, { "hits of", 0.85 },
+        { "compilation", 0.85 }, { "various artists", 0.85 }, { "anthology", 0.9 },
+        { "collection", 0.9 }, { "essential", 0.9 }, { "now thats what i call", 0.8 }
+    };
+
+    double factor = 1.0;
+    for (const auto& marker : markers) {
+        if (release_name.find(marker.text) != std::string::npos &&
+            query_title.find(marker.text) == std::string::npos) {
+            factor = std::min(factor, marker.factor);
+        }
+    }
+    return factor;
+}
+
+double candidate_ranker::duration_factor(unsigned expected_seconds, unsigned candidate_seconds) {
+    if (expected_seconds == 0 || candidate_seconds == 0) return 1.0;
+
+    // Providers round differently and radio edits trim a few seconds; beyond that
+    // a different length means a different version (live, extended, remix)
+    unsigned diff = (unsigned)std::abs((int)expected_seconds - (int)candidate_seconds);
+    if (diff <= 5) return 1.0;
+    if (diff <= 15) return 0.95;
+    if (diff <= 45) return 0.8;
+    return 0.5;
+}
+
+double candidate_ranker::score(double artist_similarity, double title_similarity,
+                               double release_factor, double duration_factor) {
+    if (artist_similarity < MIN_ARTIST_SIMILARITY) return 0.0;
+
+    // The length only says something about the title match: another song by the right
+    // artist keeps its artist-only score (a usable fallback cover) whatever its length
+    return (0.5 * artist_similarity + 0.5 * title_similarity * duration_factor) * release_factor;
+}
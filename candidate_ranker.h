@@ -0,0 +1,37 @@
+#pragma once
+#include "stdafx.h"
+#include <string>
+
+// Scores provider search results against the track being looked up, so a parser
+// can pick the best of all returned candidates instead of the first plausible one.
+// Text inputs are expected in the matcher's normalized form (folded, lowercase).
+class candidate_ranker {
+public:
+    // Candidates below ACCEPT_SCORE are rejected; a hit below STRONG_SCORE is used
+    // only if the next provider does not come up with something better
+    static constexpr double ACCEPT_SCORE = 0.4;
+    static constexpr double STRONG_SCORE = 0.85;
+
+    // How long the next providers get to beat a weak hit before it is shown anyway
+    static constexpr unsigned HEDGE_BUDGET_MS = 1500;
+
+    // Artists less similar than this never match, however good the title is
+    static constexpr double MIN_ARTIST_SIMILARITY = 0.7;
+
+    // Dice coefficient over character trigrams: 1.0 for equal strings, 0.0 for
+    // nothing in common
+    static double similarity(const std::string& a, const std::string& b);
+
+    // Multiplier for the album/release a candidate comes from: karaoke, tribute
+    // and cover releases are penalized hard, compilations mildly, unless the
+    // query title asks for them
+    static double release_factor(const std::string& release_name, const std::string& query_title);
+
+    // Multiplier from the length difference; 1.0 when either length is unknown (0)
+    static double duration_factor(unsigned expected_seconds, unsigned candidate_seconds);
+
+    // Overall score in [0, 1]. The right artist with an unrelated title lands just above
+    // ACCEPT_SCORE; only a matching title can make a hit strong.
+    static double score(double artist_similarity, double title_similarity,
+                        double release_factor = 1.0, double duration_factor = 1.0);
+};
@@ -0,0 +1,202 @@
+#include "stdafx.h"
+#include "host_rate_limiter.h"
+#include "foo_artwork_log.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+extern cfg_string cfg_host_rate_limits;
+
+// Longest Retry-After we honour; anything beyond this is treated as a misbehaving server
+static const int MAX_RETRY_AFTER_SECONDS = 300;
+
+// Back-off applied to 429/503 responses that carry no Retry-After header
+static const int DEFAULT_THROTTLE_SECONDS = 5;
+
+host_rate_limiter& host_rate_limiter::instance() {
+    static host_rate_limiter instance;
+    return instance;
+}
+
+const char* host_rate_limiter::default_limits() {
+    // MusicBrainz allows 1 req/s; Discogs 60/min authenticated and 25/min anonymous;
+    // Last.fm about 5 req/s. Cover Art Archive has no published limit but is kept polite.
+    return "musicbrainz=60, coverartarchive=300, discogs=60, discogs-anon=25, lastfm=300";
+}
+
+std::string host_rate_limiter::classify(const pfc::string8& url) {
+    std::string lower(url.c_str());
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return (char)tolower(c); });
+
+    size_t host_start = lower.find("://");
+    host_start = (host_start == std::string::npos) ? 0 : host_start + 3;
+    size_t host_end = lower.find_first_of("/?:", host_start);
+    std::string host = lower.substr(host_start, host_end == std::string::npos ? std::string::npos : host_end - host_start);
+
+    auto host_is = [&host](const char* domain) {
+        size_t len = strlen(domain);
+        if (host.size() < len || host.compare(host.size() - len, len, domain) != 0) return false;
+        return host.size() == len || host[host.size() - len - 1] == '.';
+    };
+
+    if (host_is("musicbrainz.org")) return "musicbrainz";
+    if (host_is("coverartarchive.org")) return "coverartarchive";
+    if (host_is("api.discogs.com")) {
+        bool authenticated = lower.find("token=") != std::string::npos || lower.find("key=") != std::string::npos;
+        return authenticated ? "discogs" : "discogs-anon";
+    }
+    if (host_is("last.fm") || host_is("audioscrobbler.com")) return "lastfm";
+
+    return std::string();
+}
+
+void host_rate_limiter::refresh_limits() {
+    // Caller holds m_mutex
+    pfc::string8 limits = cfg_host_rate_limits.get_ptr();
+    if (limits.is_empty()) limits = default_limits();
+    if (!m_buckets.empty() && limits == m_parsed_limits) return;
+    m_parsed_limits = limits;
+
+    // Format: "name=requests_per_minute, name=requests_per_minute, ..." (0 = unlimited)
+    std::map<std::string, bucket> updated;
+    std::string spec(limits.c_str());
+    size_t pos = 0;
+    while (pos < spec.size()) {
+        size_t end = spec.find_first_of(",;", pos);
+        if (end == std::string::npos) end = spec.size();
+        std::string entry = spec.substr(pos, end - pos);
+        pos = end + 1;
+
+        size_t eq = entry.find('=');
+        if (eq == std::string::npos) continue;
+
+        std::string name = entry.substr(0, eq);
+        name.erase(std::remove_if(name.begin(), name.end(), [](unsigned char c) { return isspace(c) != 0; }), name.end());
+        std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return (char)tolower(c); });
+        int per_minute = atoi(entry.c_str() + eq + 1);
+        if (name.empty() || per_minute <= 0) continue;
+
+        // Keep tokens and counters of buckets that already exist
+        auto existing = m_buckets.find(name);
+        bucket b = (existing != m_buckets.end()) ? existing->second : bucket();
+        b.rate_per_second = per_minute / 60.0;
+        b.capacity = (std::max)(1.0, std::floor(b.rate_per_second));
+        if (existing == m_buckets.end()) {
+            b.tokens = b.capacity;
+            b.last_refill = std::chrono::steady_clock::now();
+        } else {
+            b.tokens = (std::min)(b.tokens, b.capacity);
+        }
+        updated[name] = b;
+    }
+    m_buckets.swap(updated);
+}
+
+host_rate_limiter::bucket* host_rate_limiter::find_bucket(const std::string& name) {
+    auto it = m_buckets.find(name);
+    return it != m_buckets.end() ? &it->second : nullptr;
+}
+
+void host_rate_limiter::refill(bucket& b, std::chrono::steady_clock::time_point now) {
+    // last_refill sits in the future while a Retry-After block is active
+    if (now <= b.last_refill) return;
+    double elapsed = std::chrono::duration<double>(now - b.last_refill).count();
+    b.tokens = (std::min)(b.capacity, b.tokens + elapsed * b.rate_per_second);
+    b.last_refill = now;
+}
+
+DWORD host_rate_limiter::reserve(const pfc::string8& url) {
+    std::string name = classify(url);
+    if (name.empty()) return 0;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    refresh_limits();
+    bucket* b = find_bucket(name);
+    if (!b) return 0;
+
+    auto now = std::chrono::steady_clock::now();
+    refill(*b, now);
+
+    b->requests++;
+    b->tokens -= 1.0;
+
+    // Wait out any server-imposed block, then for this request's place in the queue
+    double wait_ms = 0;
+    if (b->blocked_until > now) {
+        wait_ms = std::chrono::duration<double, std::milli>(b->blocked_until - now).count();
+    }
+    if (b->tokens < 0) {
+        wait_ms += (-b->tokens / b->rate_per_second) * 1000.0;
+    }
+
+    if (wait_ms <= 0) return 0;
+    b->deferred++;
+    return (DWORD)std::ceil(wait_ms);
+}
+
+void host_rate_limiter::release(const pfc::string8& url, DWORD reserved_delay_ms) {
+    std::string name = classify(url);
+    if (name.empty()) return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    bucket* b = find_bucket(name);
+    if (!b) return;
+
+    refill(*b, std::chrono::steady_clock::now());
+    b->tokens = (std::min)(b->capacity, b->tokens + 1.0);
+    if (b->requests > 0) b->requests--;
+    if (reserved_delay_ms > 0 && b->deferred > 0) b->deferred--;
+}
+
+void host_rate_limiter::on_response(const pfc::string8& url, DWORD status_code, int retry_after_seconds) {
+    if (status_code != 429 && status_code != 503) return;
+
+    std::string name = classify(url);
+    if (name.empty()) return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    refresh_limits();
+    bucket* b = find_bucket(name);
+    if (!b) return;
+
+    int seconds = retry_after_seconds >= 0 ? retry_after_seconds : DEFAULT_THROTTLE_SECONDS;
+    if (seconds > MAX_RETRY_AFTER_SECONDS) seconds = MAX_RETRY_AFTER_SECONDS;
+
+    auto now = std::chrono::steady_clock::now();
+    auto until = now + std::chrono::seconds(seconds);
+    if (until > b->blocked_until) {
+        b->blocked_until = until;
+        // No refill while blocked, and no burst credit carried over the block
+        b->last_refill = until;
+        b->tokens = (std::min)(b->tokens, 0.0);
+    }
+    b->throttled_responses++;
+
+    foo_artwork::log_printf("foo_artwork: %s responded %u, pausing requests for %d s", name.c_str(), (unsigned)status_code, seconds);
+}
+
+void host_rate_limiter::describe(pfc::string8& out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    refresh_limits();
+
+    auto now = std::chrono::steady_clock::now();
+    out.reset();
+    for (auto& entry : m_buckets) {
+        bucket& b = entry.second;
+        refill(b, now);
+
+        long long blocked_ms = 0;
+        if (b.blocked_until > now) {
+            blocked_ms = std::chrono::duration_cast<std::chrono::milliseconds>(b.blocked_until - now).count();
+        }
+
+        out << entry.first.c_str() << ": " << (int)std::lround(b.rate_per_second * 60) << "/min, burst " << (int)b.capacity
+            << ", tokens " << pfc::format_float(b.tokens, 0, 2)
+            << ", " << (unsigned)b.requests << " requests, " << (unsigned)b.deferred << " deferred, "
+            << (unsigned)b.throttled_responses << " throttled";
+        if (blocked_ms > 0) {
+            out << ", blocked for " << (int)blocked_ms << " ms";
+        }
+        out << "\n";
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "stdafx.h"
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+
+// Per-host token-bucket rate limiter for outgoing HTTP requests.
+// Requests are never delayed by sleeping: reserve() hands out a slot and returns
+// how long the caller should wait before sending, and the caller schedules the
+// request for that time.
+class host_rate_limiter {
+public:
+    static host_rate_limiter& instance();
+
+    // Default per-bucket limits in requests per minute, editable in Advanced preferences
+    static const char* default_limits();
+
+    // Reserve a request slot for url. Returns the delay in milliseconds before the
+    // request may be sent (0 = send now). URLs on unlimited hosts always return 0.
+    DWORD reserve(const pfc::string8& url);
+
+    // Give back a slot from reserve() that will not be used, e.g. a retry abandoned
+    // because its slot came too late. reserved_delay_ms is what reserve() returned.
+    void release(const pfc::string8& url, DWORD reserved_delay_ms);
+
+    // Report the outcome of a request. 429/503 responses block the bucket until
+    // Retry-After (seconds, -1 if absent) has elapsed.
+    void on_response(const pfc::string8& url, DWORD status_code, int retry_after_seconds);
+
+    // Human readable snapshot of every bucket for diagnostics
+    void describe(pfc::string8& out);
+
+private:
+    host_rate_limiter() {}
+
+    struct bucket {
+        double rate_per_second;     // Refill rate
+        double capacity;            // Burst size
+        double tokens;              // May go negative when requests are queued ahead
+        std::chrono::steady_clock::time_point last_refill;
+        std::chrono::steady_clock::time_point blocked_until;  // Set by Retry-After / 429 / 503
+        uint64_t requests;
+        uint64_t deferred;
+        uint64_t throttled_responses;
+
+        bucket() : rate_per_second(1.0), capacity(1.0), tokens(1.0), requests(0), deferred(0), throttled_responses(0) {}
+    };
+
+    // Map a URL to its bucket name ("musicbrainz", "discogs-anon", ...), empty if unlimited
+    static std::string classify(const pfc::string8& url);
+
+    void refresh_limits();
+    bucket* find_bucket(const std::string& name);
+    static void refill(bucket& b, std::chrono::steady_clock::time_point now);
+
+    std::mutex m_mutex;
+    std::map<std::string, bucket> m_buckets;
+    pfc::string8 m_parsed_limits;
+};
@@ -0,0 +1,184 @@
+#include "stdafx.h"
+#include "image_buffer.h"
+#include "foo_artwork_log.h"
+#include <atomic>
+
+static std::atomic<uint64_t> g_buffer_allocations(0);
+static std::atomic<uint64_t> g_buffer_bytes_allocated(0);
+static std::atomic<uint64_t> g_buffer_copies(0);
+static std::atomic<uint64_t> g_buffer_bytes_copied(0);
+static std::atomic<uint64_t> g_buffer_live(0);
+static std::atomic<uint64_t> g_buffer_live_bytes(0);
+
+typedef std::shared_ptr<const pfc::array_t<t_uint8>> shared_bytes;
+
+static shared_bytes make_shared_bytes(pfc::array_t<t_uint8>&& data) {
+    const uint64_t size = data.get_size();
+    g_buffer_allocations++;
+    g_buffer_bytes_allocated += size;
+    g_buffer_live++;
+    g_buffer_live_bytes += size;
+
+    return shared_bytes(new pfc::array_t<t_uint8>(std::move(data)), [](const pfc::array_t<t_uint8>* p) {
+        g_buffer_live--;
+        g_buffer_live_bytes -= p->get_size();
+        delete p;
+    });
+}
+
+image_buffer::image_buffer(pfc::array_t<t_uint8>&& data) {
+    if (data.get_size() > 0) {
+        m_data = make_shared_bytes(std::move(data));
+    }
+}
+
+image_buffer image_buffer::copy_of(const void* data, size_t size) {
+    image_buffer result;
+    if (!data || size == 0) return result;
+
+    pfc::array_t<t_uint8> bytes;
+    bytes.set_size(size);
+    memcpy(bytes.get_ptr(), data, size);
+
+    g_buffer_copies++;
+    g_buffer_bytes_copied += size;
+    result.m_data = make_shared_bytes(std::move(bytes));
+    return result;
+}
+
+image_buffer::stats image_buffer::get_stats() {
+    stats s;
+    s.allocations = g_buffer_allocations;
+    s.bytes_allocated = g_buffer_bytes_allocated;
+    s.copies = g_buffer_copies;
+    s.bytes_copied = g_buffer_bytes_copied;
+    s.live_buffers = g_buffer_live;
+    s.live_bytes = g_buffer_live_bytes;
+    return s;
+}
+
+void image_buffer::log_stats(const char* context) {
+    stats s = get_stats();
+    foo_artwork::log_printf("foo_artwork: Image buffers (%s): %llu allocated (%llu KB), %llu copied (%llu KB), %llu live (%llu KB)",
+        context ? context : "",
+        (unsigned long long)s.allocations, (unsigned long long)(s.bytes_allocated / 1024),
+        (unsigned long long)s.copies, (unsigned long long)(s.bytes_copied / 1024),
+        (unsigned long long)s.live_buffers, (unsigned long long)(s.live_bytes / 1024));
+}
+
+// Read-only IStream that reads straight from the shared bytes instead of
+// copying them into an HGLOBAL first
+class image_buffer_stream : public IStream {
+public:
+    image_buffer_stream(const shared_bytes& data) : m_ref_count(1), m_data(data), m_position(0) {}
+
+    // IUnknown
+    STDMETHODIMP QueryInterface(REFIID riid, void** ppv) override {
+        if (!ppv) return E_POINTER;
+        if (riid == IID_IUnknown || riid == IID_ISequentialStream || riid == IID_IStream) {
+            *ppv = static_cast<IStream*>(this);
+            AddRef();
+            return S_OK;
+        }
+        *ppv = nullptr;
+        return E_NOINTERFACE;
+    }
+
+    STDMETHODIMP_(ULONG) AddRef() override {
+        return InterlockedIncrement(&m_ref_count);
+    }
+
+    STDMETHODIMP_(ULONG) Release() override {
+        ULONG count = InterlockedDecrement(&m_ref_count);
+        if (count == 0) delete this;
+        return count;
+    }
+
+    // ISequentialStream
+    STDMETHODIMP Read(void* pv, ULONG cb, ULONG* pcbRead) override {
+        if (!pv) return STG_E_INVALIDPOINTER;
+        const size_t size = m_data->get_size();
+        size_t available = m_position < size ? size - (size_t)m_position : 0;
+        ULONG to_read = (ULONG)(cb < available ? cb : available);
+        if (to_read > 0) {
+            memcpy(pv, m_data->get_ptr() + m_position, to_read);
+            m_position += to_read;
+        }
+        if (pcbRead) *pcbRead = to_read;
+        return to_read == cb ? S_OK : S_FALSE;
+    }
+
+    STDMETHODIMP Write(const void*, ULONG, ULONG*) override {
+        return STG_E_ACCESSDENIED;
+    }
+
+    // IStream
+    STDMETHODIMP Seek(LARGE_INTEGER dlibMove, DWORD dwOrigin, ULARGE_INTEGER* plibNewPosition) override {
+        LONGLONG base;
+        switch (dwOrigin) {
+            case STREAM_SEEK_SET: base = 0; break;
+            case STREAM_SEEK_CUR: base = (LONGLONG)m_position; break;
+            case STREAM_SEEK_END: base = (LONGLONG)m_data->get_size(); break;
+            default: return STG_E_INVALIDFUNCTION;
+        }
+        LONGLONG target = base + dlibMove.QuadPart;
+        if (target < 0) return STG_E_INVALIDFUNCTION;
+        m_position = (ULONGLONG)target;
+        if (plibNewPosition) plibNewPosition->QuadPart = m_position;
+        return S_OK;
+    }
+
+    STDMETHODIMP SetSize(ULARGE_INTEGER) override {
+        return STG_E_ACCESSDENIED;
+    }
+
+    STDMETHODIMP CopyTo(IStream* pstm, ULARGE_INTEGER cb, ULARGE_INTEGER* pcbRead, ULARGE_INTEGER* pcbWritten) override {
+        if (!pstm) return STG_E_INVALIDPOINTER;
+        const size_t size = m_data->get_size();
+        ULONGLONG available = m_position < size ? size - m_position : 0;
+        ULONG to_copy = (ULONG)(cb.QuadPart < available ? cb.QuadPart : available);
+        ULONG written = 0;
+        HRESULT hr = S_OK;
+        if (to_copy > 0) {
+            hr = pstm->Write(m_data->get_ptr() + m_position, to_copy, &written);
+            m_position += to_copy;
+        }
+        if (pcbRead) pcbRead->QuadPart = to_copy;
+        if (pcbWritten) pcbWritten->QuadPart = written;
+        return hr;
+    }
+
+    STDMETHODIMP Commit(DWORD) override { return S_OK; }
+    STDMETHODIMP Revert() override { return S_OK; }
+    STDMETHODIMP LockRegion(ULARGE_INTEGER, ULARGE_INTEGER, DWORD) override { return STG_E_INVALIDFUNCTION; }
+    STDMETHODIMP UnlockRegion(ULARGE_INTEGER, ULARGE_INTEGER, DWORD) override { return STG_E_INVALIDFUNCTION; }
+
+    STDMETHODIMP Stat(STATSTG* pstatstg, DWORD) override {
+        if (!pstatstg) return STG_E_INVALIDPOINTER;
+        ZeroMemory(pstatstg, sizeof(STATSTG));
+        pstatstg->type = STGTY_STREAM;
+        pstatstg->cbSize.QuadPart = m_data->get_size();
+        pstatstg->grfMode = STGM_READ;
+        return S_OK;
+    }
+
+    STDMETHODIMP Clone(IStream** ppstm) override {
+        if (!ppstm) return STG_E_INVALIDPOINTER;
+        image_buffer_stream* clone = new image_buffer_stream(m_data);
+        clone->m_position = m_position;
+        *ppstm = clone;
+        return S_OK;
+    }
+
+private:
+    virtual ~image_buffer_stream() {}
+
+    LONG m_ref_count;
+    shared_bytes m_data;
+    ULONGLONG m_position;
+};
+
+IStream* image_buffer::create_stream() const {
+    if (is_empty()) return nullptr;
+    return new image_buffer_stream(m_data);
+}
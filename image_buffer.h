@@ -0,0 +1,43 @@
+#pragma once
+#include "stdafx.h"
+#include <memory>
+
+// Immutable, reference-counted image bytes.
+// Copying an image_buffer only shares the underlying storage, so a downloaded
+// or cached image exists once in memory no matter how many callbacks, cache
+// entries and panels hold on to it.
+class image_buffer {
+public:
+    image_buffer() {}
+
+    // Take ownership of an existing array without copying its contents
+    explicit image_buffer(pfc::array_t<t_uint8>&& data);
+
+    // Allocate a new buffer holding a copy of the given bytes (counted as a copy)
+    static image_buffer copy_of(const void* data, size_t size);
+
+    const t_uint8* get_ptr() const { return m_data ? m_data->get_ptr() : nullptr; }
+    size_t get_size() const { return m_data ? m_data->get_size() : 0; }
+    bool is_empty() const { return get_size() == 0; }
+    void reset() { m_data.reset(); }
+
+    // Read-only IStream over the shared bytes for GDI+/WIC decoding.
+    // The stream keeps the buffer alive, so it can outlive this image_buffer.
+    // Returns nullptr if the buffer is empty. Caller must Release().
+    IStream* create_stream() const;
+
+    // Process-wide allocation counters
+    struct stats {
+        uint64_t allocations;       // Buffers created (adopted or copied)
+        uint64_t bytes_allocated;   // Total bytes across all created buffers
+        uint64_t copies;            // Buffers created by copying existing bytes
+        uint64_t bytes_copied;
+        uint64_t live_buffers;      // Buffers currently alive
+        uint64_t live_bytes;
+    };
+    static stats get_stats();
+    static void log_stats(const char* context);
+
+private:
+    std::shared_ptr<const pfc::array_t<t_uint8>> m_data;
+};
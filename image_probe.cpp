@@ -0,0 +1,185 @@
+#include "image_probe.h"
+#include <string.h>
+
+static inline unsigned read_be16(const unsigned char* p) {
+    return ((unsigned)p[0] << 8) | p[1];
+}
+
+static inline unsigned read_be32(const unsigned char* p) {
+    return ((unsigned)p[0] << 24) | ((unsigned)p[1] << 16) | ((unsigned)p[2] << 8) | p[3];
+}
+
+static inline unsigned read_le16(const unsigned char* p) {
+    return p[0] | ((unsigned)p[1] << 8);
+}
+
+static inline unsigned read_le24(const unsigned char* p) {
+    return p[0] | ((unsigned)p[1] << 8) | ((unsigned)p[2] << 16);
+}
+
+static inline unsigned read_le32(const unsigned char* p) {
+    return p[0] | ((unsigned)p[1] << 8) | ((unsigned)p[2] << 16) | ((unsigned)p[3] << 24);
+}
+
+static bool probe_jpeg(const unsigned char* data, size_t size, image_probe_info& out) {
+    size_t pos = 2;  // Skip SOI
+
+    while (pos + 4 <= size) {
+        if (data[pos] != 0xFF) return false;
+
+        // Markers may be preceded by any number of 0xFF fill bytes
+        while (pos < size && data[pos] == 0xFF) pos++;
+        if (pos >= size) return false;
+
+        unsigned char marker = data[pos++];
+
+        // Standalone markers carry no length field
+        if (marker == 0x01 || marker == 0xD8 || (marker >= 0xD0 && marker <= 0xD7)) continue;
+
+        // Start of scan / end of image reached without a frame header
+        if (marker == 0xDA || marker == 0xD9) return false;
+
+        if (pos + 2 > size) return false;
+        unsigned segment_length = read_be16(data + pos);
+        if (segment_length < 2) return false;
+
+        // SOF0-SOF15 except DHT (C4), JPG (C8) and DAC (CC)
+        if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+            if (pos + 8 > size) return false;
+            unsigned precision = data[pos + 2];
+            out.height = read_be16(data + pos + 3);
+            out.width = read_be16(data + pos + 5);
+            unsigned components = data[pos + 7];
+            out.bit_depth = precision * components;
+            out.progressive = (marker == 0xC2 || marker == 0xC6 || marker == 0xCA || marker == 0xCE);
+            out.format = image_probe_format::jpeg;
+            return out.width > 0 && out.height > 0;
+        }
+
+        pos += segment_length;
+    }
+
+    return false;
+}
+
+static bool probe_png(const unsigned char* data, size_t size, image_probe_info& out) {
+    // Signature (8) + chunk length (4) + "IHDR" (4) + IHDR payload (13)
+    if (size < 29) return false;
+    if (memcmp(data + 12, "IHDR", 4) != 0) return false;
+
+    out.width = read_be32(data + 16);
+    out.height = read_be32(data + 20);
+
+    unsigned bits_per_sample = data[24];
+    unsigned channels = 1;
+    switch (data[25]) {
+        case 0: channels = 1; break;  // Greyscale
+        case 2: channels = 3; break;  // RGB
+        case 3: channels = 1; break;  // Palette
+        case 4: channels = 2; break;  // Greyscale + alpha
+        case 6: channels = 4; break;  // RGBA
+        default: return false;
+    }
+    out.bit_depth = bits_per_sample * channels;
+    out.progressive = (data[28] == 1);  // Adam7 interlace
+    out.format = image_probe_format::png;
+    return out.width > 0 && out.height > 0;
+}
+
+static bool probe_gif(const unsigned char* data, size_t size, image_probe_info& out) {
+    if (size < 13) return false;
+
+    out.width = read_le16(data + 6);
+    out.height = read_le16(data + 8);
+    out.bit_depth = (data[10] & 0x07) + 1;  // Global colour table size
+    out.progressive = false;
+    out.format = image_probe_format::gif;
+    return out.width > 0 && out.height > 0;
+}
+
+static bool probe_bmp(const unsigned char* data, size_t size, image_probe_info& out) {
+    if (size < 26) return false;
+
+    unsigned header_size = read_le32(data + 14);
+    if (header_size == 12) {
+        // BITMAPCOREHEADER (OS/2 1.x)
+        out.width = read_le16(data + 18);
+        out.height = read_le16(data + 20);
+        out.bit_depth = read_le16(data + 24);
+    } else if (header_size >= 40) {
+        if (size < 30) return false;
+        int width = (int)read_le32(data + 18);
+        int height = (int)read_le32(data + 22);  // Negative height means top-down bitmap
+        if (width <= 0) return false;
+        out.width = (unsigned)width;
+        // Negated as unsigned: -INT_MIN does not fit in an int
+        out.height = height < 0 ? 0u - (unsigned)height : (unsigned)height;
+        out.bit_depth = read_le16(data + 28);
+    } else {
+        return false;
+    }
+
+    out.progressive = false;
+    out.format = image_probe_format::bmp;
+    return out.width > 0 && out.height > 0;
+}
+
+static bool probe_webp(const unsigned char* data, size_t size, image_probe_info& out) {
+    if (size < 30) return false;
+
+    const unsigned char* chunk = data + 12;
+    const unsigned char* payload = data + 20;
+
+    if (memcmp(chunk, "VP8 ", 4) == 0) {
+        // Lossy: 3-byte frame tag followed by start code 9D 01 2A
+        if (payload[3] != 0x9D || payload[4] != 0x01 || payload[5] != 0x2A) return false;
+        out.width = read_le16(payload + 6) & 0x3FFF;
+        out.height = read_le16(payload + 8) & 0x3FFF;
+        out.bit_depth = 24;
+    } else if (memcmp(chunk, "VP8L", 4) == 0) {
+        // Lossless: signature byte then 14-bit width-1 and height-1
+        if (payload[0] != 0x2F) return false;
+        unsigned bits = read_le32(payload + 1);
+        out.width = (bits & 0x3FFF) + 1;
+        out.height = ((bits >> 14) & 0x3FFF) + 1;
+        out.bit_depth = ((bits >> 28) & 1) ? 32 : 24;
+    } else if (memcmp(chunk, "VP8X", 4) == 0) {
+        // Extended: flags, 3 reserved bytes, 24-bit canvas width-1 and height-1
+        out.width = read_le24(payload + 4) + 1;
+        out.height = read_le24(payload + 7) + 1;
+        out.bit_depth = (payload[0] & 0x10) ? 32 : 24;
+    } else {
+        return false;
+    }
+
+    out.progressive = false;
+    out.format = image_probe_format::webp;
+    return out.width > 0 && out.height > 0;
+}
+
+bool probe_image_header(const unsigned char* data, size_t size, image_probe_info& out) {
+    out = image_probe_info();
+    if (!data || size < 4) return false;
+
+    if (data[0] == 0xFF && data[1] == 0xD8) {
+        return probe_jpeg(data, size, out);
+    }
+
+    if (size >= 8 && memcmp(data, "\x89PNG\r\n\x1A\n", 8) == 0) {
+        return probe_png(data, size, out);
+    }
+
+    if (size >= 6 && (memcmp(data, "GIF87a", 6) == 0 || memcmp(data, "GIF89a", 6) == 0)) {
+        return probe_gif(data, size, out);
+    }
+
+    if (data[0] == 'B' && data[1] == 'M') {
+        return probe_bmp(data, size, out);
+    }
+
+    if (size >= 12 && memcmp(data, "RIFF", 4) == 0 && memcmp(data + 8, "WEBP", 4) == 0) {
+        return probe_webp(data, size, out);
+    }
+
+    return false;
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <stddef.h>
+
+// Image container formats recognised by the header probe
+enum class image_probe_format {
+    unknown = 0,
+    jpeg,
+    png,
+    gif,
+    bmp,
+    webp
+};
+
+// Dimensions and basic properties read from an image header without decoding pixels
+struct image_probe_info {
+    image_probe_format format;
+    unsigned width;
+    unsigned height;
+    unsigned bit_depth;     // Bits per pixel across all channels (e.g. 24 for RGB JPEG)
+    bool progressive;       // Progressive JPEG or interlaced PNG
+
+    image_probe_info() : format(image_probe_format::unknown), width(0), height(0), bit_depth(0), progressive(false) {}
+};
+
+// Parse JPEG SOFn, PNG IHDR, GIF logical screen descriptor, BMP info header or
+// WebP VP8/VP8L/VP8X chunk to obtain image dimensions.
+// Returns false if the format is not recognised or the header is truncated/corrupt.
+bool probe_image_header(const unsigned char* data, size_t size, image_probe_info& out);
@@ -0,0 +1,130 @@
+#include "stdafx.h"
+#include "json_extractor.h"
+#include <nlohmann/json.hpp>
+
+json_extractor::json_extractor(const char* record_array_path, std::vector<const char*> record_fields,
+                               std::vector<const char*> header_fields)
+    : m_record_path(record_array_path ? record_array_path : ""), m_stopped(false) {
+    m_record_path += "[]";
+    for (const char* field : record_fields) {
+        m_record_fields.push_back(m_record_path + "." + field);
+    }
+    for (const char* field : header_fields) {
+        m_header_fields.push_back(field);
+    }
+}
+
+// nlohmann SAX interface. The current path is kept in one string that grows and
+// shrinks with the nesting, so matching a value against the schema costs no allocation.
+class json_extractor::sax_handler {
+public:
+    sax_handler(json_extractor& owner, const record_callback& on_record)
+        : m_owner(owner), m_on_record(on_record), m_record_depth(0), m_object_count(0) {}
+
+    bool null() { return true; }
+    bool boolean(bool val) { return value(val ? "true" : "false"); }
+    bool number_integer(nlohmann::json::number_integer_t val) { return value(std::to_string(val)); }
+    bool number_unsigned(nlohmann::json::number_unsigned_t val) { return value(std::to_string(val)); }
+    bool number_float(nlohmann::json::number_float_t, const nlohmann::json::string_t& s) { return value(std::string(s)); }
+    bool string(nlohmann::json::string_t& val) { return value(std::move(val)); }
+
+    // binary_t only exists in newer nlohmann versions; JSON text never produces it
+    template <typename Binary>
+    bool binary(Binary&) { return true; }
+
+    bool start_object(std::size_t) {
+        if (m_record_depth == 0 && m_path == m_owner.m_record_path) {
+            m_record.clear();
+            m_record_depth = m_bases.size() + 1;
+            m_object_count = 0;
+            m_objects.clear();
+        }
+        if (m_record_depth != 0) m_objects.push_back(m_object_count++);
+        m_bases.push_back(m_path.size());
+        return true;
+    }
+
+    bool key(nlohmann::json::string_t& val) {
+        m_path.resize(m_bases.back());
+        if (!m_path.empty()) m_path += '.';
+        m_path += val;
+        return true;
+    }
+
+    bool end_object() {
+        bool ended_record = m_record_depth != 0 && m_bases.size() == m_record_depth;
+        m_path.resize(m_bases.back());
+        m_bases.pop_back();
+        if (m_record_depth != 0) m_objects.pop_back();
+
+        if (ended_record) {
+            m_record_depth = 0;
+            if (m_on_record && !m_on_record(m_record)) {
+                m_owner.m_stopped = true;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool start_array(std::size_t) {
+        m_bases.push_back(m_path.size());
+        m_path += "[]";
+        return true;
+    }
+
+    bool end_array() {
+        m_path.resize(m_bases.back());
+        m_bases.pop_back();
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception&) {
+        return false;
+    }
+
+private:
+    bool value(std::string&& text) {
+        if (m_record_depth != 0) {
+            const auto& fields = m_owner.m_record_fields;
+            for (size_t i = 0; i < fields.size(); i++) {
+                if (fields[i] == m_path) {
+                    m_record.add((int)i, m_objects.back(), std::move(text));
+                    break;
+                }
+            }
+        } else {
+            const auto& fields = m_owner.m_header_fields;
+            for (size_t i = 0; i < fields.size(); i++) {
+                if (fields[i] == m_path) {
+                    m_owner.m_header.add((int)i, 0, std::move(text));
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+
+    json_extractor& m_owner;
+    const record_callback& m_on_record;
+    std::string m_path;
+    std::vector<size_t> m_bases;    // Path length at the start of each open object/array
+    size_t m_record_depth;          // Nesting depth of the open record, 0 if outside one
+    unsigned m_object_count;        // Objects opened so far in the current record
+    std::vector<unsigned> m_objects;    // Number of each open object of the record
+    json_record m_record;
+};
+
+bool json_extractor::parse(const char* data, size_t size, const record_callback& on_record) {
+    m_header.clear();
+    m_stopped = false;
+    if (!data || size == 0) return false;
+
+    try {
+        sax_handler handler(*this, on_record);
+        bool completed = nlohmann::json::sax_parse(data, data + size, &handler);
+        return completed || m_stopped;
+    } catch (...) {
+        return m_stopped;
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include "stdafx.h"
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Values collected for one record by json_extractor, in document order.
+// A field inside a nested array ("releases[].id") can appear several times.
+class json_record {
+public:
+    const std::string* get(int field) const {
+        for (const auto& value : m_values) {
+            if (value.field == field) return &value.text;
+        }
+        return nullptr;
+    }
+
+    template <typename F>
+    void for_each(int field, F&& f) const {
+        for (const auto& value : m_values) {
+            if (value.field == field) f(value.text);
+        }
+    }
+
+    // Every value of first with the value of second from the same JSON object (nullptr if
+    // that object has none), e.g. the id and title of each entry of "releases[]"
+    template <typename F>
+    void for_each_pair(int first, int second, F&& f) const {
+        for (const auto& value : m_values) {
+            if (value.field != first) continue;
+            const std::string* other = nullptr;
+            for (const auto& candidate : m_values) {
+                if (candidate.field == second && candidate.object == value.object) {
+                    other = &candidate.text;
+                    break;
+                }
+            }
+            f(value.text, other);
+        }
+    }
+
+    bool has(int field) const { return get(field) != nullptr; }
+
+    // object numbers the JSON objects of the record in document order, the record itself being 0
+    void add(int field, unsigned object, std::string&& text) { m_values.push_back(value{ field, object, std::move(text) }); }
+    void clear() { m_values.clear(); }
+
+private:
+    struct value {
+        int field;
+        unsigned object;    // Innermost object holding the value
+        std::string text;
+    };
+    std::vector<value> m_values;
+};
+
+// Streaming (SAX) extraction of a few fields from JSON responses, without building
+// a document tree. Records are the objects of one array, e.g. "results" for
+// {"results": [{...}, {...}]}; each is reported as soon as it is complete, and the
+// callback can stop parsing once it has what it needs.
+//
+// Paths use "." between keys and "[]" for array elements: record fields are relative
+// to the record ("artist.name", "releases[].id"), header fields are absolute
+// ("resultCount"). Strings, numbers and booleans are collected as text; field indices
+// are positions in the lists passed to the constructor.
+class json_extractor {
+public:
+    // Return false to stop parsing
+    typedef std::function<bool(const json_record&)> record_callback;
+
+    json_extractor(const char* record_array_path, std::vector<const char*> record_fields,
+                   std::vector<const char*> header_fields = std::vector<const char*>());
+
+    // Returns false if the JSON is malformed before the callback asked to stop
+    bool parse(const char* data, size_t size, const record_callback& on_record);
+
+    // Header fields seen before parsing ended
+    const json_record& header() const { return m_header; }
+    bool stopped_early() const { return m_stopped; }
+
+private:
+    class sax_handler;
+    friend class sax_handler;
+
+    std::string m_record_path;                  // e.g. "results[]"
+    std::vector<std::string> m_record_fields;   // Absolute, e.g. "results[].artist.name"
+    std::vector<std::string> m_header_fields;
+    json_record m_header;
+    bool m_stopped;
+};
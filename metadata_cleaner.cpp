@@ -1,7 +1,10 @@
 #include "stdafx.h"
 #include "metadata_cleaner.h"
+#include "unicode_fold.h"
 #include <algorithm>
 #include <cctype>
+#include <cstring>
+#include <mutex>
 
 // Locale-independent ASCII case conversion helpers
 // Operates exclusively on ASCII characters [A-Za-z] to protect multi-byte UTF-8 sequences
@@ -25,6 +28,39 @@ inline void to_upper_ascii(std::string& s) {
     }
 }
 
+// Cheap pre-checks and replacements for patterns that do not need std::regex.
+// Regexes below are function-level statics, compiled once on first use.
+inline bool has_ascii_digit(const std::string& s) {
+    return s.find_first_of("0123456789") != std::string::npos;
+}
+
+// Equivalent of regex_replace(s, "<marker>.*", "")
+inline void truncate_at(std::string& s, const char* marker) {
+    size_t pos = s.find(marker);
+    if (pos != std::string::npos) s.erase(pos);
+}
+
+// Equivalent of regex_replace(s, "\\s{2,}", " ")
+inline std::string collapse_whitespace_runs(const std::string& s) {
+    auto is_space = [](char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+    };
+    std::string result;
+    result.reserve(s.size());
+    for (size_t i = 0; i < s.size();) {
+        if (!is_space(s[i])) {
+            result.push_back(s[i++]);
+            continue;
+        }
+        size_t run = i;
+        while (run < s.size() && is_space(s[run])) run++;
+        if (run - i >= 2) result.push_back(' ');
+        else result.push_back(s[i]);
+        i = run;
+    }
+    return result;
+}
+
 bool MetadataCleaner::has_non_ascii(const std::string& str) {
     for (unsigned char c : str) {
         if (c >= 0x80) return true;
@@ -171,17 +207,22 @@ std::string MetadataCleaner::strip_track_numbers(const std::string& str) {
 
     std::string result = str;
 
+    // Every pattern needs a digit
+    if (!has_ascii_digit(result)) return trim(result);
+
     // Pattern 1: Leading "Track 01 - ", "Track 05: ", "Faixa 02 - ", "Pista 03. ", "#01 - "
-    result = std::regex_replace(result,
-        std::regex("^\\s*(?:track|faixa|pista|traccia|titel|#)\\s*\\d{1,3}\\s*(?:[:\\.\\-]|\\xE2\\x80\\x93|\\xE2\\x80\\x94)\\s*", std::regex_constants::icase), "");
+    static const std::regex labelled_number_regex(
+        "^\\s*(?:track|faixa|pista|traccia|titel|#)\\s*\\d{1,3}\\s*(?:[:\\.\\-]|\\xE2\\x80\\x93|\\xE2\\x80\\x94)\\s*", std::regex_constants::icase);
+    result = std::regex_replace(result, labelled_number_regex, "");
 
     // Pattern 2: Leading track number with separator: "06. ", "01 - ", "001. ", "1. ", "02: "
-    result = std::regex_replace(result,
-        std::regex("^\\s*\\d{1,3}\\s*(?:[\\.\\-:]|\\xE2\\x80\\x93|\\xE2\\x80\\x94)\\s+"), "");
+    static const std::regex separated_number_regex(
+        "^\\s*\\d{1,3}\\s*(?:[\\.\\-:]|\\xE2\\x80\\x93|\\xE2\\x80\\x94)\\s+");
+    result = std::regex_replace(result, separated_number_regex, "");
 
     // Pattern 3: Leading 2 or 3 digits followed by a space (e.g. "06 Karma Police" -> "Karma Police", "01 Μανταλένα" -> "Μανταλένα")
-    result = std::regex_replace(result,
-        std::regex("^\\s*0\\d{1,2}\\s+"), "");
+    static const std::regex padded_number_regex("^\\s*0\\d{1,2}\\s+");
+    result = std::regex_replace(result, padded_number_regex, "");
 
     return trim(result);
 }
@@ -190,16 +231,24 @@ std::string MetadataCleaner::strip_broadcast_dates(const std::string& str) {
     if (str.empty()) return "";
     std::string result = str;
 
+    // Dates and times all contain digits
+    if (!has_ascii_digit(result)) return trim(result);
+
     // Remove dates like (YYYY-MM-DD), [YYYY.MM.DD], (DD.MM.YYYY), (YYYY/MM/DD)
-    result = std::regex_replace(result,
-        std::regex("[\\(\\[\\s\\-@](?:19\\d\\d|20\\d\\d)[-\\.\\/](?:0?[1-9]|1[0-2])[-\\.\\/](?:0?[1-9]|[12]\\d|3[01])[\\)\\]\\s]?"), " ");
+    static const std::regex year_first_date_regex(
+        "[\\(\\[\\s\\-@](?:19\\d\\d|20\\d\\d)[-\\.\\/](?:0?[1-9]|1[0-2])[-\\.\\/](?:0?[1-9]|[12]\\d|3[01])[\\)\\]\\s]?");
+    result = std::regex_replace(result, year_first_date_regex, " ");
 
-    result = std::regex_replace(result,
-        std::regex("[\\(\\[\\s\\-@](?:0?[1-9]|[12]\\d|3[01])[-\\.\\/](?:0?[1-9]|1[0-2])[-\\.\\/](?:19\\d\\d|20\\d\\d)[\\)\\]\\s]?"), " ");
+    static const std::regex day_first_date_regex(
+        "[\\(\\[\\s\\-@](?:0?[1-9]|[12]\\d|3[01])[-\\.\\/](?:0?[1-9]|1[0-2])[-\\.\\/](?:19\\d\\d|20\\d\\d)[\\)\\]\\s]?");
+    result = std::regex_replace(result, day_first_date_regex, " ");
 
     // Remove broadcast time stamps like "12:30 PM", "14:00 CET", "08:15 UTC"
-    result = std::regex_replace(result,
-        std::regex("\\b\\d{1,2}:\\d{2}(?::\\d{2})?\\s*(?:am|pm|AM|PM|utc|UTC|est|EST|gmt|GMT|cet|CET|edt|EDT|cst|CST)?\\b"), " ");
+    if (result.find(':') != std::string::npos) {
+        static const std::regex broadcast_time_regex(
+            "\\b\\d{1,2}:\\d{2}(?::\\d{2})?\\s*(?:am|pm|AM|PM|utc|UTC|est|EST|gmt|GMT|cet|CET|edt|EDT|cst|CST)?\\b");
+        result = std::regex_replace(result, broadcast_time_regex, " ");
+    }
 
     return trim(result);
 }
@@ -208,17 +257,23 @@ std::string MetadataCleaner::filter_multilingual_keywords(const std::string& str
     if (str.empty()) return "";
     std::string result = str;
 
+    // Every pattern ends its keyword with ':', '-' or an en/em dash (lead byte 0xE2)
+    if (result.find_first_of(":-\xE2") == std::string::npos) return trim(result);
+
     // Strip leading label tags like "Artist: ...", "Artista: ...", "Track - ...", "Faixa: ..."
-    result = std::regex_replace(result,
-        std::regex("^\\s*(?:artist|artista|artiste|k\\xC3\\xBCnstler|interprete|interpr\\xC3\\xA8te|interpret|title|titel|track|piste|traccia|faixa|song)\\s*(?:[:\\-]|\\xE2\\x80\\x93|\\xE2\\x80\\x94)\\s*", std::regex_constants::icase), "");
+    static const std::regex label_tag_regex(
+        "^\\s*(?:artist|artista|artiste|k\\xC3\\xBCnstler|interprete|interpr\\xC3\\xA8te|interpret|title|titel|track|piste|traccia|faixa|song)\\s*(?:[:\\-]|\\xE2\\x80\\x93|\\xE2\\x80\\x94)\\s*", std::regex_constants::icase);
+    result = std::regex_replace(result, label_tag_regex, "");
 
     // Strip inline album / media noise tags like "- Album: OK Computer", "/ CD: Greatest Hits", "• Disco: ..."
-    result = std::regex_replace(result,
-        std::regex("\\s*(?:[\\-\\/\\|~]|\\xE2\\x80\\xA2)\\s*(?:album|\\xC3\\xA1lbum|disco|disque|cd\\d*|dvd|vinyl|disc\\s*\\d*|disk\\s*\\d*)\\s*(?:[:\\-]|\\xE2\\x80\\x93|\\xE2\\x80\\x94)\\s*[^-\\/\\|~]+", std::regex_constants::icase), "");
+    static const std::regex inline_media_tag_regex(
+        "\\s*(?:[\\-\\/\\|~]|\\xE2\\x80\\xA2)\\s*(?:album|\\xC3\\xA1lbum|disco|disque|cd\\d*|dvd|vinyl|disc\\s*\\d*|disk\\s*\\d*)\\s*(?:[:\\-]|\\xE2\\x80\\x93|\\xE2\\x80\\x94)\\s*[^-\\/\\|~]+", std::regex_constants::icase);
+    result = std::regex_replace(result, inline_media_tag_regex, "");
 
     // Strip standalone leading album labels e.g. "Album: ..."
-    result = std::regex_replace(result,
-        std::regex("^\\s*(?:album|\\xC3\\xA1lbum|disco|disque|cd\\d*|dvd|vinyl|disc\\s*\\d*|disk\\s*\\d*)\\s*(?:[:\\-]|\\xE2\\x80\\x93|\\xE2\\x80\\x94)\\s*", std::regex_constants::icase), "");
+    static const std::regex leading_media_tag_regex(
+        "^\\s*(?:album|\\xC3\\xA1lbum|disco|disque|cd\\d*|dvd|vinyl|disc\\s*\\d*|disk\\s*\\d*)\\s*(?:[:\\-]|\\xE2\\x80\\x93|\\xE2\\x80\\x94)\\s*", std::regex_constants::icase);
+    result = std::regex_replace(result, leading_media_tag_regex, "");
 
     return trim(result);
 }
@@ -259,15 +314,15 @@ std::string MetadataCleaner::clean_for_search(const char* metadata, bool preserv
     str = remove_bracketed_content(str, preserve_cyrillic);
 
     // 6. Remove delimiter noise (| , • , ~ , [+])
-    str = std::regex_replace(str, std::regex("\\|.*"), "");
-    str = std::regex_replace(str, std::regex("\\xE2\\x80\\xA2.*"), ""); // UTF-8 bullet •
-
-    std::regex pattern("^(([^~]*~){1}[^~]*)");
-    std::smatch match;
-    if (std::regex_search(str, match, pattern)) {
-        std::string result = match[1];
-        str = result;
-        str = std::regex_replace(str, std::regex("~"), " - ");
+    truncate_at(str, "|");
+    truncate_at(str, "\xE2\x80\xA2"); // UTF-8 bullet •
+
+    // Keep up to the second '~' and turn the first into " - "
+    size_t tilde = str.find('~');
+    if (tilde != std::string::npos) {
+        size_t second_tilde = str.find('~', tilde + 1);
+        if (second_tilde != std::string::npos) str.erase(second_tilde);
+        str.replace(tilde, 1, " - ");
     }
 
     std::replace(str.begin(), str.end(), '_', ' ');
@@ -312,7 +367,7 @@ std::string MetadataCleaner::clean_for_search(const char* metadata, bool preserv
     str = to_title_case(str);
 
     // 9. Clean up whitespace
-    str = std::regex_replace(str, std::regex("\\s{2,}"), " ");
+    str = collapse_whitespace_runs(str);
     str = trim(str);
 
     return str;
@@ -352,11 +407,17 @@ bool MetadataCleaner::is_valid_for_search(const char* artist, const char* title)
         "track", "faixa", "pista", "traccia", "titel", "song", "vinyl", "ep", "lp",
         "unknown", "unknown artist", "unknown track"
     };
-    std::string artist_lower = artist_str;
-    to_lower_ascii(artist_lower);
-
-    for (const auto& bl : blacklist_terms) {
-        if (artist_lower == bl || title_lower == bl) {
+    // Compare case- and accent-folded, so "ÁLBUM", "Kunstler" and "Künstler" all match
+    static const std::vector<std::string> folded_blacklist_terms = [] {
+        std::vector<std::string> folded;
+        for (const auto& bl : blacklist_terms) folded.push_back(unicode_fold(bl));
+        return folded;
+    }();
+    std::string artist_folded = unicode_fold(artist_str);
+    std::string title_folded = unicode_fold(title_str);
+
+    for (const auto& bl : folded_blacklist_terms) {
+        if (artist_folded == bl || title_folded == bl) {
             return false;
         }
     }
@@ -372,23 +433,34 @@ bool MetadataCleaner::is_valid_for_search(const char* artist, const char* title)
 std::string MetadataCleaner::remove_timestamps(const std::string& str) {
     std::string result = str;
     
-    // Remove timestamp patterns at the end
-    // Pattern 1: " - MM:SS" or " - M:SS" (like " - 0:00")
-    result = std::regex_replace(result, std::regex("\\s+-\\s+\\d{1,2}:\\d{2}\\s*$"), "");
-    
-    // Pattern 2: " - MM.SS" or " - M.SS" (like " - 0.00") - handle decimal point
-    result = std::regex_replace(result, std::regex("\\s+-\\s+\\d{1,2}\\.\\d{2}\\s*$"), "");
-    
-    // Remove parenthetical timestamps (MM:SS) or (M:SS)
-    result = std::regex_replace(result, std::regex("\\s*\\(\\d{1,2}:\\d{2}\\)\\s*"), " ");
+    if (has_ascii_digit(result)) {
+        // Remove timestamp patterns at the end
+        // Pattern 1: " - MM:SS" or " - M:SS" (like " - 0:00")
+        static const std::regex trailing_colon_time_regex("\\s+-\\s+\\d{1,2}:\\d{2}\\s*$");
+        result = std::regex_replace(result, trailing_colon_time_regex, "");
+
+        // Pattern 2: " - MM.SS" or " - M.SS" (like " - 0.00") - handle decimal point
+        static const std::regex trailing_dot_time_regex("\\s+-\\s+\\d{1,2}\\.\\d{2}\\s*$");
+        result = std::regex_replace(result, trailing_dot_time_regex, "");
+
+        // Remove parenthetical timestamps (MM:SS) or (M:SS)
+        static const std::regex parenthetical_time_regex("\\s*\\(\\d{1,2}:\\d{2}\\)\\s*");
+        result = std::regex_replace(result, parenthetical_time_regex, " ");
+    }
     
     // Remove everything after pipe | (like "Title || extra || data")
-    result = std::regex_replace(result, std::regex("\\|.*"), "");
+    truncate_at(result, "|");
     
     return result;
 }
 
 std::string MetadataCleaner::remove_parenthetical_content(const std::string& str, bool preserve_cyrillic) {
+    // Every pattern needs an opening parenthesis
+    if (str.find('(') == std::string::npos) return str;
+
+    static const std::regex version_suffix_regex(
+        "\\s*\\([^)]*\\s+(?:remix|remaster|demo|mix|version|edit|cut|rmx)\\)\\s*", std::regex_constants::icase);
+
     // Auto-detect non-Latin (Cyrillic, Greek, etc.) if preserve_cyrillic is true
     bool use_conservative = preserve_cyrillic && (contains_cyrillic(str) || contains_non_latin(str));
     
@@ -397,44 +469,48 @@ std::string MetadataCleaner::remove_parenthetical_content(const std::string& str
         std::string result = str;
         
         // Remove common remix/version patterns (case insensitive)
-        result = std::regex_replace(result,
-            std::regex("\\s*\\([^)]*\\s+(?:remix|remaster|demo|mix|version|edit|cut|rmx)\\)\\s*",
-            std::regex_constants::icase), " ");
+        result = std::regex_replace(result, version_suffix_regex, " ");
         
-        result = std::regex_replace(result, 
-            std::regex("\\s*\\((?:live|acoustic|unplugged|remix|remaster|demo|instrumental|explicit|clean|radio edit|extended|single version|album version|rmx)(?:\\s+[^)]*)?\\)\\s*", 
-            std::regex_constants::icase), " ");
+        static const std::regex version_prefix_regex(
+            "\\s*\\((?:live|acoustic|unplugged|remix|remaster|demo|instrumental|explicit|clean|radio edit|extended|single version|album version|rmx)(?:\\s+[^)]*)?\\)\\s*",
+            std::regex_constants::icase);
+        result = std::regex_replace(result, version_prefix_regex, " ");
         
         // Remove featuring patterns
-        result = std::regex_replace(result,
-            std::regex("\\s*\\((?:feat\\.|featuring|ft\\.|with)\\s+[^)]*\\)\\s*", 
-            std::regex_constants::icase), " ");
+        static const std::regex featuring_regex(
+            "\\s*\\((?:feat\\.|featuring|ft\\.|with)\\s+[^)]*\\)\\s*", std::regex_constants::icase);
+        result = std::regex_replace(result, featuring_regex, " ");
         
         // Remove all remaining parentheses content (aggressive for Latin)
-        result = std::regex_replace(result, std::regex("\\s*\\([^)]*\\)\\s*"), " ");
+        static const std::regex any_parenthetical_regex("\\s*\\([^)]*\\)\\s*");
+        result = std::regex_replace(result, any_parenthetical_regex, " ");
         
         return result;
     } else {
         // Conservative removal for non-Latin scripts - only remove common patterns
         std::string result = str;
         
-        result = std::regex_replace(result,
-            std::regex("\\s*\\([^)]*\\s+(?:remix|remaster|demo|mix|version|edit|cut|rmx)\\)\\s*",
-            std::regex_constants::icase), " ");
+        result = std::regex_replace(result, version_suffix_regex, " ");
         
-        result = std::regex_replace(result,
-            std::regex("\\s*\\((?:remix|remaster|demo|radio edit|extended|rmx)\\)\\s*",
-            std::regex_constants::icase), " ");
+        static const std::regex release_tag_regex(
+            "\\s*\\((?:remix|remaster|demo|radio edit|extended|rmx)\\)\\s*", std::regex_constants::icase);
+        result = std::regex_replace(result, release_tag_regex, " ");
         
-        result = std::regex_replace(result,
-            std::regex("\\s*\\((?:explicit|clean)\\)\\s*",
-            std::regex_constants::icase), " ");
+        static const std::regex explicit_tag_regex(
+            "\\s*\\((?:explicit|clean)\\)\\s*", std::regex_constants::icase);
+        result = std::regex_replace(result, explicit_tag_regex, " ");
             
         return result;
     }
 }
 
 std::string MetadataCleaner::remove_bracketed_content(const std::string& str, bool preserve_cyrillic) {
+    // Every pattern needs an opening bracket
+    if (str.find('[') == std::string::npos) return str;
+
+    static const std::regex version_suffix_regex(
+        "\\s*\\[[^\\]]*\\s+(?:remix|remaster|demo|mix|version|edit|cut|rmx)\\]\\s*", std::regex_constants::icase);
+
     // Auto-detect non-Latin if preserve_cyrillic is true
     bool use_conservative = preserve_cyrillic && (contains_cyrillic(str) || contains_non_latin(str));
     
@@ -442,29 +518,26 @@ std::string MetadataCleaner::remove_bracketed_content(const std::string& str, bo
         // Standard removal for Latin scripts
         std::string result = str;
         
-        result = std::regex_replace(result,
-            std::regex("\\s*\\[[^\\]]*\\s+(?:remix|remaster|demo|mix|version|edit|cut|rmx)\\]\\s*",
-            std::regex_constants::icase), " ");
+        result = std::regex_replace(result, version_suffix_regex, " ");
         
-        result = std::regex_replace(result,
-            std::regex("\\s*\\[(?:remix|remaster|demo|radio edit|extended|rmx)[^\\]]*\\]\\s*",
-            std::regex_constants::icase), " ");
+        static const std::regex release_prefix_regex(
+            "\\s*\\[(?:remix|remaster|demo|radio edit|extended|rmx)[^\\]]*\\]\\s*", std::regex_constants::icase);
+        result = std::regex_replace(result, release_prefix_regex, " ");
         
         // Remove all remaining brackets content (aggressive for Latin)
-        result = std::regex_replace(result, std::regex("\\s*\\[[^\\]]*\\]\\s*"), " ");
+        static const std::regex any_bracketed_regex("\\s*\\[[^\\]]*\\]\\s*");
+        result = std::regex_replace(result, any_bracketed_regex, " ");
         
         return result;
     } else {
         // Conservative removal for non-Latin scripts
         std::string result = str;
         
-        result = std::regex_replace(result,
-            std::regex("\\s*\\[[^\\]]*\\s+(?:remix|remaster|demo|mix|version|edit|cut|rmx)\\]\\s*",
-            std::regex_constants::icase), " ");
+        result = std::regex_replace(result, version_suffix_regex, " ");
         
-        result = std::regex_replace(result,
-            std::regex("\\s*\\[(?:remix|remaster|demo|radio edit|extended|rmx)\\]\\s*",
-            std::regex_constants::icase), " ");
+        static const std::regex release_tag_regex(
+            "\\s*\\[(?:remix|remaster|demo|radio edit|extended|rmx)\\]\\s*", std::regex_constants::icase);
+        result = std::regex_replace(result, release_tag_regex, " ");
             
         return result;
     }
@@ -526,15 +599,17 @@ std::string MetadataCleaner::normalize_collaborations(const std::string& str) {
     }
     
     // Normalize & patterns (be careful not to break band names)
-    result = std::regex_replace(result, std::regex("\\s+&\\s+"), " & ");
+    if (result.find('&') != std::string::npos) {
+        static const std::regex ampersand_regex("\\s+&\\s+");
+        result = std::regex_replace(result, ampersand_regex, " & ");
+    }
     
     return result;
 }
 
 std::string MetadataCleaner::normalize_whitespace(const std::string& str) {
     // Clean up multiple spaces (safe for all character encodings)
-    std::string result = std::regex_replace(str, std::regex("\\s{2,}"), " ");
-    return result;
+    return collapse_whitespace_runs(str);
 }
 
 bool MetadataCleaner::contains_cyrillic(const std::string& str) {
@@ -824,9 +899,37 @@ std::string MetadataCleaner::extract_primary_title(const char* title) {
 }
 
 StreamMetadataResult MetadataCleaner::sanitize_stream_metadata(const char* raw_artist, const char* raw_title) {
+    // One track change sanitizes the same pair from several pipeline stages, and ICY
+    // updates repeat it; keep a small most-recently-used list of results
+    static const size_t max_cached_results = 16;
+    static std::mutex cache_mutex;
+    static std::vector<StreamMetadataResult> cache;
+
+    std::string artist_str = raw_artist ? raw_artist : "";
+    std::string title_str = raw_title ? raw_title : "";
+
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        for (size_t i = 0; i < cache.size(); i++) {
+            if (cache[i].raw_artist == artist_str && cache[i].raw_title == title_str) {
+                if (i > 0) std::rotate(cache.begin(), cache.begin() + i, cache.begin() + i + 1);
+                return cache.front();
+            }
+        }
+    }
+
+    StreamMetadataResult res = compute_stream_metadata(artist_str, title_str);
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    cache.insert(cache.begin(), res);
+    if (cache.size() > max_cached_results) cache.pop_back();
+    return res;
+}
+
+StreamMetadataResult MetadataCleaner::compute_stream_metadata(const std::string& raw_artist, const std::string& raw_title) {
     StreamMetadataResult res;
-    res.raw_artist = raw_artist ? raw_artist : "";
-    res.raw_title = raw_title ? raw_title : "";
+    res.raw_artist = raw_artist;
+    res.raw_title = raw_title;
 
     // Stage 1: Noise Pre-Cleaning & Station/URL Detection
     res.is_station_or_url = is_station_name_or_url(res.raw_artist.c_str()) || is_station_name_or_url(res.raw_title.c_str());
@@ -22,6 +22,7 @@ struct StreamMetadataResult {
 class MetadataCleaner {
 public:
     // Main 4-Stage Stream Metadata Sanitizer
+    // Results are memoized for the last few raw artist/title pairs; safe to call from any thread
     static StreamMetadataResult sanitize_stream_metadata(const char* raw_artist, const char* raw_title);
 
     // Station name / stream URL detector
@@ -53,6 +54,9 @@ public:
     static std::string filter_multilingual_keywords(const std::string& str);
     
 private:
+    // Uncached sanitizer behind sanitize_stream_metadata
+    static StreamMetadataResult compute_stream_metadata(const std::string& raw_artist, const std::string& raw_title);
+
     // Core cleaning operations - UTF-8 safe
     static std::string remove_timestamps(const std::string& str);
     static std::string remove_parenthetical_content(const std::string& str, bool preserve_cyrillic = true);
@@ -1,6 +1,8 @@
 #include "stdafx.h"
 #include "resource.h"
 #include "async_io_manager.h"
+#include "host_rate_limiter.h"
+#include "titleformat_provider.h"
 #include <commdlg.h>  // For file save dialog
 #include <shlobj.h>   // For folder browser dialog (still needed for directory extraction)
 
@@ -21,6 +23,10 @@ extern cfg_string cfg_noart_folder;
 extern cfg_int cfg_noart_cycle_mode;
 extern cfg_int cfg_http_timeout;
 extern cfg_int cfg_retry_count;
+extern cfg_int cfg_min_artwork_size;
+extern cfg_bool cfg_full_resolution_artwork;
+extern cfg_int cfg_max_artwork_download_size;
+extern cfg_string cfg_host_rate_limits;
 extern cfg_bool cfg_enable_disk_cache;
 extern cfg_bool cfg_single_file_cache;
 extern cfg_string cfg_cache_folder;
@@ -380,6 +386,7 @@ void artwork_preferences::apply_settings() {
         if (disk_cache_selection == 3) {
             // Clear all cached artwork files, then revert to previous state
             async_io_manager::instance().cache_clear_all();
+            titleformat_provider::forget_recorded_artwork();
             int revert_sel = cfg_enable_disk_cache ? (cfg_single_file_cache ? 1 : 0) : 2;
             SendMessage(GetDlgItem(m_hwnd, IDC_ENABLE_DISK_CACHE), CB_SETCURSEL, revert_sel, 0);
             EnableWindow(GetDlgItem(m_hwnd, IDC_BROWSE_CACHE_FOLDER), (revert_sel == 0 || revert_sel == 1) ? TRUE : FALSE);
@@ -619,8 +626,26 @@ bool artwork_advanced_preferences::has_changed() {
     int current_retry = GetDlgItemInt(m_hwnd, IDC_RETRY_COUNT, NULL, FALSE);
     bool retry_changed = current_retry != cfg_retry_count;
 
+    // Check if minimum artwork size changed
+    int current_min_size = GetDlgItemInt(m_hwnd, IDC_MIN_ARTWORK_SIZE, NULL, FALSE);
+    bool min_size_changed = current_min_size != cfg_min_artwork_size;
+
+    // Check if full resolution checkbox changed
+    bool full_resolution_changed = (IsDlgButtonChecked(m_hwnd, IDC_FULL_RESOLUTION_ARTWORK) == BST_CHECKED) != cfg_full_resolution_artwork;
+
+    // Check if maximum download size changed
+    int current_max_download = GetDlgItemInt(m_hwnd, IDC_MAX_DOWNLOAD_SIZE, NULL, FALSE);
+    bool max_download_changed = current_max_download != cfg_max_artwork_download_size;
+
+    // Check if rate limits changed (empty setting shows the defaults)
+    char current_rate_limits[512];
+    GetDlgItemTextA(m_hwnd, IDC_RATE_LIMITS, current_rate_limits, sizeof(current_rate_limits));
+    const char* saved_rate_limits = cfg_host_rate_limits.is_empty() ? host_rate_limiter::default_limits() : cfg_host_rate_limits.get_ptr();
+    bool rate_limits_changed = strcmp(current_rate_limits, saved_rate_limits) != 0;
+
     return enable_logos_changed || folder_changed || noart_folder_changed || cycle_mode_changed ||
-           clear_panel_changed || use_noart_changed || infobar_changed || timeout_changed || retry_changed;
+           clear_panel_changed || use_noart_changed || infobar_changed || timeout_changed || retry_changed ||
+           min_size_changed || full_resolution_changed || max_download_changed || rate_limits_changed;
 }
 
 void artwork_advanced_preferences::apply_settings() {
@@ -666,6 +691,26 @@ void artwork_advanced_preferences::apply_settings() {
     if (retry > 5) retry = 5;
     cfg_retry_count = retry;
 
+    // Apply minimum artwork size setting (clamp to valid range 0-1000 pixels)
+    int min_size = GetDlgItemInt(m_hwnd, IDC_MIN_ARTWORK_SIZE, NULL, FALSE);
+    if (min_size < 0) min_size = 0;
+    if (min_size > 1000) min_size = 1000;
+    cfg_min_artwork_size = min_size;
+
+    // Apply full resolution artwork setting
+    cfg_full_resolution_artwork = (IsDlgButtonChecked(m_hwnd, IDC_FULL_RESOLUTION_ARTWORK) == BST_CHECKED);
+
+    // Apply maximum download size setting (clamp to valid range 0-100 MB)
+    int max_download = GetDlgItemInt(m_hwnd, IDC_MAX_DOWNLOAD_SIZE, NULL, FALSE);
+    if (max_download < 0) max_download = 0;
+    if (max_download > 100) max_download = 100;
+    cfg_max_artwork_download_size = max_download;
+
+    // Apply rate limits (unchanged defaults are stored as empty so future default updates apply)
+    char rate_limits[512];
+    GetDlgItemTextA(m_hwnd, IDC_RATE_LIMITS, rate_limits, sizeof(rate_limits));
+    cfg_host_rate_limits = (strcmp(rate_limits, host_rate_limiter::default_limits()) == 0) ? "" : rate_limits;
+
     // Update timers for all UI elements when setting changes
     update_all_clear_panel_timers();
 }
@@ -683,6 +728,10 @@ void artwork_advanced_preferences::reset_settings() {
     cfg_use_noart_image = false;  // Default disabled
     cfg_http_timeout = 15;  // Default 15 seconds
     cfg_retry_count = 2;  // Default 2 retries
+    cfg_min_artwork_size = 100;  // Default 100 pixels
+    cfg_full_resolution_artwork = false;  // Default disabled (size to panel)
+    cfg_max_artwork_download_size = 10;  // Default 10 MB
+    cfg_host_rate_limits = "";  // Default built-in limits
 
     update_controls();
 }
@@ -722,6 +771,18 @@ void artwork_advanced_preferences::update_controls() {
     // Update retry count field
     SetDlgItemInt(m_hwnd, IDC_RETRY_COUNT, cfg_retry_count, FALSE);
 
+    // Update minimum artwork size field
+    SetDlgItemInt(m_hwnd, IDC_MIN_ARTWORK_SIZE, cfg_min_artwork_size, FALSE);
+
+    // Update full resolution artwork checkbox
+    CheckDlgButton(m_hwnd, IDC_FULL_RESOLUTION_ARTWORK, cfg_full_resolution_artwork ? BST_CHECKED : BST_UNCHECKED);
+
+    // Update maximum download size field
+    SetDlgItemInt(m_hwnd, IDC_MAX_DOWNLOAD_SIZE, cfg_max_artwork_download_size, FALSE);
+
+    // Update rate limits field
+    SetDlgItemTextA(m_hwnd, IDC_RATE_LIMITS, cfg_host_rate_limits.is_empty() ? host_rate_limiter::default_limits() : cfg_host_rate_limits.get_ptr());
+
     // Enable/disable noart image checkbox based on clear panel checkbox state
     EnableWindow(GetDlgItem(m_hwnd, IDC_USE_NOART_IMAGE), cfg_clear_panel_when_not_playing ? TRUE : FALSE);
 
@@ -813,6 +874,7 @@ INT_PTR CALLBACK artwork_advanced_preferences::AdvancedConfigProc(HWND hwnd, UIN
                 break;
 
             case IDC_USE_NOART_IMAGE:
+            case IDC_FULL_RESOLUTION_ARTWORK:
                 if (HIWORD(wp) == BN_CLICKED) {
                     pThis->on_changed();
                 }
@@ -859,6 +921,14 @@ INT_PTR CALLBACK artwork_advanced_preferences::AdvancedConfigProc(HWND hwnd, UIN
                     pThis->on_changed();
                 }
                 break;
+
+            case IDC_MIN_ARTWORK_SIZE:
+            case IDC_MAX_DOWNLOAD_SIZE:
+            case IDC_RATE_LIMITS:
+                if (HIWORD(wp) == EN_CHANGE) {
+                    pThis->on_changed();
+                }
+                break;
             }
             break;
         }
@@ -0,0 +1,227 @@
+#include "stdafx.h"
+#include "provider_health.h"
+#include "foo_artwork_log.h"
+#include <algorithm>
+#include <cctype>
+
+extern cfg_int cfg_http_timeout;
+
+// Consecutive failed attempts that open the breaker
+static const int BREAKER_FAILURE_THRESHOLD = 3;
+
+// Cooldown after the first trip; doubles on each failed probe up to the maximum
+static const int BREAKER_BASE_COOLDOWN_SECONDS = 30;
+static const int BREAKER_MAX_COOLDOWN_SECONDS = 600;
+
+// Samples needed before the dynamic timeout replaces the configured one
+static const unsigned MIN_LATENCY_SAMPLES = 20;
+
+// Lower bound for dynamic timeouts so a fast provider still tolerates a slow response
+static const int MIN_DYNAMIC_TIMEOUT_SECONDS = 3;
+
+// Halve all counts once this many samples are held so the histogram follows recent behaviour
+static const unsigned HISTOGRAM_DECAY_TOTAL = 2000;
+
+latency_histogram::latency_histogram() : m_total(0) {
+    memset(m_counts, 0, sizeof(m_counts));
+}
+
+int latency_histogram::bucket_index(unsigned value) {
+    if (value < SUB_BUCKET_COUNT) return (int)value;
+
+    int msb = 0;
+    for (unsigned v = value; v > 1; v >>= 1) msb++;
+
+    int sub = (int)((value >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1));
+    int index = (msb - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + sub;
+    return (std::min)(index, BUCKET_COUNT - 1);
+}
+
+unsigned latency_histogram::bucket_upper_bound(int index) {
+    if (index < SUB_BUCKET_COUNT) return (unsigned)index;
+
+    int msb = index / SUB_BUCKET_COUNT + SUB_BUCKET_BITS - 1;
+    int sub = index % SUB_BUCKET_COUNT;
+    unsigned width = 1u << (msb - SUB_BUCKET_BITS);
+    return ((unsigned)(SUB_BUCKET_COUNT + sub) << (msb - SUB_BUCKET_BITS)) + width - 1;
+}
+
+void latency_histogram::record(unsigned milliseconds) {
+    m_counts[bucket_index(milliseconds)]++;
+    m_total++;
+
+    if (m_total >= HISTOGRAM_DECAY_TOTAL) {
+        m_total = 0;
+        for (int i = 0; i < BUCKET_COUNT; i++) {
+            m_counts[i] /= 2;
+            m_total += m_counts[i];
+        }
+    }
+}
+
+unsigned latency_histogram::percentile(double p) const {
+    if (m_total == 0) return 0;
+
+    unsigned target = (unsigned)(p / 100.0 * m_total + 0.5);
+    if (target < 1) target = 1;
+
+    unsigned cumulative = 0;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        cumulative += m_counts[i];
+        if (cumulative >= target) return bucket_upper_bound(i);
+    }
+    return bucket_upper_bound(BUCKET_COUNT - 1);
+}
+
+provider_health& provider_health::instance() {
+    static provider_health instance;
+    return instance;
+}
+
+const char* provider_health::provider_for_url(const pfc::string8& url) {
+    std::string lower(url.c_str());
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return (char)tolower(c); });
+
+    size_t host_start = lower.find("://");
+    host_start = (host_start == std::string::npos) ? 0 : host_start + 3;
+    size_t host_end = lower.find_first_of("/?:", host_start);
+    std::string host = lower.substr(host_start, host_end == std::string::npos ? std::string::npos : host_end - host_start);
+
+    auto host_is = [&host](const char* domain) {
+        size_t len = strlen(domain);
+        if (host.size() < len || host.compare(host.size() - len, len, domain) != 0) return false;
+        return host.size() == len || host[host.size() - len - 1] == '.';
+    };
+
+    // API hosts and the image CDNs each provider links to
+    if (host_is("itunes.apple.com") || host_is("mzstatic.com")) return "iTunes";
+    if (host_is("deezer.com") || host_is("dzcdn.net")) return "Deezer";
+    if (host_is("audioscrobbler.com") || host_is("last.fm") || host_is("lastfm.freetls.fastly.net")) return "Last.fm";
+    if (host_is("musicbrainz.org") || host_is("coverartarchive.org")) return "MusicBrainz";
+    if (host_is("discogs.com")) return "Discogs";
+
+    return "";
+}
+
+void provider_health::trip(provider_state& s, const char* provider) {
+    // Caller holds m_mutex
+    int cooldown = BREAKER_BASE_COOLDOWN_SECONDS << (std::min)(s.open_count, 5);
+    if (cooldown > BREAKER_MAX_COOLDOWN_SECONDS) cooldown = BREAKER_MAX_COOLDOWN_SECONDS;
+
+    s.state = breaker_state::open;
+    s.open_until = std::chrono::steady_clock::now() + std::chrono::seconds(cooldown);
+    s.open_count++;
+    s.probe_in_flight = false;
+
+    foo_artwork::log_printf("foo_artwork: %s failing (%d consecutive errors) - skipping it for %d s", provider, s.consecutive_failures, cooldown);
+}
+
+void provider_health::record_attempt(const pfc::string8& url, bool responded, unsigned latency_ms) {
+    const char* provider = provider_for_url(url);
+    if (!*provider) return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    provider_state& s = m_providers[provider];
+
+    if (responded) {
+        s.latency.record(latency_ms);
+        s.consecutive_failures = 0;
+        if (s.state != breaker_state::closed) {
+            foo_artwork::log_printf("foo_artwork: %s responding again - resuming normal queries", provider);
+        }
+        s.state = breaker_state::closed;
+        s.open_count = 0;
+        s.probe_in_flight = false;
+        return;
+    }
+
+    s.consecutive_failures++;
+    if (s.state == breaker_state::half_open) {
+        // Failed probe - back to open with a longer cooldown
+        trip(s, provider);
+    } else if (s.state == breaker_state::closed && s.consecutive_failures >= BREAKER_FAILURE_THRESHOLD) {
+        trip(s, provider);
+    }
+}
+
+int provider_health::dynamic_timeout(const provider_state& s, int configured_seconds) {
+    if (s.latency.count() < MIN_LATENCY_SAMPLES) return configured_seconds;
+
+    // 1.5x the p99 latency, rounded up to whole seconds
+    unsigned p99_ms = s.latency.percentile(99.0);
+    int dynamic_seconds = (int)((p99_ms * 3 / 2 + 999) / 1000);
+    if (dynamic_seconds < MIN_DYNAMIC_TIMEOUT_SECONDS) dynamic_seconds = MIN_DYNAMIC_TIMEOUT_SECONDS;
+    return (std::min)(dynamic_seconds, configured_seconds);
+}
+
+int provider_health::timeout_seconds(const pfc::string8& url, int configured_seconds) {
+    const char* provider = provider_for_url(url);
+    if (!*provider) return configured_seconds;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_providers.find(provider);
+    if (it == m_providers.end()) return configured_seconds;
+    return dynamic_timeout(it->second, configured_seconds);
+}
+
+bool provider_health::allow_request(const char* provider) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_providers.find(provider);
+    if (it == m_providers.end()) return true;
+
+    provider_state& s = it->second;
+    auto now = std::chrono::steady_clock::now();
+
+    switch (s.state) {
+        case breaker_state::closed:
+            return true;
+
+        case breaker_state::open:
+            if (now < s.open_until) return false;
+            s.state = breaker_state::half_open;
+            s.probe_in_flight = false;
+            // fall through
+
+        case breaker_state::half_open:
+            // One probe at a time; a probe that never reported back is replaced after a minute
+            if (s.probe_in_flight && now - s.probe_started < std::chrono::seconds(60)) return false;
+            s.probe_in_flight = true;
+            s.probe_started = now;
+            foo_artwork::log_printf("foo_artwork: Probing %s after cooldown", provider);
+            return true;
+    }
+    return true;
+}
+
+void provider_health::describe(pfc::string8& out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto now = std::chrono::steady_clock::now();
+    int configured_seconds = (std::max)(1, (int)cfg_http_timeout.get_value());
+
+    out.reset();
+    for (auto& entry : m_providers) {
+        provider_state& s = entry.second;
+
+        out << entry.first.c_str() << ": ";
+        switch (s.state) {
+            case breaker_state::closed: out << "closed"; break;
+            case breaker_state::half_open: out << "half-open"; break;
+            case breaker_state::open: {
+                auto remaining = std::chrono::duration_cast<std::chrono::seconds>(s.open_until - now).count();
+                out << "open (" << (int)(remaining > 0 ? remaining : 0) << " s left)";
+                break;
+            }
+        }
+        out << ", " << s.consecutive_failures << " consecutive failures, " << s.latency.count() << " samples";
+        if (s.latency.count() > 0) {
+            out << ", p50 " << s.latency.percentile(50.0) << " ms"
+                << ", p90 " << s.latency.percentile(90.0) << " ms"
+                << ", p99 " << s.latency.percentile(99.0) << " ms";
+        }
+        out << ", timeout " << dynamic_timeout(s, configured_seconds) << " s";
+        out << "\n";
+    }
+    if (m_providers.empty()) {
+        out << "No provider requests recorded yet\n";
+    }
+}
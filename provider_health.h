@@ -0,0 +1,76 @@
+#pragma once
+#include "stdafx.h"
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+
+// Latency histogram with HDR-style log-linear buckets: 8 linear sub-buckets per
+// power of two, giving ~12% relative precision from 1 ms up to ~4 minutes.
+class latency_histogram {
+public:
+    latency_histogram();
+
+    void record(unsigned milliseconds);
+    unsigned percentile(double p) const;   // Upper bound of the bucket holding the p-th percentile (0 if empty)
+    unsigned count() const { return m_total; }
+
+private:
+    static const int SUB_BUCKET_BITS = 3;
+    static const int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static const int BUCKET_COUNT = 128;
+
+    static int bucket_index(unsigned value);
+    static unsigned bucket_upper_bound(int index);
+
+    unsigned m_counts[BUCKET_COUNT];
+    unsigned m_total;
+};
+
+// Per-provider health tracking: latency percentiles drive the HTTP timeout for
+// each provider, and a circuit breaker skips providers that keep failing.
+class provider_health {
+public:
+    static provider_health& instance();
+
+    // Provider name ("iTunes", "Deezer", ...) that owns a URL, empty if none
+    static const char* provider_for_url(const pfc::string8& url);
+
+    // Record one HTTP attempt. responded = the server produced a usable status
+    // (anything except transport errors, 5xx and 429).
+    void record_attempt(const pfc::string8& url, bool responded, unsigned latency_ms);
+
+    // Timeout for the next attempt to this URL's provider, derived from its p99
+    // latency and never above the configured timeout
+    int timeout_seconds(const pfc::string8& url, int configured_seconds);
+
+    // Circuit breaker check used before querying a provider. While open the
+    // provider is skipped; once the cooldown ends a single probe is let through.
+    bool allow_request(const char* provider);
+
+    // Human readable snapshot of every provider for diagnostics
+    void describe(pfc::string8& out);
+
+private:
+    provider_health() {}
+
+    enum class breaker_state { closed, open, half_open };
+
+    struct provider_state {
+        latency_histogram latency;
+        breaker_state state;
+        int consecutive_failures;
+        int open_count;             // Consecutive trips, lengthens the cooldown
+        std::chrono::steady_clock::time_point open_until;
+        std::chrono::steady_clock::time_point probe_started;
+        bool probe_in_flight;
+
+        provider_state() : state(breaker_state::closed), consecutive_failures(0), open_count(0), probe_in_flight(false) {}
+    };
+
+    void trip(provider_state& s, const char* provider);
+    static int dynamic_timeout(const provider_state& s, int configured_seconds);
+
+    std::mutex m_mutex;
+    std::map<std::string, provider_state> m_providers;
+};
@@ -50,6 +50,13 @@
 #define IDC_STATIC_LOGOS_DESC2          1045
 #define IDC_STATIC_LOGOS_DESC3          1046
 #define IDC_STATIC_LOGOS_DESC4          1047
+#define IDC_MIN_ARTWORK_SIZE            1048
+#define IDC_STATIC_MIN_ARTWORK_SIZE     1049
+#define IDC_FULL_RESOLUTION_ARTWORK     1050
+#define IDC_MAX_DOWNLOAD_SIZE           1051
+#define IDC_STATIC_MAX_DOWNLOAD_SIZE    1052
+#define IDC_RATE_LIMITS                 1053
+#define IDC_STATIC_RATE_LIMITS          1054
 
 // Next default values for new objects
 //
@@ -57,7 +64,7 @@
 #ifndef APSTUDIO_READONLY_SYMBOLS
 #define _APS_NEXT_RESOURCE_VALUE        104
 #define _APS_NEXT_COMMAND_VALUE         40001
-#define _APS_NEXT_CONTROL_VALUE         1048
+#define _APS_NEXT_CONTROL_VALUE         1055
 #define _APS_NEXT_SYMED_VALUE           101
 #endif
 #endif
@@ -4,6 +4,10 @@
 #include "preferences.h"
 #include "webp_decoder.h"
 #include "titleformat_provider.h"
+#include "host_rate_limiter.h"
+#include "provider_health.h"
+#include "titleformat_script_cache.h"
+#include "artwork_events.h"
 #include <algorithm>
 #include <random>
 #include <atomic>
@@ -82,6 +86,10 @@ static constexpr GUID guid_cfg_acrcloud_access_secret = { 0x12345698, 0x1234, 0x
 static constexpr GUID guid_cfg_console_logging_mode = { 0x12345699, 0x1234, 0x1234, { 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xdf, 0x08 } };
 static constexpr GUID guid_cfg_noart_folder = { 0x1234569a, 0x1234, 0x1234, { 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xdf, 0x09 } };
 static constexpr GUID guid_cfg_noart_cycle_mode = { 0x1234569b, 0x1234, 0x1234, { 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xdf, 0x0a } };
+static constexpr GUID guid_cfg_min_artwork_size = { 0x1234569c, 0x1234, 0x1234, { 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xdf, 0x0b } };
+static constexpr GUID guid_cfg_full_resolution_artwork = { 0x1234569d, 0x1234, 0x1234, { 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xdf, 0x0c } };
+static constexpr GUID guid_cfg_max_artwork_download_size = { 0x1234569e, 0x1234, 0x1234, { 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xdf, 0x0d } };
+static constexpr GUID guid_cfg_host_rate_limits = { 0x1234569f, 0x1234, 0x1234, { 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xdf, 0x0e } };
 
 // Configuration variables with default values
 cfg_bool cfg_enable_itunes(guid_cfg_enable_itunes, false);
@@ -130,6 +138,18 @@ cfg_bool cfg_infobar(guid_cfg_infobar, false);  // DUI infobar (default disabled
 cfg_int cfg_http_timeout(guid_cfg_http_timeout, 15);  // HTTP timeout in seconds (default 15)
 cfg_int cfg_retry_count(guid_cfg_retry_count, 2);  // Number of retries for failed requests (default 2)
 
+// Minimum accepted artwork width/height in pixels for online results (0 = accept any size)
+cfg_int cfg_min_artwork_size(guid_cfg_min_artwork_size, 100);
+
+// Always download full resolution artwork instead of sizing it to the largest panel
+cfg_bool cfg_full_resolution_artwork(guid_cfg_full_resolution_artwork, false);
+
+// Maximum artwork download size in MB; larger transfers are aborted (0 = unlimited)
+cfg_int cfg_max_artwork_download_size(guid_cfg_max_artwork_download_size, 10);
+
+// Per-service request limits in requests per minute (empty = built-in defaults)
+cfg_string cfg_host_rate_limits(guid_cfg_host_rate_limits, "");
+
 // Disk cache setting
 cfg_bool cfg_enable_disk_cache(guid_cfg_enable_disk_cache, true);  // Enable disk caching (default enabled)
 cfg_string cfg_cache_folder(guid_cfg_cache_folder, "");  // Custom cache folder path (empty = use default)
@@ -147,90 +167,6 @@ cfg_bool cfg_single_file_cache(guid_cfg_single_file_cache, false);  // Single fi
 cfg_uint cfg_cache_size(guid_cfg_cache_size, 1000);
 
 
-//=============================================================================
-// Event-Driven Artwork System
-//=============================================================================
-
-// Artwork event types
-enum class ArtworkEventType {
-    ARTWORK_LOADED,     // New artwork loaded successfully
-    ARTWORK_LOADING,    // Search started
-    ARTWORK_FAILED,     // Search failed
-    ARTWORK_CLEARED     // Artwork cleared
-};
-
-// Artwork event data
-struct ArtworkEvent {
-    ArtworkEventType type;
-    HBITMAP bitmap;
-    std::string source;
-    std::string artist;
-    std::string title;
-    
-    ArtworkEvent(ArtworkEventType t, HBITMAP bmp = nullptr, const std::string& src = "", 
-                 const std::string& art = "", const std::string& ttl = "")
-        : type(t), bitmap(bmp), source(src), artist(art), title(ttl) {}
-};
-
-// Artwork event listener interface
-class IArtworkEventListener {
-public:
-    virtual ~IArtworkEventListener() = default;
-    virtual void on_artwork_event(const ArtworkEvent& event) = 0;
-};
-
-// Artwork event manager (singleton)
-class ArtworkEventManager {
-private:
-    std::vector<IArtworkEventListener*> m_listeners;
-    std::mutex m_listeners_mutex;
-    static std::unique_ptr<ArtworkEventManager> s_instance;
-    
-public:
-    static ArtworkEventManager& get() {
-        if (!s_instance) {
-            s_instance = std::make_unique<ArtworkEventManager>();
-        }
-        return *s_instance;
-    }
-    
-    void subscribe(IArtworkEventListener* listener) {
-        std::lock_guard<std::mutex> lock(m_listeners_mutex);
-        m_listeners.push_back(listener);
-    }
-    
-    void unsubscribe(IArtworkEventListener* listener) {
-        std::lock_guard<std::mutex> lock(m_listeners_mutex);
-        m_listeners.erase(std::remove(m_listeners.begin(), m_listeners.end(), listener), m_listeners.end());
-    }
-    
-    void clear() {
-        std::lock_guard<std::mutex> lock(m_listeners_mutex);
-        m_listeners.clear();
-    }
-    
-    void notify(const ArtworkEvent& event) {
-        if (g_is_shutting_down.load() || core_api::is_shutting_down()) return;
-        std::vector<IArtworkEventListener*> listeners_copy;
-        {
-            std::lock_guard<std::mutex> lock(m_listeners_mutex);
-            listeners_copy = m_listeners;
-        }
-        for (auto* listener : listeners_copy) {
-            if (g_is_shutting_down.load() || core_api::is_shutting_down()) return;
-            try {
-                if (listener) {
-                    listener->on_artwork_event(event);
-                }
-            } catch (...) {
-                // Continue notifying other listeners even if one fails
-            }
-        }
-    }
-};
-
-std::unique_ptr<ArtworkEventManager> ArtworkEventManager::s_instance;
-
 //=============================================================================
 // Per-Request HTTP Management System
 //=============================================================================
@@ -297,7 +233,6 @@ class artwork_ui_element;
 // Global variables for CUI panel communication
 std::wstring g_current_artwork_path;
 bool g_artwork_loading = false;
-HBITMAP g_shared_artwork_bitmap = NULL;
 
 // Artwork source tracking
 pfc::string8 g_current_artwork_source;
@@ -1471,6 +1406,7 @@ public:
     
     void on_quit() override {
         ArtworkEventManager::get().clear();
+        set_main_component_artwork_image(shared_hbitmap());
 
         // Clean up artwork component
         artwork_manager::shutdown();
@@ -2284,9 +2220,9 @@ public:
 
 // const GUID artwork_ui_element::g_guid = artwork_ui_element::g_get_guid();
 
-// Function to get artwork bitmap from main component (for CUI panels) - STUB for new implementation
+// Raw handle for the exported C API; owned by the main component and valid until the next track
 HBITMAP get_main_component_artwork_bitmap() {
-    return g_shared_artwork_bitmap;
+    return get_main_component_artwork_image().get();
 }
 
 // Function to get artwork source from main component (for DUI panels)
@@ -2314,23 +2250,11 @@ bool parse_lastfm_json_response(const std::string& json, std::string& artwork_ur
 bool parse_musicbrainz_json_response(const std::string& json, std::string& release_mbid);
 bool parse_discogs_json_response(const std::string& json, std::string& artwork_url);
 bool create_bitmap_from_image_data(const std::vector<BYTE>& data);
+bool create_bitmap_from_image_data(const image_buffer& data);
 bool bridge_http_get_request(const std::string& url, std::string& response);
 bool bridge_http_get_request_with_useragent(const std::string& url, std::string& response, const std::string& user_agent);
 bool bridge_download_image(const std::string& url, std::vector<BYTE>& data);
 
-// External wrapper functions for event manager (for use by CUI panels)
-ArtworkEventManager& get_artwork_event_manager() {
-    return ArtworkEventManager::get();
-}
-
-void subscribe_to_artwork_events(IArtworkEventListener* listener) {
-    ArtworkEventManager::get().subscribe(listener);
-}
-
-void unsubscribe_from_artwork_events(IArtworkEventListener* listener) {
-    ArtworkEventManager::get().unsubscribe(listener);
-}
-
 // Function to trigger main component search from CUI panels with metadata
 static std::atomic<uint64_t> g_main_search_generation{0};
 
@@ -2358,13 +2282,8 @@ void trigger_main_component_search_with_metadata(const std::string& artist, cons
                 g_current_artwork_source = result.source.c_str();
             }
             
-            // Convert pfc::array_t<t_uint8> to std::vector<BYTE> for existing bitmap creation function
-            std::vector<BYTE> image_data;
-            image_data.resize(result.data.get_size());
-            memcpy(image_data.data(), result.data.get_ptr(), result.data.get_size());
-            
             // Use the existing bitmap creation function that handles all UI updates
-            if (create_bitmap_from_image_data(image_data)) {
+            if (create_bitmap_from_image_data(result.data)) {
                 // Clear the path since this is online artwork
                 g_current_artwork_path.clear();
             }
@@ -2523,18 +2442,14 @@ bool load_local_artwork_into_shared_bitmap(const pfc::string8& file_path) {
         // Convert to HBITMAP
         HBITMAP hBitmap = NULL;
         if (pBitmap->GetHBITMAP(NULL, &hBitmap) == Gdiplus::Ok) {
-            // Clean up old shared bitmap
-            if (g_shared_artwork_bitmap) {
-                DeleteObject(g_shared_artwork_bitmap);
-            }
-            
-            // Set new shared bitmap
-            g_shared_artwork_bitmap = hBitmap;
+            // Replace the shared bitmap; the old one is freed once no event holds it
+            shared_hbitmap image = make_shared_hbitmap(hBitmap);
+            set_main_component_artwork_image(image);
             
             // Notify event system that local artwork was loaded
             ArtworkEventManager::get().notify(ArtworkEvent(
                 ArtworkEventType::ARTWORK_LOADED, 
-                hBitmap, 
+                image, 
                 "Local file", 
                 "", 
                 ""
@@ -3627,11 +3542,8 @@ void artwork_ui_element::extract_metadata_for_search(metadb_handle_ptr track, pf
     // Only try direct extraction for local files (safer)
     if (is_likely_local) {
         try {
-            service_ptr_t<titleformat_object> script_artist, script_title;
-            static_api_ptr_t<titleformat_compiler> compiler;
-            
-            compiler->compile_safe(script_artist, "[%artist%]");
-            compiler->compile_safe(script_title, "[%title%]");
+            service_ptr_t<titleformat_object> script_artist = titleformat_script_cache::get("[%artist%]");
+            service_ptr_t<titleformat_object> script_title = titleformat_script_cache::get("[%title%]");
             
             if (script_artist.is_valid()) {
                 track->format_title(NULL, artist, script_artist, NULL);
@@ -4798,9 +4710,10 @@ void artwork_ui_element::process_downloaded_image_data() {
         // Removed status text to prevent white screen when artwork loads
         
         // Notify event system that artwork was loaded successfully
+        // m_artwork_bitmap is replaced in place by this element, so the event gets its own copy
         ArtworkEventManager::get().notify(ArtworkEvent(
             ArtworkEventType::ARTWORK_LOADED, 
-            m_artwork_bitmap, 
+            make_shared_hbitmap((HBITMAP)CopyImage(m_artwork_bitmap, IMAGE_BITMAP, 0, 0, LR_CREATEDIBSECTION)), 
             source.c_str(), 
             m_last_search_artist.c_str(), 
             m_last_search_title.c_str()
@@ -5146,10 +5059,7 @@ public:
                 artwork_manager::on_playback_new_track(p_track);
 
                 // Reset shared artwork bitmap and path for external listeners (e.g. foo_nowbar)
-                if (g_shared_artwork_bitmap) {
-                    DeleteObject(g_shared_artwork_bitmap);
-                    g_shared_artwork_bitmap = NULL;
-                }
+                set_main_component_artwork_image(shared_hbitmap());
                 g_current_artwork_path.clear();
                 g_current_artwork_source.reset();
 
@@ -5283,10 +5193,7 @@ public:
     void on_playback_stop(play_control::t_stop_reason p_reason) override {
         artwork_manager::on_playback_stop();
         
-        if (g_shared_artwork_bitmap) {
-            DeleteObject(g_shared_artwork_bitmap);
-            g_shared_artwork_bitmap = NULL;
-        }
+        set_main_component_artwork_image(shared_hbitmap());
         g_current_artwork_path.clear();
         g_current_artwork_source.reset();
         titleformat_provider::clear_track_artwork_info();
@@ -5809,7 +5716,7 @@ void artwork_ui_element::search_next_api_in_priority(const pfc::string8& artist,
                     // Notify event system that fallback artwork was loaded (for CUI panel)
                     ArtworkEventManager::get().notify(ArtworkEvent(
                         ArtworkEventType::ARTWORK_LOADED, 
-                        fallback_bitmap, 
+                        make_shared_hbitmap((HBITMAP)CopyImage(fallback_bitmap, IMAGE_BITMAP, 0, 0, LR_CREATEDIBSECTION)), 
                         fallback_source.c_str(), 
                         m_last_search_artist.c_str(), 
                         m_last_search_title.c_str()
@@ -6611,10 +6518,7 @@ namespace standalone {
                 HBITMAP hBitmap = NULL;
                 if (webp_bitmap->GetHBITMAP(NULL, &hBitmap) == Gdiplus::Ok) {
                     delete webp_bitmap;
-                    if (::g_shared_artwork_bitmap) {
-                        DeleteObject(::g_shared_artwork_bitmap);
-                    }
-                    ::g_shared_artwork_bitmap = hBitmap;
+                    set_main_component_artwork_image(make_shared_hbitmap(hBitmap));
                     return true;
                 }
                 delete webp_bitmap;
@@ -6674,16 +6578,13 @@ namespace standalone {
         delete pBitmap;
         
         // Store bitmap globally for CUI panel access
-        // First, clean up any existing bitmap
-        if (::g_shared_artwork_bitmap) {
-            DeleteObject(::g_shared_artwork_bitmap);
-        }
-        ::g_shared_artwork_bitmap = hBitmap;
+        shared_hbitmap image = make_shared_hbitmap(hBitmap);
+        set_main_component_artwork_image(image);
         
         // Notify event system that artwork was loaded successfully
         ::ArtworkEventManager::get().notify(::ArtworkEvent(
             ::ArtworkEventType::ARTWORK_LOADED, 
-            hBitmap, 
+            image, 
             ::g_current_artwork_source.c_str(), 
             "", 
             ""
@@ -7629,26 +7530,23 @@ bool parse_discogs_json_response(const std::string& json, std::string& artwork_u
 }
 
 bool create_bitmap_from_image_data(const std::vector<BYTE>& data) {
+    return create_bitmap_from_image_data(image_buffer::copy_of(data.data(), data.size()));
+}
+
+bool create_bitmap_from_image_data(const image_buffer& data) {
     try {
-#ifdef _DEBUG
-#endif        
-        if (data.empty()) {
-#ifdef _DEBUG
-#endif
+        if (data.is_empty()) {
             return false;
         }
 
         // Try WIC-based WebP decoding first
-        if (is_webp_signature(data.data(), data.size())) {
-            Gdiplus::Bitmap* webp_bitmap = decode_webp_via_wic(data.data(), data.size());
+        if (is_webp_signature(data.get_ptr(), data.get_size())) {
+            Gdiplus::Bitmap* webp_bitmap = decode_webp_via_wic(data.get_ptr(), data.get_size());
             if (webp_bitmap) {
                 HBITMAP hBitmap = nullptr;
                 if (webp_bitmap->GetHBITMAP(NULL, &hBitmap) == Gdiplus::Ok && hBitmap) {
                     delete webp_bitmap;
-                    if (::g_shared_artwork_bitmap) {
-                        DeleteObject(::g_shared_artwork_bitmap);
-                    }
-                    ::g_shared_artwork_bitmap = hBitmap;
+                    set_main_component_artwork_image(make_shared_hbitmap(hBitmap));
                     return true;
                 }
                 delete webp_bitmap;
@@ -7656,37 +7554,12 @@ bool create_bitmap_from_image_data(const std::vector<BYTE>& data) {
             return false;
         }
 
-        // Create IStream from memory
-        IStream* pStream = nullptr;
-        HGLOBAL hGlobal = GlobalAlloc(GMEM_MOVEABLE, data.size());
-        if (!hGlobal) {
-#ifdef _DEBUG
-#endif
-            return false;
-        }
-#ifdef _DEBUG        
-#endif
-        
-        void* pData = GlobalLock(hGlobal);
-        if (!pData) {
-            GlobalFree(hGlobal);
-#ifdef _DEBUG
-#endif
+        // Stream directly over the shared buffer - no HGLOBAL copy
+        IStream* pStream = data.create_stream();
+        if (!pStream) {
             return false;
         }
-        
-        memcpy(pData, data.data(), data.size());
-        GlobalUnlock(hGlobal);
-        
-        if (CreateStreamOnHGlobal(hGlobal, TRUE, &pStream) != S_OK) {
-            GlobalFree(hGlobal);
-#ifdef _DEBUG
-#endif
-            return false;
-        }
-#ifdef _DEBUG        
-#endif
-        
+
         // Create GDI+ bitmap from stream
         // NOTE: GDI+ requires the stream to remain valid while the Bitmap exists.
         // Release the stream only after we're done with the Bitmap.
@@ -7709,19 +7582,16 @@ bool create_bitmap_from_image_data(const std::vector<BYTE>& data) {
         // Convert to HBITMAP and store in shared bitmap
         HBITMAP hBitmap = nullptr;
         if (bitmap->GetHBITMAP(NULL, &hBitmap) == Gdiplus::Ok && hBitmap) {
-            // Clean up old shared bitmap
-            if (g_shared_artwork_bitmap) {
-                DeleteObject(g_shared_artwork_bitmap);
-            }
-
-            g_shared_artwork_bitmap = hBitmap;
+            // Replace the shared bitmap; the old one is freed once no event holds it
+            shared_hbitmap image = make_shared_hbitmap(hBitmap);
+            set_main_component_artwork_image(image);
 #ifdef _DEBUG
 #endif
 
             // Notify event system that artwork was loaded successfully
             ArtworkEventManager::get().notify(ArtworkEvent(
                 ArtworkEventType::ARTWORK_LOADED,
-                hBitmap,
+                image,
                 g_current_artwork_source.c_str(),
                 "",
                 ""
@@ -8228,17 +8098,31 @@ bool is_safe_internet_stream(metadb_handle_ptr track) {
 
 // Callback function type for artwork results
 // Parameters: success (bool), bitmap (HBITMAP - only valid if success is true)
+// The bitmap is owned by foo_artwork. It stays valid after the callback returns, until
+// the callback for the next loaded artwork has returned or the last callback is removed;
+// copy it to keep it longer. Do not delete it.
 typedef void (*pfn_artwork_callback)(bool success, HBITMAP bitmap);
 
 // Multi-callback support - multiple external components can register callbacks
 static std::vector<pfn_artwork_callback> g_external_artwork_callbacks;
 static std::mutex g_external_callbacks_mutex;
 
+// Each event carries its own bitmap copy, freed once the event is dropped. The one last
+// passed to the callbacks is held here so consumers can keep drawing it (guarded by
+// g_external_callbacks_mutex).
+static shared_hbitmap g_external_callback_bitmap;
+
 // Internal listener that forwards events to all registered external callbacks
 class ExternalArtworkListener : public IArtworkEventListener {
 public:
     void on_artwork_event(const ArtworkEvent& event) override {
         std::lock_guard<std::mutex> lock(g_external_callbacks_mutex);
+        // The previous bitmap is released only after every callback has seen the new one
+        shared_hbitmap previous;
+        if (event.type == ArtworkEventType::ARTWORK_LOADED) {
+            previous = std::move(g_external_callback_bitmap);
+            g_external_callback_bitmap = event.image;
+        }
         for (auto cb : g_external_artwork_callbacks) {
             try {
                 if (event.type == ArtworkEventType::ARTWORK_LOADED) {
@@ -8270,6 +8154,7 @@ extern "C" __declspec(dllexport) void foo_artwork_set_callback(pfn_artwork_callb
     } else {
         // nullptr = unsubscribe all (backwards compatible with single-consumer usage)
         g_external_artwork_callbacks.clear();
+        g_external_callback_bitmap.reset();
         if (g_external_listener) {
             unsubscribe_from_artwork_events(g_external_listener);
             delete g_external_listener;
@@ -8286,6 +8171,7 @@ extern "C" __declspec(dllexport) void foo_artwork_remove_callback(pfn_artwork_ca
         g_external_artwork_callbacks.end());
     // If no more callbacks, unsubscribe the listener
     if (g_external_artwork_callbacks.empty() && g_external_listener) {
+        g_external_callback_bitmap.reset();
         unsubscribe_from_artwork_events(g_external_listener);
         delete g_external_listener;
         g_external_listener = nullptr;
@@ -8331,16 +8217,11 @@ extern "C" __declspec(dllexport) bool foo_artwork_is_api_enabled(const char* api
 
 extern "C" __declspec(dllexport) void foo_artwork_cache_remove(const char* artist, const char* track) {
     if (!artist || !track) return;
-    pfc::string8 key = artwork_manager::generate_cache_key(artist, track);
-    async_io_manager::instance().cache_remove(key);
+    artwork_manager::remove_cached_artwork(artwork_manager::generate_cache_key(artist, track));
 }
 
-extern void refresh_all_dui_artwork_panels();
-extern void refresh_all_cui_artwork_panels();
-
 extern "C" __declspec(dllexport) void foo_artwork_refresh() {
-    refresh_all_dui_artwork_panels();
-    refresh_all_cui_artwork_panels();
+    request_panel_refresh(panel_refresh_external);
 }
 
 //=============================================================================
@@ -8352,6 +8233,7 @@ public:
     enum {
         cmd_force_acrcloud = 0,
         cmd_reject_artwork,
+        cmd_network_diagnostics,
         cmd_count
     };
 
@@ -8362,9 +8244,11 @@ public:
     GUID get_command(t_uint32 p_index) override {
         static const GUID guid_cmd_force_acrcloud = { 0x3a812345, 0x5b67, 0x4890, { 0xa1, 0xb2, 0xc3, 0xd4, 0xe5, 0xf6, 0x07, 0x89 } };
         static const GUID guid_cmd_reject_artwork = { 0x4b923456, 0x6c78, 0x4901, { 0xb2, 0xc3, 0xd4, 0xe5, 0xf6, 0x07, 0x18, 0x9a } };
+        static const GUID guid_cmd_network_diagnostics = { 0x5ca34567, 0x7d89, 0x4a12, { 0xc3, 0xd4, 0xe5, 0xf6, 0x07, 0x18, 0x29, 0xab } };
         switch (p_index) {
             case cmd_force_acrcloud: return guid_cmd_force_acrcloud;
             case cmd_reject_artwork: return guid_cmd_reject_artwork;
+            case cmd_network_diagnostics: return guid_cmd_network_diagnostics;
             default: return pfc::guid_null;
         }
     }
@@ -8373,6 +8257,7 @@ public:
         switch (p_index) {
             case cmd_force_acrcloud: p_out = "Force ACRCloud Audio Recognition"; break;
             case cmd_reject_artwork: p_out = "Reject Artwork & Search Next Provider"; break;
+            case cmd_network_diagnostics: p_out = "Print Artwork Network Diagnostics"; break;
         }
     }
 
@@ -8384,6 +8269,9 @@ public:
             case cmd_reject_artwork:
                 p_out = "Rejects the currently displayed cover art for the playing track, skips the current provider, and queries the next provider in the chain.";
                 return true;
+            case cmd_network_diagnostics:
+                p_out = "Prints the current state of the per-service request rate limiters and provider health (latency percentiles, timeouts, circuit breakers) to the console.";
+                return true;
             default: return false;
         }
     }
@@ -8397,6 +8285,14 @@ public:
             artwork_manager::force_acrcloud_lookup();
         } else if (p_index == cmd_reject_artwork) {
             artwork_manager::reject_current_artwork();
+        } else if (p_index == cmd_network_diagnostics) {
+            pfc::string8 rate_limits;
+            host_rate_limiter::instance().describe(rate_limits);
+            console::formatter() << "foo_artwork: Rate limiters\n" << rate_limits;
+
+            pfc::string8 health;
+            provider_health::instance().describe(health);
+            console::formatter() << "foo_artwork: Provider health\n" << health;
         }
     }
 };
@@ -0,0 +1,144 @@
+#include "stdafx.h"
+#include "sse_client.h"
+
+void sse_client::stop() {
+    m_stopped.store(true);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_request) {
+        // Closing the handle aborts a blocking read in run()
+        WinHttpCloseHandle(m_request);
+        m_request = nullptr;
+    }
+}
+
+bool sse_client::run(const pfc::string8& url, int connect_timeout_seconds, int idle_timeout_seconds,
+                     const sse_parser::event_callback& on_event, bool& connected, pfc::string8& error_message) {
+    connected = false;
+    error_message.reset();
+    if (m_stopped.load()) return false;
+
+    pfc::stringcvt::string_wide_from_utf8 wide_url(url);
+
+    URL_COMPONENTS urlComp = {};
+    urlComp.dwStructSize = sizeof(urlComp);
+    urlComp.dwSchemeLength = -1;
+    urlComp.dwHostNameLength = -1;
+    urlComp.dwUrlPathLength = -1;
+    urlComp.dwExtraInfoLength = -1;
+
+    if (!WinHttpCrackUrl(wide_url, 0, 0, &urlComp)) {
+        error_message = "Failed to parse URL";
+        return false;
+    }
+
+    HINTERNET hSession = WinHttpOpen(L"foobar2000-artwork/1.0",
+                                     WINHTTP_ACCESS_TYPE_DEFAULT_PROXY,
+                                     WINHTTP_NO_PROXY_NAME,
+                                     WINHTTP_NO_PROXY_BYPASS, 0);
+    if (!hSession) {
+        error_message = "Failed to initialize WinHTTP";
+        return false;
+    }
+
+    // The receive timeout only has to outlast the server's keep-alive interval
+    int connect_ms = connect_timeout_seconds * 1000;
+    int idle_ms = idle_timeout_seconds * 1000;
+    WinHttpSetTimeouts(hSession, connect_ms, connect_ms, connect_ms, idle_ms);
+
+    std::wstring hostname(urlComp.lpszHostName, urlComp.dwHostNameLength);
+    HINTERNET hConnect = WinHttpConnect(hSession, hostname.c_str(), urlComp.nPort, 0);
+    if (!hConnect) {
+        WinHttpCloseHandle(hSession);
+        error_message = "Failed to connect to server";
+        return false;
+    }
+
+    std::wstring object(urlComp.lpszUrlPath, urlComp.dwUrlPathLength);
+    if (urlComp.lpszExtraInfo) {
+        object += std::wstring(urlComp.lpszExtraInfo, urlComp.dwExtraInfoLength);
+    }
+
+    DWORD flags = (urlComp.nScheme == INTERNET_SCHEME_HTTPS) ? WINHTTP_FLAG_SECURE : 0;
+    HINTERNET hRequest = WinHttpOpenRequest(hConnect, L"GET", object.c_str(),
+                                            NULL, WINHTTP_NO_REFERER,
+                                            WINHTTP_DEFAULT_ACCEPT_TYPES, flags);
+    if (!hRequest) {
+        WinHttpCloseHandle(hConnect);
+        WinHttpCloseHandle(hSession);
+        error_message = "Failed to create request";
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stopped.load()) {
+            WinHttpCloseHandle(hRequest);
+            WinHttpCloseHandle(hConnect);
+            WinHttpCloseHandle(hSession);
+            return false;
+        }
+        m_request = hRequest;
+    }
+
+    // From here on stop() may close hRequest at any time; only close it ourselves if it did not
+    auto close_request = [this]() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_request) {
+            WinHttpCloseHandle(m_request);
+            m_request = nullptr;
+        }
+    };
+
+    bool result = false;
+    const wchar_t* headers = L"Accept: text/event-stream\r\nCache-Control: no-cache\r\n";
+    if (!WinHttpSendRequest(hRequest, headers, (DWORD)-1L, WINHTTP_NO_REQUEST_DATA, 0, 0, 0) ||
+        !WinHttpReceiveResponse(hRequest, NULL)) {
+        error_message = m_stopped.load() ? "Stopped" : "Failed to open event stream (timeout or connection error)";
+    } else {
+        DWORD statusCode = 0;
+        DWORD statusCodeSize = sizeof(statusCode);
+        WinHttpQueryHeaders(hRequest, WINHTTP_QUERY_STATUS_CODE | WINHTTP_QUERY_FLAG_NUMBER,
+                            WINHTTP_HEADER_NAME_BY_INDEX, &statusCode, &statusCodeSize, WINHTTP_NO_HEADER_INDEX);
+
+        wchar_t content_type[128] = {};
+        DWORD content_type_size = sizeof(content_type);
+        WinHttpQueryHeaders(hRequest, WINHTTP_QUERY_CONTENT_TYPE, WINHTTP_HEADER_NAME_BY_INDEX,
+                            content_type, &content_type_size, WINHTTP_NO_HEADER_INDEX);
+
+        if (statusCode != 200) {
+            error_message = "Event stream not available (HTTP ";
+            error_message << (int)statusCode << ")";
+        } else if (!wcsstr(content_type, L"text/event-stream")) {
+            error_message = "Server did not answer with an event stream";
+        } else {
+            connected = true;
+
+            sse_parser parser;
+            char buffer[4096];
+            for (;;) {
+                DWORD downloaded = 0;
+                if (!WinHttpReadData(hRequest, buffer, sizeof(buffer), &downloaded)) {
+                    error_message = m_stopped.load() ? "Stopped" : "Event stream interrupted (timeout or connection error)";
+                    break;
+                }
+                if (downloaded == 0) {
+                    error_message = "Event stream closed by server";
+                    break;
+                }
+                parser.feed(buffer, downloaded, on_event);
+                if (parser.retry_ms()) m_retry_ms.store(parser.retry_ms());
+                if (m_stopped.load()) {
+                    error_message = "Stopped";
+                    break;
+                }
+            }
+            // Only a deliberate stop counts as a clean end of the stream
+            result = m_stopped.load();
+        }
+    }
+
+    close_request();
+    WinHttpCloseHandle(hConnect);
+    WinHttpCloseHandle(hSession);
+    return result;
+}
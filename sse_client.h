@@ -0,0 +1,34 @@
+#pragma once
+#include "stdafx.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <winhttp.h>
+#include "sse_parser.h"
+
+// Long-lived WinHTTP connection to a text/event-stream endpoint, used for
+// AzuraCast's real-time now-playing feed. run() blocks until the stream ends,
+// so it is driven from a dedicated thread rather than the I/O pool.
+class sse_client {
+public:
+    sse_client() : m_request(nullptr), m_stopped(false), m_retry_ms(0) {}
+
+    // Connect to url and report every event until the connection drops or stop()
+    // is called. connected is set once the server answered with an event stream;
+    // returns false with error_message when the stream could not be opened or broke.
+    bool run(const pfc::string8& url, int connect_timeout_seconds, int idle_timeout_seconds,
+             const sse_parser::event_callback& on_event, bool& connected, pfc::string8& error_message);
+
+    // Abort run() from any thread
+    void stop();
+    bool is_stopped() const { return m_stopped.load(); }
+
+    // Reconnection delay the server last asked for with retry:, 0 if it never did
+    unsigned retry_ms() const { return m_retry_ms.load(); }
+
+private:
+    std::mutex m_mutex;
+    HINTERNET m_request;        // Open request while run() is reading, guarded by m_mutex
+    std::atomic<bool> m_stopped;
+    std::atomic<unsigned> m_retry_ms;
+};
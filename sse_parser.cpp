@@ -0,0 +1,60 @@
+#include "stdafx.h"
+#include "sse_parser.h"
+
+void sse_parser::reset() {
+    m_line.clear();
+    m_data.clear();
+    m_has_data = false;
+    m_last_was_cr = false;
+    m_retry_ms = 0;
+}
+
+void sse_parser::feed(const char* data, size_t size, const event_callback& on_event) {
+    // Lines end in CRLF, LF or CR
+    for (size_t i = 0; i < size; i++) {
+        char c = data[i];
+        if (c == '\n' && m_last_was_cr) {
+            m_last_was_cr = false;
+            continue;
+        }
+        m_last_was_cr = (c == '\r');
+        if (c == '\r' || c == '\n') {
+            process_line(m_line, on_event);
+            m_line.clear();
+        } else {
+            m_line.push_back(c);
+        }
+    }
+}
+
+void sse_parser::process_line(const std::string& line, const event_callback& on_event) {
+    // Blank line dispatches the event
+    if (line.empty()) {
+        if (m_has_data && on_event) on_event(m_data);
+        m_data.clear();
+        m_has_data = false;
+        return;
+    }
+
+    // Comment / keep-alive
+    if (line[0] == ':') return;
+
+    size_t colon = line.find(':');
+    std::string field = line.substr(0, colon);
+    std::string value;
+    if (colon != std::string::npos) {
+        value = line.substr(colon + 1);
+        if (!value.empty() && value[0] == ' ') value.erase(0, 1);
+    }
+
+    // event and id are not used by the now-playing feed
+    if (field == "data") {
+        if (m_has_data) m_data.push_back('\n');
+        m_data += value;
+        m_has_data = true;
+    } else if (field == "retry") {
+        // Only a plain decimal number counts; anything else is ignored
+        if (value.empty() || value.size() > 9 || value.find_first_not_of("0123456789") != std::string::npos) return;
+        m_retry_ms = (unsigned)std::stoul(value);
+    }
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "stdafx.h"
+#include <functional>
+#include <string>
+
+// Incremental Server-Sent Events parser. Accepts arbitrary chunks of the
+// response body and reports the data of each complete event. Does not depend
+// on WinHTTP or the foobar2000 SDK, so it can be tested on its own.
+class sse_parser {
+public:
+    typedef std::function<void(const std::string& data)> event_callback;
+
+    void feed(const char* data, size_t size, const event_callback& on_event);
+    void reset();
+
+    // Reconnection delay requested by the server's last valid retry: field, 0 if none
+    unsigned retry_ms() const { return m_retry_ms; }
+
+private:
+    void process_line(const std::string& line, const event_callback& on_event);
+
+    std::string m_line;         // Partial line carried over between chunks
+    std::string m_data;         // data: lines of the event being assembled
+    bool m_has_data = false;
+    bool m_last_was_cr = false; // CR of a CRLF pair was the last byte of the previous chunk
+    unsigned m_retry_ms = 0;
+};
@@ -0,0 +1,150 @@
+// Equivalence check and benchmark for artist_match_key.
+//
+//   artist_match_bench <artist_names.tsv> <fixtures/providers> [--update] [--min-speedup N]
+//
+// artist_names.tsv holds 58 names and the expected artists_match decision for every
+// ordered pair of them (see the file header); any difference fails.
+//
+// The benchmark matches every name as a query against the artists of each provider
+// result set in fixtures/providers (read from the .expected files json_bench checks),
+// the way the parse_*_json functions do: one key for the query, one per result. It
+// is compared with building both keys for every comparison, which is the work the
+// string-based artists_match did on each call; the keyed version must be at least
+// N times faster.
+#include "track_matcher.h"
+#include "support/alloc_counter.h"
+#include "support/gate_util.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Fields of the .expected files that carry the result's artist. Discogs only has
+// "Artist - Release" titles, which its parser splits the same way.
+static const char* const ARTIST_FIELDS[] = { "artistName", "artist.name", "artist-credit[].name", "track.artist.name" };
+static const char* const RESULT_SETS[] = { "itunes_search.json", "deezer_search.json", "lastfm_track_getinfo.json",
+                                           "discogs_search.json", "musicbrainz_recordings.json" };
+
+static bool read_result_set(const std::string& path, bool discogs, std::vector<std::string>& artists) {
+    std::vector<std::string> lines;
+    if (!gate::read_lines(path.c_str(), lines)) return false;
+    for (const auto& line : lines) {
+        std::vector<std::string> fields = gate::split(line);
+        for (size_t i = 1; i < fields.size(); i++) {
+            size_t eq = fields[i].find('=');
+            if (eq == std::string::npos) continue;
+            std::string name = fields[i].substr(0, eq);
+            std::string value = fields[i].substr(eq + 1);
+            if (discogs && name == "title") {
+                size_t dash = value.find(" - ");
+                if (dash != std::string::npos) artists.push_back(value.substr(0, dash));
+                continue;
+            }
+            for (const char* field : ARTIST_FIELDS) {
+                if (name == field) artists.push_back(value);
+            }
+        }
+    }
+    return true;
+}
+
+// Runs body until at least min_seconds have passed; returns comparisons per second
+// and stores the allocations per comparison
+template <typename Body>
+static double measure(size_t comparisons_per_run, Body body, double& allocs_per_comparison, double min_seconds = 0.3) {
+    size_t comparisons = 0;
+    uint64_t allocs_before = allocation_count();
+    auto start = gate::timer::now();
+    double elapsed = 0;
+    do {
+        body();
+        comparisons += comparisons_per_run;
+        elapsed = gate::seconds_since(start);
+    } while (elapsed < min_seconds);
+    allocs_per_comparison = (double)(allocation_count() - allocs_before) / comparisons;
+    return comparisons / elapsed;
+}
+
+int main(int argc, char** argv) {
+    std::vector<const char*> paths = gate::positional(argc, argv);
+    if (paths.size() != 2) {
+        std::fprintf(stderr, "usage: artist_match_bench <artist_names.tsv> <fixtures/providers> [--update] [--min-speedup N]\n");
+        return 2;
+    }
+    bool update = gate::flag(argc, argv, "--update");
+
+    std::vector<std::string> rows, comments;
+    if (!gate::read_lines(paths[0], rows, &comments)) return 2;
+    std::vector<std::string> names;
+    for (const auto& row : rows) names.push_back(gate::split(row)[0]);
+
+    std::vector<artist_match_key> keys;
+    for (const auto& name : names) keys.emplace_back(name);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < rows.size(); i++) {
+        std::string decisions;
+        for (size_t j = 0; j < keys.size(); j++) decisions += artists_match(keys[i], keys[j]) ? '1' : '0';
+        std::vector<std::string> fields = gate::split(rows[i]);
+        std::string expected = fields.size() > 1 ? fields[1] : std::string();
+        if (update) {
+            rows[i] = names[i] + "\t" + decisions;
+            continue;
+        }
+        for (size_t j = 0; j < decisions.size(); j++) {
+            if (j < expected.size() && expected[j] == decisions[j]) continue;
+            if (mismatches < 25) {
+                std::printf("artists_match(\"%s\", \"%s\"): expected %c, got %c\n", names[i].c_str(), names[j].c_str(),
+                            j < expected.size() ? expected[j] : '?', decisions[j]);
+            }
+            mismatches++;
+        }
+    }
+
+    if (update) {
+        std::ofstream out(paths[0], std::ios::binary | std::ios::trunc);
+        for (const auto& line : comments) out << line << "\n";
+        for (const auto& line : rows) out << line << "\n";
+        std::printf("updated %zu names\n", rows.size());
+        return out ? 0 : 1;
+    }
+
+    std::vector<std::vector<std::string>> result_sets;
+    size_t results = 0;
+    for (const char* fixture : RESULT_SETS) {
+        std::vector<std::string> artists;
+        std::string path = std::string(paths[1]) + "/" + fixture + ".expected";
+        if (!read_result_set(path, std::string(fixture) == "discogs_search.json", artists)) return 2;
+        results += artists.size();
+        result_sets.push_back(artists);
+    }
+    size_t comparisons = names.size() * results;
+
+    volatile size_t sink = 0;
+    double keyed_allocs = 0, pair_allocs = 0;
+    double keyed_rate = measure(comparisons, [&] {
+        for (const auto& name : names) {
+            artist_match_key query(name);
+            for (const auto& set : result_sets) {
+                for (const auto& artist : set) sink = sink + artists_match(artist_match_key(artist), query);
+            }
+        }
+    }, keyed_allocs);
+    double pair_rate = measure(comparisons, [&] {
+        for (const auto& name : names) {
+            for (const auto& set : result_sets) {
+                for (const auto& artist : set) sink = sink + artists_match(artist_match_key(artist), artist_match_key(name));
+            }
+        }
+    }, pair_allocs);
+
+    std::printf("artist_match_bench: %zu names x %zu provider results\n", names.size(), results);
+    std::printf("  %-28s %14s %16s\n", "", "comparisons/s", "allocs/compare");
+    std::printf("  %-28s %14.0f %16.1f\n", "query key built once", keyed_rate, keyed_allocs);
+    std::printf("  %-28s %14.0f %16.1f\n", "both keys per comparison", pair_rate, pair_allocs);
+
+    gate::result result;
+    result.at_most("artists_match decisions changed", (double)mismatches, 0);
+    result.at_least("speedup of a precomputed query key", keyed_rate / pair_rate, gate::option(argc, argv, "--min-speedup", 0));
+    return result.exit_code();
+}
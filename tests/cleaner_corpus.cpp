@@ -0,0 +1,126 @@
+// Golden-output corpus and micro-benchmark for the MetadataCleaner public API.
+//
+//   cleaner_corpus <cleaner_corpus.tsv> [--update] [--min-lines-per-sec N]
+//
+// Each corpus line is "<fnv1a-64 of the expected output>\t<input>". The input is
+// split at its first tab into artist and title for sanitize_stream_metadata and
+// passed whole to every other function. Storing the hash of the output keeps
+// 20,000 lines of stress input at a reviewable size; a mismatch prints the
+// actual output, and --update rewrites the hashes from the current code.
+#include "metadata_cleaner.h"
+#include "support/alloc_counter.h"
+#include "support/gate_util.h"
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+static uint64_t fnv1a(const std::string& s) {
+    uint64_t h = 14695981039346656037ull;
+    for (unsigned char c : s) {
+        h ^= c;
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+// Per-function time and allocation totals
+struct stage_stats {
+    const char* name;
+    double seconds = 0;
+    uint64_t allocations = 0;
+};
+
+enum { STAGE_SANITIZE, STAGE_CLEAN, STAGE_CLEAN_LATIN, STAGE_TRACK_NUMBERS, STAGE_DATES, STAGE_KEYWORDS, STAGE_COUNT };
+
+template <typename F>
+static std::string timed(stage_stats& stats, F f) {
+    uint64_t allocs = allocation_count();
+    auto start = gate::timer::now();
+    std::string out = f();
+    stats.seconds += gate::seconds_since(start);
+    stats.allocations += allocation_count() - allocs;
+    return out;
+}
+
+// Every public entry point, joined with '|' in a fixed order
+static std::string clean_all(const std::string& line, stage_stats* stats) {
+    size_t tab = line.find('\t');
+    std::string artist = tab == std::string::npos ? line : line.substr(0, tab);
+    std::string title = tab == std::string::npos ? line : line.substr(tab + 1);
+
+    std::string out = timed(stats[STAGE_SANITIZE], [&] {
+        StreamMetadataResult r = MetadataCleaner::sanitize_stream_metadata(artist.c_str(), title.c_str());
+        return r.clean_artist + "|" + r.clean_title + "|" + r.first_artist + "|" + r.second_artist + "|" +
+               r.primary_title + "|" + (r.is_valid_search ? "1" : "0") + "|" + (r.is_station_or_url ? "1" : "0");
+    });
+    out += "|" + timed(stats[STAGE_CLEAN], [&] { return MetadataCleaner::clean_for_search(line.c_str(), true); });
+    out += "|" + timed(stats[STAGE_CLEAN_LATIN], [&] { return MetadataCleaner::clean_for_search(line.c_str(), false); });
+    out += "|" + timed(stats[STAGE_TRACK_NUMBERS], [&] { return MetadataCleaner::strip_track_numbers(line); });
+    out += "|" + timed(stats[STAGE_DATES], [&] { return MetadataCleaner::strip_broadcast_dates(line); });
+    out += "|" + timed(stats[STAGE_KEYWORDS], [&] { return MetadataCleaner::filter_multilingual_keywords(line); });
+    return out;
+}
+
+int main(int argc, char** argv) {
+    std::vector<const char*> files = gate::positional(argc, argv);
+    if (files.size() != 1) {
+        std::fprintf(stderr, "usage: cleaner_corpus <cleaner_corpus.tsv> [--update] [--min-lines-per-sec N]\n");
+        return 2;
+    }
+    bool update = gate::flag(argc, argv, "--update");
+
+    std::vector<std::string> rows, comments;
+    if (!gate::read_lines(files[0], rows, &comments)) return 2;
+
+    stage_stats stats[STAGE_COUNT];
+    stats[STAGE_SANITIZE].name = "sanitize_stream_metadata";
+    stats[STAGE_CLEAN].name = "clean_for_search";
+    stats[STAGE_CLEAN_LATIN].name = "clean_for_search (no Cyrillic)";
+    stats[STAGE_TRACK_NUMBERS].name = "strip_track_numbers";
+    stats[STAGE_DATES].name = "strip_broadcast_dates";
+    stats[STAGE_KEYWORDS].name = "filter_multilingual_keywords";
+
+    size_t mismatches = 0;
+    auto start = gate::timer::now();
+    for (auto& row : rows) {
+        size_t tab = row.find('\t');
+        if (tab == std::string::npos) {
+            std::printf("malformed line: %s\n", row.c_str());
+            mismatches++;
+            continue;
+        }
+        std::string input = row.substr(tab + 1);
+        std::string output = clean_all(input, stats);
+
+        char hash[17];
+        std::snprintf(hash, sizeof(hash), "%016" PRIx64, fnv1a(output));
+        if (update) {
+            row = std::string(hash) + "\t" + input;
+        } else if (row.compare(0, tab, hash) != 0) {
+            if (mismatches < 25) std::printf("mismatch for \"%s\"\n    actual \"%s\"\n", input.c_str(), output.c_str());
+            mismatches++;
+        }
+    }
+    double elapsed = gate::seconds_since(start);
+
+    if (update) {
+        std::ofstream out(files[0], std::ios::binary | std::ios::trunc);
+        for (const auto& line : comments) out << line << "\n";
+        for (const auto& line : rows) out << line << "\n";
+        std::printf("updated %zu lines\n", rows.size());
+        return out ? 0 : 1;
+    }
+
+    std::printf("cleaner_corpus: %zu lines in %.2f s\n", rows.size(), elapsed);
+    std::printf("  %-32s %12s %14s\n", "function", "us/call", "allocs/call");
+    for (const auto& s : stats) {
+        std::printf("  %-32s %12.2f %14.1f\n", s.name, s.seconds * 1e6 / rows.size(), (double)s.allocations / rows.size());
+    }
+
+    gate::result result;
+    result.at_most("golden output mismatches", (double)mismatches, 0);
+    result.at_least("lines/s (all functions)", rows.size() / elapsed, gate::option(argc, argv, "--min-lines-per-sec", 0));
+    return result.exit_code();
+}
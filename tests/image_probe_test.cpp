@@ -0,0 +1,336 @@
+// Tests for the image header probe that rejects undersized artwork before decoding.
+//
+//   image_probe_test
+//
+// The probe reads untrusted downloads. Every well-formed header below is probed at
+// every prefix length, each copied into a buffer of exactly that size (so a sanitizer
+// or debug heap catches a read past the end): shorter than the header it must fail,
+// from there on it must report the same dimensions. Malformed headers must fail.
+#include "image_probe.h"
+#include "support/gate_util.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+typedef std::vector<unsigned char> bytes;
+
+static void append(bytes& out, std::initializer_list<unsigned> values) {
+    for (unsigned v : values) out.push_back((unsigned char)v);
+}
+
+static void append_text(bytes& out, const char* text) {
+    out.insert(out.end(), text, text + strlen(text));
+}
+
+static void append_le16(bytes& out, unsigned v) { append(out, { v & 0xFF, (v >> 8) & 0xFF }); }
+static void append_le24(bytes& out, unsigned v) { append(out, { v & 0xFF, (v >> 8) & 0xFF, (v >> 16) & 0xFF }); }
+static void append_le32(bytes& out, unsigned v) { append(out, { v & 0xFF, (v >> 8) & 0xFF, (v >> 16) & 0xFF, (v >> 24) & 0xFF }); }
+static void append_be16(bytes& out, unsigned v) { append(out, { (v >> 8) & 0xFF, v & 0xFF }); }
+static void append_be32(bytes& out, unsigned v) { append(out, { (v >> 24) & 0xFF, (v >> 16) & 0xFF, (v >> 8) & 0xFF, v & 0xFF }); }
+
+// Stands in for the compressed data that follows the header
+static void append_body(bytes& out, size_t n) {
+    for (size_t i = 0; i < n; i++) out.push_back((unsigned char)(i * 37 + 11));
+}
+
+struct probe_case {
+    const char* name;
+    bytes data;
+    size_t header_bytes;    // Shortest prefix the probe can succeed on (0: must always fail)
+    image_probe_info expected;
+};
+
+static image_probe_info info(image_probe_format format, unsigned width, unsigned height, unsigned bit_depth, bool progressive) {
+    image_probe_info i;
+    i.format = format;
+    i.width = width;
+    i.height = height;
+    i.bit_depth = bit_depth;
+    i.progressive = progressive;
+    return i;
+}
+
+static probe_case failing(const char* name, bytes data) {
+    return { name, std::move(data), 0, image_probe_info() };
+}
+
+// JPEG as cameras and encoders write it: JFIF, EXIF, quantisation tables, then the frame
+static void append_jpeg_preamble(bytes& out) {
+    append(out, { 0xFF, 0xD8 });
+    append(out, { 0xFF, 0xE0 }); append_be16(out, 16); append_text(out, "JFIF");
+    append(out, { 0x00, 0x01, 0x01, 0x00, 0x00, 0x48, 0x00, 0x48, 0x00, 0x00 });
+    append(out, { 0xFF, 0xE1 }); append_be16(out, 2 + 6 + 40); append_text(out, "Exif"); append(out, { 0, 0 });
+    append_body(out, 40);
+    append(out, { 0xFF, 0xDB }); append_be16(out, 2 + 65); append(out, { 0x00 }); append_body(out, 64);
+}
+
+// Returns the offset of the frame header's marker
+static size_t append_jpeg_frame(bytes& out, unsigned marker, unsigned width, unsigned height, unsigned components) {
+    size_t offset = out.size();
+    append(out, { 0xFF, marker });
+    append_be16(out, 8 + 3 * components);
+    append(out, { 8 });
+    append_be16(out, height);
+    append_be16(out, width);
+    append(out, { components });
+    for (unsigned c = 1; c <= components; c++) append(out, { c, 0x11, 0 });
+    return offset;
+}
+
+static probe_case jpeg_case(const char* name, unsigned marker, unsigned width, unsigned height, unsigned components,
+                            bool progressive, bool fill_bytes) {
+    probe_case c = { name, bytes(), 0, info(image_probe_format::jpeg, width, height, 8 * components, progressive) };
+    append_jpeg_preamble(c.data);
+    if (fill_bytes) append(c.data, { 0xFF, 0xFF, 0xFF });
+    size_t offset = append_jpeg_frame(c.data, marker, width, height, components);
+    // Marker, length, precision, height, width and component count
+    c.header_bytes = offset + 10;
+    append(c.data, { 0xFF, 0xC4 }); append_be16(c.data, 2 + 20); append_body(c.data, 20);
+    append(c.data, { 0xFF, 0xDA }); append_be16(c.data, 8); append_body(c.data, 300);
+    append(c.data, { 0xFF, 0xD9 });
+    return c;
+}
+
+static bytes png_header(unsigned width, unsigned height, unsigned depth, unsigned colour_type, unsigned interlace,
+                        const char* chunk = "IHDR") {
+    bytes out;
+    append(out, { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' });
+    append_be32(out, 13);
+    append_text(out, chunk);
+    append_be32(out, width);
+    append_be32(out, height);
+    append(out, { depth, colour_type, 0, 0, interlace });
+    append_be32(out, 0x1234ABCD);  // CRC, not checked
+    append_be32(out, 200); append_text(out, "IDAT"); append_body(out, 200);
+    return out;
+}
+
+static bytes gif_header(unsigned width, unsigned height, unsigned packed) {
+    bytes out;
+    append_text(out, "GIF89a");
+    append_le16(out, width);
+    append_le16(out, height);
+    append(out, { packed, 0, 0 });
+    append_body(out, 3 << ((packed & 7) + 1));
+    return out;
+}
+
+static bytes bmp_header(unsigned header_size, unsigned width, unsigned height, unsigned bits) {
+    bytes out;
+    append_text(out, "BM");
+    append_le32(out, 0);  // File size
+    append_le32(out, 0);  // Reserved
+    append_le32(out, 14 + header_size);
+    append_le32(out, header_size);
+    if (header_size == 12) {
+        append_le16(out, width);
+        append_le16(out, height);
+        append_le16(out, 1);
+        append_le16(out, bits);
+    } else {
+        append_le32(out, width);
+        append_le32(out, height);
+        append_le16(out, 1);
+        append_le16(out, bits);
+        append_body(out, header_size - 16);
+    }
+    append_body(out, 64);
+    return out;
+}
+
+static bytes webp_header(const char* chunk, const bytes& payload) {
+    bytes out;
+    append_text(out, "RIFF");
+    append_le32(out, (unsigned)(4 + 8 + payload.size()));
+    append_text(out, "WEBP");
+    append_text(out, chunk);
+    append_le32(out, (unsigned)payload.size());
+    out.insert(out.end(), payload.begin(), payload.end());
+    return out;
+}
+
+static bytes vp8_payload(unsigned width_field, unsigned height_field, unsigned start_code_first = 0x9D) {
+    bytes p;
+    append(p, { 0x50, 0x2D, 0x00, start_code_first, 0x01, 0x2A });
+    append_le16(p, width_field);
+    append_le16(p, height_field);
+    append_body(p, 100);
+    return p;
+}
+
+static bytes vp8l_payload(unsigned width, unsigned height, bool alpha, unsigned signature = 0x2F) {
+    bytes p;
+    append(p, { signature });
+    append_le32(p, (width - 1) | ((height - 1) << 14) | ((alpha ? 1u : 0u) << 28));
+    append_body(p, 100);
+    return p;
+}
+
+static bytes vp8x_payload(unsigned width, unsigned height, unsigned flags) {
+    bytes p;
+    append(p, { flags, 0, 0, 0 });
+    append_le24(p, width - 1);
+    append_le24(p, height - 1);
+    append_body(p, 100);
+    return p;
+}
+
+static std::vector<probe_case> make_cases() {
+    std::vector<probe_case> cases;
+
+    // Well-formed headers
+    cases.push_back(jpeg_case("JPEG baseline", 0xC0, 1200, 1200, 3, false, false));
+    cases.push_back(jpeg_case("JPEG progressive", 0xC2, 800, 1200, 3, true, false));
+    cases.push_back(jpeg_case("JPEG greyscale with fill bytes", 0xC1, 640, 480, 1, false, true));
+    cases.push_back(jpeg_case("JPEG CMYK", 0xC0, 3000, 3000, 4, false, false));
+    cases.push_back({ "PNG RGBA interlaced", png_header(1200, 1200, 8, 6, 1), 29, info(image_probe_format::png, 1200, 1200, 32, true) });
+    cases.push_back({ "PNG RGB", png_header(600, 300, 8, 2, 0), 29, info(image_probe_format::png, 600, 300, 24, false) });
+    cases.push_back({ "PNG palette", png_header(150, 150, 4, 3, 0), 29, info(image_probe_format::png, 150, 150, 4, false) });
+    cases.push_back({ "PNG 16-bit greyscale and alpha", png_header(4000, 1, 16, 4, 0), 29, info(image_probe_format::png, 4000, 1, 32, false) });
+    cases.push_back({ "GIF 256 colours", gif_header(320, 200, 0xF7), 13, info(image_probe_format::gif, 320, 200, 8, false) });
+    cases.push_back({ "GIF 2 colours", gif_header(65535, 1, 0x80), 13, info(image_probe_format::gif, 65535, 1, 1, false) });
+    cases.push_back({ "BMP V5 top-down", bmp_header(124, 640, (unsigned)-480, 32), 30, info(image_probe_format::bmp, 640, 480, 32, false) });
+    cases.push_back({ "BMP info header", bmp_header(40, 300, 300, 24), 30, info(image_probe_format::bmp, 300, 300, 24, false) });
+    cases.push_back({ "BMP OS/2 core header", bmp_header(12, 16, 16, 8), 26, info(image_probe_format::bmp, 16, 16, 8, false) });
+    // The top two bits of each VP8 dimension are a scale, not part of the size
+    cases.push_back({ "WebP lossy", webp_header("VP8 ", vp8_payload(0x4000 | 1000, 0xC000 | 1000)), 30, info(image_probe_format::webp, 1000, 1000, 24, false) });
+    cases.push_back({ "WebP lossless with alpha", webp_header("VP8L", vp8l_payload(1200, 900, true)), 30, info(image_probe_format::webp, 1200, 900, 32, false) });
+    cases.push_back({ "WebP lossless 16384 wide", webp_header("VP8L", vp8l_payload(16384, 1, false)), 30, info(image_probe_format::webp, 16384, 1, 24, false) });
+    cases.push_back({ "WebP extended", webp_header("VP8X", vp8x_payload(3000, 2000, 0x10)), 30, info(image_probe_format::webp, 3000, 2000, 32, false) });
+
+    // Malformed headers
+    bytes no_marker = { 0xFF, 0xD8, 0x00, 0xE0, 0x00, 0x10 };
+    append_body(no_marker, 40);
+    cases.push_back(failing("JPEG without a marker after SOI", no_marker));
+
+    bytes short_segment;
+    append(short_segment, { 0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x01 });
+    append_body(short_segment, 40);
+    cases.push_back(failing("JPEG segment length below 2", short_segment));
+
+    bytes scan_first;
+    append_jpeg_preamble(scan_first);
+    append(scan_first, { 0xFF, 0xDA }); append_be16(scan_first, 8); append_body(scan_first, 40);
+    append_jpeg_frame(scan_first, 0xC0, 100, 100, 3);
+    cases.push_back(failing("JPEG scan before the frame header", scan_first));
+
+    bytes end_first;
+    append_jpeg_preamble(end_first);
+    append(end_first, { 0xFF, 0xD9 });
+    append_jpeg_frame(end_first, 0xC0, 100, 100, 3);
+    cases.push_back(failing("JPEG end of image before the frame header", end_first));
+
+    bytes overlong;
+    append(overlong, { 0xFF, 0xD8, 0xFF, 0xE1, 0xFF, 0xFF });
+    append_body(overlong, 100);
+    append_jpeg_frame(overlong, 0xC0, 100, 100, 3);
+    cases.push_back(failing("JPEG segment running past the end", overlong));
+
+    bytes zero_width;
+    append_jpeg_preamble(zero_width);
+    append_jpeg_frame(zero_width, 0xC0, 0, 100, 3);
+    append_body(zero_width, 40);
+    cases.push_back(failing("JPEG zero width", zero_width));
+
+    bytes huffman_only;
+    append_jpeg_preamble(huffman_only);
+    append(huffman_only, { 0xFF, 0xC4 }); append_be16(huffman_only, 8); append_body(huffman_only, 6);
+    cases.push_back(failing("JPEG with DHT but no frame header", huffman_only));
+
+    cases.push_back(failing("PNG first chunk not IHDR", png_header(100, 100, 8, 6, 0, "CgBI")));
+    cases.push_back(failing("PNG invalid colour type", png_header(100, 100, 8, 5, 0)));
+    cases.push_back(failing("PNG zero height", png_header(100, 0, 8, 2, 0)));
+    cases.push_back(failing("GIF zero width", gif_header(0, 100, 0xF7)));
+    cases.push_back(failing("BMP unknown header size", bmp_header(20, 100, 100, 24)));
+    cases.push_back(failing("BMP negative width", bmp_header(40, (unsigned)-100, 100, 24)));
+    cases.push_back(failing("BMP most negative width", bmp_header(40, 0x80000000u, 100, 24)));
+    cases.push_back(failing("BMP zero height", bmp_header(124, 100, 0, 24)));
+    cases.push_back(failing("WebP lossy without start code", webp_header("VP8 ", vp8_payload(100, 100, 0x9C))));
+    cases.push_back(failing("WebP lossy zero size", webp_header("VP8 ", vp8_payload(0x4000, 100))));
+    cases.push_back(failing("WebP lossless bad signature", webp_header("VP8L", vp8l_payload(100, 100, false, 0x2E))));
+    cases.push_back(failing("WebP unknown first chunk", webp_header("ALPH", vp8x_payload(100, 100, 0))));
+
+    bytes riff_wave;
+    append_text(riff_wave, "RIFF");
+    append_le32(riff_wave, 100);
+    append_text(riff_wave, "WAVEfmt ");
+    append_body(riff_wave, 100);
+    cases.push_back(failing("RIFF that is not WebP", riff_wave));
+
+    bytes gif88;
+    append_text(gif88, "GIF88a");
+    append_body(gif88, 20);
+    cases.push_back(failing("GIF with an unknown version", gif88));
+
+    bytes text;
+    append_text(text, "<!DOCTYPE html><html><body>Not found</body></html>");
+    cases.push_back(failing("HTML error page", text));
+    cases.push_back(failing("empty", bytes()));
+    return cases;
+}
+
+static const char* format_name(image_probe_format format) {
+    switch (format) {
+        case image_probe_format::jpeg: return "jpeg";
+        case image_probe_format::png: return "png";
+        case image_probe_format::gif: return "gif";
+        case image_probe_format::bmp: return "bmp";
+        case image_probe_format::webp: return "webp";
+        default: return "unknown";
+    }
+}
+
+static std::string describe(bool ok, const image_probe_info& i) {
+    if (!ok) return "not recognised";
+    char text[128];
+    std::snprintf(text, sizeof(text), "%s %ux%u, %u bits%s", format_name(i.format), i.width, i.height, i.bit_depth,
+                  i.progressive ? ", progressive" : "");
+    return text;
+}
+
+static bool same_info(const image_probe_info& a, const image_probe_info& b) {
+    return a.format == b.format && a.width == b.width && a.height == b.height && a.bit_depth == b.bit_depth &&
+           a.progressive == b.progressive;
+}
+
+// Probes the first size bytes from a buffer of exactly that size
+static bool probe_prefix(const bytes& data, size_t size, image_probe_info& out) {
+    std::vector<unsigned char> copy(data.begin(), data.begin() + size);
+    return probe_image_header(copy.empty() ? nullptr : copy.data(), size, out);
+}
+
+int main() {
+    std::vector<probe_case> cases = make_cases();
+    size_t probes = 0, failures = 0;
+    for (const auto& c : cases) {
+        bool expect_ok = c.header_bytes != 0;
+        if (expect_ok && c.header_bytes > c.data.size()) {
+            std::printf("%s: header_bytes %zu beyond the %zu test bytes\n", c.name, c.header_bytes, c.data.size());
+            failures++;
+            continue;
+        }
+        for (size_t size = 0; size <= c.data.size(); size++) {
+            image_probe_info out;
+            bool ok = probe_prefix(c.data, size, out);
+            probes++;
+            bool want_ok = expect_ok && size >= c.header_bytes;
+            if (ok == want_ok && (!ok || same_info(out, c.expected))) continue;
+            std::printf("%s, first %zu of %zu bytes:\n    expected %s\n    actual   %s\n", c.name, size, c.data.size(),
+                        describe(want_ok, c.expected).c_str(), describe(ok, out).c_str());
+            failures++;
+            break;
+        }
+    }
+
+    image_probe_info out;
+    if (probe_image_header(nullptr, 100, out)) {
+        std::printf("null data: expected not recognised\n");
+        failures++;
+    }
+
+    std::printf("image_probe_test: %zu headers, %zu probes\n", cases.size(), probes);
+    gate::result result;
+    result.at_most("failing cases", (double)failures, 0);
+    return result.exit_code();
+}
@@ -0,0 +1,213 @@
+// Provider response fixtures: regression check and DOM vs. streaming benchmark.
+//
+//   json_bench <fixtures/providers> [--update] [--max-alloc-ratio R]
+//
+// Each fixture is extracted with json_extractor using the same schema as its parser
+// in artwork_manager.cpp. The result must equal <fixture>.expected and what a full
+// nlohmann::json DOM yields for the same paths. Time and allocations per parse are
+// then compared between the two; the streaming parse fails the gate if it needs
+// more than R times the DOM's allocations.
+#include "json_extractor.h"
+#include "support/alloc_counter.h"
+#include "support/gate_util.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+struct provider_schema {
+    const char* fixture;
+    const char* records;
+    std::vector<const char*> fields;
+    std::vector<const char*> header;
+};
+
+// Keep in sync with the json_extractor schemas of the parse_*_json functions
+static const provider_schema SCHEMAS[] = {
+    { "itunes_search.json", "results", { "trackName", "collectionName", "artistName", "trackTimeMillis",
+        "artworkUrl600", "artworkUrl512", "artworkUrl100", "artworkUrl60", "artworkUrl30" }, {} },
+    { "deezer_search.json", "data", { "title", "artist.name", "rank", "duration", "album.title",
+        "album.cover_small", "album.cover_medium", "album.cover_big", "album.cover_xl" }, {} },
+    { "lastfm_track_getinfo.json", "track.album.image", { "size", "#text" },
+        { "track.name", "track.artist.name", "track.duration", "track.album.title" } },
+    { "discogs_search.json", "results", { "title", "thumb", "cover_image" }, {} },
+    { "musicbrainz_recordings.json", "recordings", { "title", "length", "artist-credit[].name", "artist-credit[].artist.name",
+        "releases[].id", "releases[].title" }, {} },
+};
+
+// "record" (or "header") followed by "field=value" for every value, fields in schema
+// order, values of one field in document order
+typedef std::vector<std::vector<std::string>> record_values;   // [field][n]
+
+static std::string serialize(const char* kind, const std::vector<const char*>& names, const record_values& values) {
+    std::string line = kind;
+    for (size_t f = 0; f < names.size(); f++) {
+        for (const auto& v : values[f]) {
+            line += '\t';
+            line += names[f];
+            line += '=';
+            line += v;
+        }
+    }
+    return line;
+}
+
+static std::vector<std::string> extract_streaming(const provider_schema& schema, const std::string& text) {
+    std::vector<std::string> lines;
+    json_extractor extractor(schema.records, schema.fields, schema.header);
+    bool ok = extractor.parse(text.data(), text.size(), [&](const json_record& rec) {
+        record_values values(schema.fields.size());
+        for (size_t f = 0; f < schema.fields.size(); f++) {
+            rec.for_each((int)f, [&](const std::string& v) { values[f].push_back(v); });
+        }
+        lines.push_back(serialize("record", schema.fields, values));
+        return true;
+    });
+    if (!ok) lines.push_back("<parse error>");
+
+    record_values header(schema.header.size());
+    for (size_t f = 0; f < schema.header.size(); f++) {
+        extractor.header().for_each((int)f, [&](const std::string& v) { header[f].push_back(v); });
+    }
+    if (!schema.header.empty()) lines.insert(lines.begin(), serialize("header", schema.header, header));
+    return lines;
+}
+
+// Nodes at a path relative to node ("artist-credit[].artist.name")
+static void dom_nodes(const nlohmann::json& node, const std::string& path, std::vector<const nlohmann::json*>& out) {
+    if (path.empty()) {
+        out.push_back(&node);
+        return;
+    }
+    size_t dot = path.find('.');
+    std::string segment = path.substr(0, dot);
+    std::string rest = dot == std::string::npos ? std::string() : path.substr(dot + 1);
+
+    bool is_array = segment.size() > 2 && segment.compare(segment.size() - 2, 2, "[]") == 0;
+    if (is_array) segment.resize(segment.size() - 2);
+    if (!node.is_object()) return;
+    auto it = node.find(segment);
+    if (it == node.end()) return;
+    if (!is_array) {
+        dom_nodes(*it, rest, out);
+    } else if (it->is_array()) {
+        for (const auto& element : *it) dom_nodes(element, rest, out);
+    }
+}
+
+static void dom_values(const nlohmann::json& node, const char* path, std::vector<std::string>& out) {
+    std::vector<const nlohmann::json*> nodes;
+    dom_nodes(node, path, nodes);
+    for (const auto* n : nodes) {
+        if (n->is_string()) out.push_back(n->get<std::string>());
+        else if (n->is_number() || n->is_boolean()) out.push_back(n->dump());
+    }
+}
+
+static std::vector<std::string> extract_dom(const provider_schema& schema, const std::string& text) {
+    std::vector<std::string> lines;
+    nlohmann::json root = nlohmann::json::parse(text, nullptr, false);
+    if (root.is_discarded()) return { "<parse error>" };
+
+    std::vector<const nlohmann::json*> records;
+    dom_nodes(root, std::string(schema.records) + "[]", records);
+    for (const auto* rec : records) {
+        if (!rec->is_object()) continue;
+        record_values values(schema.fields.size());
+        for (size_t f = 0; f < schema.fields.size(); f++) dom_values(*rec, schema.fields[f], values[f]);
+        lines.push_back(serialize("record", schema.fields, values));
+    }
+    if (!schema.header.empty()) {
+        record_values header(schema.header.size());
+        for (size_t f = 0; f < schema.header.size(); f++) dom_values(root, schema.header[f], header[f]);
+        lines.insert(lines.begin(), serialize("header", schema.header, header));
+    }
+    return lines;
+}
+
+// Parses repeatedly for at least min_seconds; returns microseconds per parse
+template <typename Parse>
+static double measure(Parse parse, double& allocs_per_parse, double min_seconds = 0.2) {
+    size_t parses = 0;
+    uint64_t allocs_before = allocation_count();
+    auto start = gate::timer::now();
+    double elapsed = 0;
+    do {
+        parse();
+        parses++;
+        elapsed = gate::seconds_since(start);
+    } while (elapsed < min_seconds);
+    allocs_per_parse = (double)(allocation_count() - allocs_before) / parses;
+    return elapsed * 1e6 / parses;
+}
+
+int main(int argc, char** argv) {
+    std::vector<const char*> dirs = gate::positional(argc, argv);
+    if (dirs.size() != 1) {
+        std::fprintf(stderr, "usage: json_bench <fixtures/providers> [--update] [--max-alloc-ratio R]\n");
+        return 2;
+    }
+    bool update = gate::flag(argc, argv, "--update");
+    double max_alloc_ratio = gate::option(argc, argv, "--max-alloc-ratio", 1.0);
+
+    gate::result result;
+    std::printf("  %-30s %8s %10s %10s %10s %10s\n", "fixture", "bytes", "dom us", "sax us", "dom allocs", "sax allocs");
+    for (const auto& schema : SCHEMAS) {
+        std::string dir = dirs[0];
+        std::string path = dir + "/" + schema.fixture;
+        std::string expected_path = path + ".expected";
+        std::string text;
+        if (!gate::read_file(path.c_str(), text)) return 2;
+
+        std::vector<std::string> streamed = extract_streaming(schema, text);
+        if (update) {
+            std::ofstream out(expected_path, std::ios::binary | std::ios::trunc);
+            for (const auto& line : streamed) out << line << "\n";
+            std::printf("updated %s (%zu lines)\n", expected_path.c_str(), streamed.size());
+            continue;
+        }
+
+        std::vector<std::string> expected;
+        if (!gate::read_lines(expected_path.c_str(), expected)) return 2;
+        std::vector<std::string> dom = extract_dom(schema, text);
+        if (streamed != expected) {
+            std::printf("%s: streaming extraction differs from %s\n", schema.fixture, expected_path.c_str());
+            for (size_t i = 0; i < (std::max)(streamed.size(), expected.size()); i++) {
+                const char* actual_line = i < streamed.size() ? streamed[i].c_str() : "<missing>";
+                const char* expected_line = i < expected.size() ? expected[i].c_str() : "<missing>";
+                if (std::string(actual_line) != expected_line) {
+                    std::printf("    expected %s\n    actual   %s\n", expected_line, actual_line);
+                    break;
+                }
+            }
+            result.fail();
+        }
+        if (streamed != dom) {
+            std::printf("%s: streaming extraction differs from the DOM\n", schema.fixture);
+            result.fail();
+        }
+
+        // The DOM side reads the same fields the parsers used to read, copying each value out
+        double dom_allocs = 0, sax_allocs = 0;
+        double dom_us = measure([&] {
+            nlohmann::json root = nlohmann::json::parse(text, nullptr, false);
+            std::vector<const nlohmann::json*> records;
+            dom_nodes(root, std::string(schema.records) + "[]", records);
+            std::vector<std::string> values;
+            for (const auto* rec : records) {
+                for (const char* field : schema.fields) dom_values(*rec, field, values);
+            }
+        }, dom_allocs);
+        double sax_us = measure([&] {
+            json_extractor extractor(schema.records, schema.fields, schema.header);
+            extractor.parse(text.data(), text.size(), [](const json_record&) { return true; });
+        }, sax_allocs);
+
+        std::printf("  %-30s %8zu %10.1f %10.1f %10.0f %10.0f\n", schema.fixture, text.size(), dom_us, sax_us, dom_allocs, sax_allocs);
+        std::string what = std::string(schema.fixture) + " allocations sax/dom";
+        result.at_most(what.c_str(), sax_allocs / dom_allocs, max_alloc_ratio);
+    }
+    return update ? 0 : result.exit_code();
+}
@@ -0,0 +1,184 @@
+// Regression gate for MetadataCleaner and the provider-result matchers.
+//
+//   metadata_gate <icy_titles.tsv> <tag_pairs.tsv> [--update]
+//                 [--min-strings-per-sec N] [--max-allocs-per-string N]
+//                 [--min-pairs-per-sec N] [--max-allocs-per-pair N]
+//
+// Every corpus line carries its expected output; any difference fails the gate,
+// as does throughput below or allocations above the given limits. --update
+// rewrites the expected columns from the current code (review the diff!).
+#include "metadata_cleaner.h"
+#include "track_matcher.h"
+#include "candidate_ranker.h"
+#include "support/alloc_counter.h"
+#include "support/gate_util.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// icy_titles.tsv: raw artist, raw title, then the StreamMetadataResult fields
+static const size_t ICY_INPUTS = 2;
+static const size_t ICY_COLUMNS = ICY_INPUTS + 7;
+
+static std::vector<std::string> sanitize_row(const std::string& artist, const std::string& title) {
+    StreamMetadataResult r = MetadataCleaner::sanitize_stream_metadata(artist.c_str(), title.c_str());
+    return { artist, title, r.clean_artist, r.clean_title, r.first_artist, r.second_artist, r.primary_title,
+             r.is_valid_search ? "1" : "0", r.is_station_or_url ? "1" : "0" };
+}
+
+// tag_pairs.tsv: query artist, query title, query seconds, candidate artist, title,
+// release, seconds, then artists_match and score_candidate (3 decimals)
+static const size_t PAIR_INPUTS = 7;
+static const size_t PAIR_COLUMNS = PAIR_INPUTS + 2;
+
+static std::vector<std::string> match_row(const std::vector<std::string>& in) {
+    artist_match_key query(in[0]);
+    artist_match_key candidate(in[3]);
+    std::string title_key = normalize_for_matching(in[1]);
+    double score = score_candidate(query, title_key, (unsigned)std::atoi(in[2].c_str()),
+                                   in[3], in[4], in[5], (unsigned)std::atoi(in[6].c_str()));
+    char score_text[16];
+    std::snprintf(score_text, sizeof(score_text), "%.3f", score);
+
+    std::vector<std::string> out(in.begin(), in.begin() + PAIR_INPUTS);
+    out.push_back(artists_match(candidate, query) ? "1" : "0");
+    out.push_back(score_text);
+    return out;
+}
+
+static std::string join(const std::vector<std::string>& fields) {
+    std::string line;
+    for (size_t i = 0; i < fields.size(); i++) {
+        if (i) line += '\t';
+        line += fields[i];
+    }
+    return line;
+}
+
+static const char* const ICY_NAMES[] = { "raw_artist", "raw_title", "clean_artist", "clean_title", "first_artist",
+                                         "second_artist", "primary_title", "is_valid_search", "is_station_or_url" };
+static const char* const PAIR_NAMES[] = { "query_artist", "query_title", "query_seconds", "artist", "title", "release",
+                                          "seconds", "artists_match", "score" };
+
+// Compares (or with update, replaces) the expected columns of every row.
+// Returns the number of mismatching rows.
+template <typename Compute>
+static size_t verify(const char* name, std::vector<std::string>& rows, size_t inputs, size_t columns,
+                     const char* const* column_names, bool update, Compute compute) {
+    size_t mismatches = 0;
+    for (auto& row : rows) {
+        std::vector<std::string> expected = gate::split(row);
+        if (expected.size() < inputs) {
+            std::printf("%s: malformed line: %s\n", name, row.c_str());
+            mismatches++;
+            continue;
+        }
+        expected.resize((std::max)(expected.size(), columns));
+        std::vector<std::string> actual = compute(expected);
+        if (update) {
+            row = join(actual);
+            continue;
+        }
+        for (size_t i = inputs; i < columns; i++) {
+            if (actual[i] == expected[i]) continue;
+            if (mismatches < 25) {
+                std::printf("%s: %s for \"%s\" / \"%s\"\n    expected \"%s\"\n    actual   \"%s\"\n", name, column_names[i],
+                            expected[0].c_str(), expected[1].c_str(), expected[i].c_str(), actual[i].c_str());
+            }
+            mismatches++;
+            break;
+        }
+    }
+    return mismatches;
+}
+
+static bool rewrite(const char* path, const std::vector<std::string>& comments, const std::vector<std::string>& rows) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    for (const auto& line : comments) out << line << "\n";
+    for (const auto& line : rows) out << line << "\n";
+    return (bool)out;
+}
+
+// Runs body over the corpus until at least min_seconds have passed; returns calls per
+// second and stores the allocations per call
+template <typename Body>
+static double measure(size_t corpus_size, Body body, double& allocs_per_call, double min_seconds = 0.5) {
+    size_t calls = 0;
+    uint64_t allocs_before = allocation_count();
+    auto start = gate::timer::now();
+    double elapsed = 0;
+    do {
+        for (size_t i = 0; i < corpus_size; i++) body(i);
+        calls += corpus_size;
+        elapsed = gate::seconds_since(start);
+    } while (elapsed < min_seconds);
+    allocs_per_call = (double)(allocation_count() - allocs_before) / calls;
+    return calls / elapsed;
+}
+
+int main(int argc, char** argv) {
+    std::vector<const char*> files = gate::positional(argc, argv);
+    if (files.size() != 2) {
+        std::fprintf(stderr, "usage: metadata_gate <icy_titles.tsv> <tag_pairs.tsv> [--update] [limits]\n");
+        return 2;
+    }
+    bool update = gate::flag(argc, argv, "--update");
+
+    std::vector<std::string> icy_rows, icy_comments, pair_rows, pair_comments;
+    if (!gate::read_lines(files[0], icy_rows, &icy_comments) || !gate::read_lines(files[1], pair_rows, &pair_comments)) {
+        return 2;
+    }
+
+    size_t icy_mismatches = verify("icy_titles", icy_rows, ICY_INPUTS, ICY_COLUMNS, ICY_NAMES, update,
+        [](const std::vector<std::string>& row) { return sanitize_row(row[0], row[1]); });
+    size_t pair_mismatches = verify("tag_pairs", pair_rows, PAIR_INPUTS, PAIR_COLUMNS, PAIR_NAMES, update, match_row);
+
+    if (update) {
+        bool ok = rewrite(files[0], icy_comments, icy_rows) && rewrite(files[1], pair_comments, pair_rows);
+        std::printf("updated %zu ICY titles and %zu tag pairs\n", icy_rows.size(), pair_rows.size());
+        return ok ? 0 : 1;
+    }
+
+    // Timed runs work on the parsed inputs only
+    std::vector<std::pair<std::string, std::string>> icy_inputs;
+    for (const auto& row : icy_rows) {
+        std::vector<std::string> f = gate::split(row);
+        icy_inputs.emplace_back(f[0], f.size() > 1 ? f[1] : std::string());
+    }
+    std::vector<std::vector<std::string>> pair_inputs;
+    for (const auto& row : pair_rows) {
+        std::vector<std::string> f = gate::split(row);
+        f.resize(PAIR_COLUMNS);
+        pair_inputs.push_back(f);
+    }
+
+    // The cleaner memoizes its last few inputs; cycling through the corpus keeps every call a miss
+    double cleaner_allocs = 0;
+    double cleaner_rate = measure(icy_inputs.size(), [&](size_t i) {
+        MetadataCleaner::sanitize_stream_metadata(icy_inputs[i].first.c_str(), icy_inputs[i].second.c_str());
+    }, cleaner_allocs);
+
+    // A parser builds the query key once and one key per candidate
+    double match_allocs = 0;
+    double match_rate = measure(pair_inputs.size(), [&](size_t i) {
+        const auto& p = pair_inputs[i];
+        artist_match_key query(p[0]);
+        artist_match_key candidate(p[3]);
+        volatile bool same = artists_match(candidate, query);
+        volatile double score = score_candidate(query, normalize_for_matching(p[1]), 0, p[3], p[4], p[5], 0);
+        (void)same;
+        (void)score;
+    }, match_allocs);
+
+    gate::result result;
+    std::printf("metadata_gate: %zu ICY titles, %zu tag pairs\n", icy_rows.size(), pair_rows.size());
+    result.at_most("ICY title mismatches", (double)icy_mismatches, 0);
+    result.at_most("tag pair mismatches", (double)pair_mismatches, 0);
+    result.at_least("sanitize_stream_metadata strings/s", cleaner_rate, gate::option(argc, argv, "--min-strings-per-sec", 0));
+    result.at_most("sanitize_stream_metadata allocations/string", cleaner_allocs, gate::option(argc, argv, "--max-allocs-per-string", 1e9));
+    result.at_least("match + score pairs/s", match_rate, gate::option(argc, argv, "--min-pairs-per-sec", 0));
+    result.at_most("match + score allocations/pair", match_allocs, gate::option(argc, argv, "--max-allocs-per-pair", 1e9));
+    return result.exit_code();
+}
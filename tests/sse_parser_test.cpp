@@ -0,0 +1,152 @@
+// Tests for the Server-Sent Events parser behind the AzuraCast real-time feed.
+//
+//   sse_parser_test
+//
+// Every stream below is fed whole, one byte at a time and split at every possible
+// one or two points, so each line ending, field and event boundary also falls
+// across a chunk boundary somewhere. All feedings must report the same events and
+// the same retry: value.
+#include "sse_parser.h"
+#include "support/gate_util.h"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+struct sse_case {
+    const char* name;
+    std::string stream;
+    std::vector<std::string> events;
+    unsigned retry_ms;
+};
+
+static const std::string AZURACAST_CONNECT =
+    "{\"connect\":{\"client\":\"4c5e\",\"subs\":{\"station:radio\":{\"publications\":[{\"data\":{\"np\":"
+    "{\"now_playing\":{\"song\":{\"artist\":\"Daft Punk\",\"title\":\"One More Time\"}}}}}]}}}}";
+static const std::string AZURACAST_PUB =
+    "{\"channel\":\"station:radio\",\"pub\":{\"data\":{\"np\":{\"now_playing\":{\"song\":"
+    "{\"artist\":\"Sigur R\xc3\xb3s\",\"title\":\"Hopp\xc3\xadpolla\"}}}}}}";
+
+static const sse_case CASES[] = {
+    { "single event, LF", "data: hello\n\n", { "hello" }, 0 },
+    { "CRLF line endings", "data: a\r\n\r\ndata: b\r\n\r\n", { "a", "b" }, 0 },
+    { "CR line endings", "data: a\r\rdata: b\r\r", { "a", "b" }, 0 },
+    { "mixed line endings", "data: a\r\n\ndata: b\r\rdata: c\n\r\n", { "a", "b", "c" }, 0 },
+    { "multi-line data", "data: first\ndata: second\r\ndata:third\n\n", { "first\nsecond\nthird" }, 0 },
+    { "JSON split over data lines", "data: {\"np\":\ndata:  {\"a\": 1}}\n\n", { "{\"np\":\n {\"a\": 1}}" }, 0 },
+    { "no space after colon", "data:x\n\n", { "x" }, 0 },
+    { "only one leading space removed", "data:  two\n\n", { " two" }, 0 },
+    { "colon inside the value", "data: a: b\n\n", { "a: b" }, 0 },
+    { "field without colon", "data\n\n", { "" }, 0 },
+    { "empty data line", "data:\ndata: x\n\n", { "\nx" }, 0 },
+    { "comments and keep-alives", ": ping\n\n:\ndata: a\n: in between\ndata: b\n\n", { "a\nb" }, 0 },
+    { "event, id and unknown fields", "event: update\nid: 7\nfoo: bar\ndata: x\n\n", { "x" }, 0 },
+    { "blank lines without data", "\n\n\r\n\r\r", {}, 0 },
+    { "unterminated event is dropped", "data: a\n\ndata: b\n", { "a" }, 0 },
+    { "unterminated line is dropped", "data: a\n\ndata: b", { "a" }, 0 },
+    { "retry alone", "retry: 5000\n\n", {}, 5000 },
+    { "retry with an event", "retry: 3000\ndata: x\n\n", { "x" }, 3000 },
+    { "later retry wins", "retry: 3000\n\nretry: 10000\r\n\r\n", {}, 10000 },
+    { "invalid retry ignored", "retry: 2000\n\nretry: 5s\nretry:\nretry: -1\nretry: 1.5\ndata: x\n\n", { "x" }, 2000 },
+    { "retry without space", "retry:250\n\n", {}, 250 },
+    { "UTF-8 data", "data: Bj\xc3\xb6rk \xe2\x80\x93 J\xc3\xb3ga\n\n", { "Bj\xc3\xb6rk \xe2\x80\x93 J\xc3\xb3ga" }, 0 },
+    { "AzuraCast connect and publication",
+      "retry: 3000\r\ndata: " + AZURACAST_CONNECT + "\r\n\r\n: ping\r\n\r\ndata: {}\r\n\r\ndata: " + AZURACAST_PUB + "\r\n\r\n",
+      { AZURACAST_CONNECT, "{}", AZURACAST_PUB }, 3000 },
+};
+
+struct sse_outcome {
+    std::vector<std::string> events;
+    unsigned retry_ms = 0;
+};
+
+// Feeds stream in the given chunks (split points in ascending order)
+static sse_outcome feed(const std::string& stream, const std::vector<size_t>& splits) {
+    sse_outcome outcome;
+    sse_parser parser;
+    auto on_event = [&](const std::string& data) { outcome.events.push_back(data); };
+    size_t start = 0;
+    for (size_t split : splits) {
+        parser.feed(stream.data() + start, split - start, on_event);
+        start = split;
+    }
+    parser.feed(stream.data() + start, stream.size() - start, on_event);
+    outcome.retry_ms = parser.retry_ms();
+    return outcome;
+}
+
+static std::string describe(const std::vector<size_t>& splits) {
+    if (splits.empty()) return "whole";
+    std::string text = "split at";
+    for (size_t split : splits) text += " " + std::to_string(split);
+    return text;
+}
+
+static std::string printable(const std::string& s) {
+    std::string out;
+    for (char c : s) {
+        if (c == '\n') out += "\\n";
+        else if (c == '\r') out += "\\r";
+        else out += c;
+    }
+    return out;
+}
+
+// Returns false (and prints the first difference) if outcome is not what sse_case expects
+static bool check(const sse_case& c, const sse_outcome& outcome, const std::string& how) {
+    if (outcome.events == c.events && outcome.retry_ms == c.retry_ms) return true;
+    std::printf("%s (%s):\n", c.name, how.c_str());
+    if (outcome.retry_ms != c.retry_ms) std::printf("    retry_ms expected %u, got %u\n", c.retry_ms, outcome.retry_ms);
+    for (size_t i = 0; i < (std::max)(outcome.events.size(), c.events.size()); i++) {
+        std::string expected = i < c.events.size() ? "\"" + printable(c.events[i]) + "\"" : "<none>";
+        std::string actual = i < outcome.events.size() ? "\"" + printable(outcome.events[i]) + "\"" : "<none>";
+        if (expected != actual) {
+            std::printf("    event %zu expected %s\n    event %zu actual   %s\n", i, expected.c_str(), i, actual.c_str());
+            break;
+        }
+    }
+    return false;
+}
+
+int main() {
+    size_t feedings = 0, failures = 0;
+    for (const auto& c : CASES) {
+        const size_t n = c.stream.size();
+        bool failed = !check(c, feed(c.stream, {}), "whole");
+        feedings++;
+
+        std::vector<size_t> bytes;
+        for (size_t i = 1; i < n; i++) bytes.push_back(i);
+        if (!failed) failed = !check(c, feed(c.stream, bytes), "one byte at a time");
+        feedings++;
+
+        for (size_t a = 1; a < n && !failed; a++) {
+            failed = !check(c, feed(c.stream, { a }), describe({ a }));
+            feedings++;
+            for (size_t b = a + 1; b < n && !failed; b++) {
+                failed = !check(c, feed(c.stream, { a, b }), describe({ a, b }));
+                feedings++;
+            }
+        }
+        if (failed) failures++;
+    }
+
+    // reset() drops a half-received event and the retry value
+    sse_parser parser;
+    std::vector<std::string> events;
+    auto on_event = [&](const std::string& data) { events.push_back(data); };
+    std::string partial = "retry: 4000\ndata: stale\r";
+    parser.feed(partial.data(), partial.size(), on_event);
+    parser.reset();
+    std::string fresh = "\ndata: fresh\n\n";
+    parser.feed(fresh.data(), fresh.size(), on_event);
+    if (events != std::vector<std::string>{ "fresh" } || parser.retry_ms() != 0) {
+        std::printf("reset: expected one \"fresh\" event and no retry, got %zu event(s) and retry %u\n", events.size(), parser.retry_ms());
+        failures++;
+    }
+
+    std::printf("sse_parser_test: %zu streams, %zu feedings\n", (size_t)(sizeof(CASES) / sizeof(CASES[0])), feedings);
+    gate::result result;
+    result.at_most("failing cases", (double)failures, 0);
+    return result.exit_code();
+}
@@ -0,0 +1,6 @@
+#pragma once
+#include <cstdint>
+
+// Number of global operator new calls since the program started. Linking
+// alloc_counter.cpp replaces the global allocation functions to count them.
+uint64_t allocation_count();
@@ -0,0 +1,108 @@
+#pragma once
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Helpers shared by the regression gates: corpus files, options and thresholds.
+namespace gate {
+
+// Lines of a corpus file without the trailing "\r"; lines starting with '#' are
+// returned in comments (if given) and skipped otherwise
+inline bool read_lines(const char* path, std::vector<std::string>& lines, std::vector<std::string>* comments = nullptr) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::fprintf(stderr, "cannot open %s\n", path);
+        return false;
+    }
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) continue;
+        if (line[0] == '#') {
+            if (comments) comments->push_back(line);
+            continue;
+        }
+        lines.push_back(line);
+    }
+    return true;
+}
+
+inline bool read_file(const char* path, std::string& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::fprintf(stderr, "cannot open %s\n", path);
+        return false;
+    }
+    out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return true;
+}
+
+inline std::vector<std::string> split(const std::string& line, char separator = '\t') {
+    std::vector<std::string> fields;
+    size_t start = 0;
+    for (;;) {
+        size_t end = line.find(separator, start);
+        fields.push_back(line.substr(start, end == std::string::npos ? std::string::npos : end - start));
+        if (end == std::string::npos) break;
+        start = end + 1;
+    }
+    return fields;
+}
+
+// "--name value" from the command line, or fallback
+inline double option(int argc, char** argv, const char* name, double fallback) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::strcmp(argv[i], name) == 0) return std::atof(argv[i + 1]);
+    }
+    return fallback;
+}
+
+inline bool flag(int argc, char** argv, const char* name) {
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], name) == 0) return true;
+    }
+    return false;
+}
+
+// Positional arguments: everything that is not "--update" or a "--name value" option
+inline std::vector<const char*> positional(int argc, char** argv) {
+    std::vector<const char*> args;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--update") == 0) continue;
+        if (std::strncmp(argv[i], "--", 2) == 0) {
+            i++;
+            continue;
+        }
+        args.push_back(argv[i]);
+    }
+    return args;
+}
+
+typedef std::chrono::steady_clock timer;
+
+inline double seconds_since(timer::time_point start) {
+    return std::chrono::duration<double>(timer::now() - start).count();
+}
+
+// Pass/fail bookkeeping; every check is printed so a CI log shows the measured
+// values next to their limits
+class result {
+public:
+    void check(bool ok, const char* what, double value, const char* op, double limit) {
+        std::printf("  %-44s %12.2f  (%s %.2f)  %s\n", what, value, op, limit, ok ? "ok" : "FAIL");
+        if (!ok) m_failed = true;
+    }
+    void at_least(const char* what, double value, double limit) { check(value >= limit, what, value, ">=", limit); }
+    void at_most(const char* what, double value, double limit) { check(value <= limit, what, value, "<=", limit); }
+    void fail() { m_failed = true; }
+    int exit_code() const { return m_failed ? 1 : 0; }
+
+private:
+    bool m_failed = false;
+};
+
+} // namespace gate
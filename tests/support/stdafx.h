@@ -0,0 +1,11 @@
+#pragma once
+
+// Stand-in for the component's precompiled header when the SDK-independent sources
+// are built on their own: no Windows or foobar2000 headers, only what those
+// sources take from it.
+#include <cstddef>
+#include <string>
+
+#ifndef _countof
+#define _countof(a) (sizeof(a) / sizeof((a)[0]))
+#endif
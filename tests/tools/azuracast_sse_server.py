@@ -0,0 +1,227 @@
+#!/usr/bin/env python3
+"""Stand-in AzuraCast server for trying the real-time now-playing feed by hand.
+
+Serves what foo_artwork talks to on an AzuraCast station:
+
+  /listen/<station>/radio.mp3         the audio file given with --audio, looped
+  /api/nowplaying[/<station>]         now-playing JSON (what the poller and the probe read)
+  /api/live/nowplaying/sse            Centrifugo-style event stream: the current song
+                                      replayed on connect, then one publication per song
+  /art/<n>.png                        a solid-colour cover for song n
+
+The song changes every --song-seconds. The options below reproduce the stream
+conditions the SSE parser and the reconnect logic have to cope with; see
+"Offline Tests and Benchmarks" in README.md for how to point foobar2000 at it.
+Only the Python standard library is needed.
+"""
+
+import argparse
+import json
+import os
+import struct
+import time
+import zlib
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlparse
+
+SONGS = [
+    ("Daft Punk", "One More Time"),
+    ("Sigur Rós", "Hoppípolla"),
+    ("Earth, Wind & Fire", "September"),
+    ("Кино", "Группа крови"),
+    ("The Chemical Brothers", "Hey Boy Hey Girl"),
+]
+COLOURS = [(200, 40, 40), (40, 160, 80), (230, 170, 30), (60, 90, 200), (150, 50, 170)]
+
+LINE_ENDINGS = {"lf": b"\n", "crlf": b"\r\n", "cr": b"\r"}
+
+
+def solid_png(rgb, size=600):
+    """Encodes a size x size PNG of one colour."""
+    def chunk(kind, data):
+        body = kind + data
+        return struct.pack(">I", len(data)) + body + struct.pack(">I", zlib.crc32(body) & 0xFFFFFFFF)
+
+    row = b"\x00" + bytes(rgb) * size
+    return (b"\x89PNG\r\n\x1a\n"
+            + chunk(b"IHDR", struct.pack(">IIBBBBB", size, size, 8, 2, 0, 0, 0))
+            + chunk(b"IDAT", zlib.compress(row * size, 9))
+            + chunk(b"IEND", b""))
+
+
+class Station:
+    def __init__(self, args):
+        self.args = args
+        self.started = time.time()
+
+    def song_index(self, at=None):
+        return int(((at or time.time()) - self.started) // self.args.song_seconds)
+
+    def now_playing(self, base_url):
+        index = self.song_index()
+        played_at = int(self.started + index * self.args.song_seconds)
+
+        def entry(n):
+            artist, title = SONGS[n % len(SONGS)]
+            return {"artist": artist, "title": title, "text": artist + " - " + title,
+                    "art": "%s/art/%d.png" % (base_url, n % len(SONGS))}
+
+        return {
+            "station": {"shortcode": self.args.station, "name": "foo_artwork test station",
+                        "listen_url": "%s/listen/%s/radio.mp3" % (base_url, self.args.station)},
+            "now_playing": {"song": entry(index), "played_at": played_at, "duration": self.args.song_seconds,
+                            "elapsed": int(time.time()) - played_at,
+                            "remaining": played_at + self.args.song_seconds - int(time.time())},
+            "playing_next": {"song": entry(index + 1)},
+        }
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    station = None
+
+    def base_url(self):
+        return "http://" + (self.headers.get("Host") or "%s:%d" % self.server.server_address[:2])
+
+    def send_body(self, status, content_type, body):
+        self.send_response(status)
+        self.send_header("Content-Type", content_type)
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    def do_GET(self):
+        url = urlparse(self.path)
+        parts = [p for p in url.path.split("/") if p]
+        args = self.station.args
+        try:
+            if parts[:2] == ["api", "nowplaying"] and len(parts) <= 3:
+                body = json.dumps(self.station.now_playing(self.base_url())).encode("utf-8")
+                self.send_body(200, "application/json; charset=utf-8", body)
+            elif url.path == "/api/live/nowplaying/sse":
+                if args.no_sse:
+                    self.send_body(404, "text/plain", b"no real-time feed\n")
+                else:
+                    self.event_stream(parse_qs(url.query))
+            elif len(parts) == 2 and parts[0] == "art" and parts[1].endswith(".png"):
+                n = int(parts[1][:-4]) % len(COLOURS)
+                self.send_body(200, "image/png", solid_png(COLOURS[n]))
+            elif parts[:1] == ["listen"] and args.audio:
+                self.audio_stream()
+            else:
+                self.send_body(404, "text/plain", b"not found\n")
+        except (BrokenPipeError, ConnectionResetError):
+            pass
+
+    def audio_stream(self):
+        self.send_response(200)
+        self.send_header("Content-Type", "audio/mpeg")
+        self.send_header("icy-name", "foo_artwork test station")
+        self.end_headers()
+        with open(self.station.args.audio, "rb") as f:
+            data = f.read()
+        # Roughly real time for a 128 kbit/s file, so the player does not buffer the whole loop
+        while True:
+            for offset in range(0, len(data), 16000):
+                self.wfile.write(data[offset:offset + 16000])
+                time.sleep(1.0)
+
+    def write_event_bytes(self, payload):
+        chunk = self.station.args.chunk
+        if not chunk:
+            self.wfile.write(payload)
+        else:
+            for offset in range(0, len(payload), chunk):
+                self.wfile.write(payload[offset:offset + chunk])
+                self.wfile.flush()
+                time.sleep(self.station.args.chunk_delay)
+        self.wfile.flush()
+
+    def event(self, data=None, comment=None):
+        args = self.station.args
+        eol = LINE_ENDINGS[args.line_ending]
+        lines = []
+        if comment is not None:
+            lines.append(b":" + comment.encode("utf-8"))
+        if data is not None:
+            text = json.dumps(data, ensure_ascii=False, indent=1 if args.multiline else None)
+            lines += [b"data: " + line.encode("utf-8") for line in text.split("\n")]
+        self.write_event_bytes(eol.join(lines) + eol + eol)
+
+    def event_stream(self, query):
+        args = self.station.args
+        channel = "station:" + args.station
+        self.log_message("SSE subscribe %s", query.get("cf_connect", ["(none)"])[0])
+
+        self.send_response(200)
+        self.send_header("Content-Type", "text/event-stream")
+        self.send_header("Cache-Control", "no-cache")
+        self.send_header("Connection", "close")
+        self.end_headers()
+        self.close_connection = True
+
+        eol = LINE_ENDINGS[args.line_ending]
+        if args.retry:
+            self.write_event_bytes(b"retry: %d" % args.retry + eol + eol)
+
+        connected = time.time()
+        np = self.station.now_playing(self.base_url())
+        self.event({"connect": {"client": "test-%d" % int(connected), "version": "5.0.0",
+                                "subs": {channel: {"recoverable": True, "publications": [{"data": {"np": np}}]}}}})
+
+        song = self.station.song_index()
+        last_ping = connected
+        while True:
+            time.sleep(0.25)
+            now = time.time()
+            if args.drop_after and now - connected >= args.drop_after:
+                self.log_message("SSE dropping the connection after %d s", args.drop_after)
+                return
+            if self.station.song_index(now) != song:
+                song = self.station.song_index(now)
+                self.event({"channel": channel, "pub": {"data": {"np": self.station.now_playing(self.base_url())}}})
+            elif now - last_ping >= args.ping_seconds:
+                last_ping = now
+                if args.comment_pings:
+                    self.event(comment=" ping")
+                else:
+                    self.event({})
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--port", type=int, default=8800)
+    parser.add_argument("--bind", default="127.0.0.1")
+    parser.add_argument("--station", default="test", help="station shortcode (default: test)")
+    parser.add_argument("--audio", help="MP3 file served, looped, at /listen/<station>/radio.mp3")
+    parser.add_argument("--song-seconds", type=int, default=30, help="length of every song (default: 30)")
+    parser.add_argument("--ping-seconds", type=int, default=25, help="keep-alive interval (default: 25, like Centrifugo)")
+    parser.add_argument("--comment-pings", action="store_true", help="send keep-alives as ':' comments instead of 'data: {}'")
+    parser.add_argument("--line-ending", choices=sorted(LINE_ENDINGS), default="lf")
+    parser.add_argument("--multiline", action="store_true", help="spread each JSON payload over many data: lines")
+    parser.add_argument("--chunk", type=int, default=0, help="write the stream N bytes at a time (0: whole events)")
+    parser.add_argument("--chunk-delay", type=float, default=0.01, help="pause between chunks in seconds (default: 0.01)")
+    parser.add_argument("--retry", type=int, default=0, help="send 'retry: MS' when a client connects")
+    parser.add_argument("--drop-after", type=int, default=0, help="close every event stream after N seconds")
+    parser.add_argument("--no-sse", action="store_true", help="answer 404 on the event stream (tests the fallback to polling)")
+    args = parser.parse_args()
+
+    if args.audio and not os.path.isfile(args.audio):
+        parser.error("no such file: " + args.audio)
+
+    Handler.station = Station(args)
+    server = ThreadingHTTPServer((args.bind, args.port), Handler)
+    server.daemon_threads = True
+    base = "http://%s:%d" % (args.bind, args.port)
+    print("Now-playing API:  %s/api/nowplaying/%s" % (base, args.station))
+    print("Event stream:     %s/api/live/nowplaying/sse" % base)
+    if args.audio:
+        print("Stream to play:   %s/listen/%s/radio.mp3" % (base, args.station))
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""Regenerates the search folding table in unicode_fold.cpp.
+
+Every assigned BMP code point whose folded form differs from itself gets an
+entry: NFKD, combining diacritical marks dropped, case folded, decomposed and
+stripped again, then the letters in ASCII_SPELLINGS replaced. The folded
+strings are packed into fold_pool (a string already in the pool is reused, also
+as a substring of a longer one) and fold_table maps each code point to an
+offset and length in it.
+
+The character data comes from Python's unicodedata module, so the Python
+version decides the Unicode version. The table was generated with Unicode 14.0
+(Python 3.11); another version is refused unless --unicode-version allows it,
+and the comment above the table has to be updated along with it.
+
+  python3 tests/tools/gen_unicode_fold.py            rewrite unicode_fold.cpp
+  python3 tests/tools/gen_unicode_fold.py --check    fail if it is out of date
+
+Only the Python standard library is needed.
+"""
+
+import argparse
+import os
+import sys
+import unicodedata
+
+DEFAULT_SOURCE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "unicode_fold.cpp")
+EXPECTED_UNICODE_VERSION = "14.0.0"
+
+# Letters without a decomposition that search folding still spells in ASCII
+ASCII_SPELLINGS = {
+    "æ": "ae", "ø": "o", "œ": "oe", "ð": "d", "đ": "d", "ł": "l", "ħ": "h", "ı": "i", "ŧ": "t", "þ": "th",
+    "ŀ": "l", "ƀ": "b", "ɨ": "i", "ʉ": "u", "ɍ": "r", "ɏ": "y", "ƶ": "z", "ȥ": "z", "ǥ": "g", "ĸ": "k",
+}
+
+# Letters whose mark is part of the letter rather than an accent
+KEEP_MARKS = {"й", "Й"}
+
+ACCENT_RANGES = [(0x0300, 0x036F), (0x1AB0, 0x1AFF), (0x1DC0, 0x1DFF), (0x20D0, 0x20FF), (0xFE20, 0xFE2F)]
+
+# Left composed: searching these by their decomposition finds nothing useful
+SKIPPED_RANGES = [
+    (0xD800, 0xDFFF),  # Surrogates
+    (0xAC00, 0xD7A3),  # Hangul syllables
+    (0xF900, 0xFAFF),  # CJK compatibility ideographs
+    (0x3200, 0x33FF),  # Enclosed CJK letters and compatibility squares
+    (0xFDF0, 0xFDFF),  # Arabic ligature words
+]
+
+POOL_START = "static const char fold_pool[] ="
+TABLE_START = "static const fold_entry fold_table[] = {"
+TABLE_END = "};"
+
+
+def is_accent(c):
+    o = ord(c)
+    return any(lo <= o <= hi for lo, hi in ACCENT_RANGES)
+
+
+def strip_accents(s):
+    return "".join(c for c in unicodedata.normalize("NFKD", s) if not is_accent(c))
+
+
+def fold(ch):
+    if ch in KEEP_MARKS:
+        return ch.lower()
+    folded = strip_accents(strip_accents(ch).casefold())
+    return "".join(ASCII_SPELLINGS.get(c, c) for c in folded)
+
+
+def fold_entries():
+    """(code point, folded string) for every BMP code point that folding changes."""
+    entries = []
+    for cp in range(0x80, 0x10000):
+        if any(lo <= cp <= hi for lo, hi in SKIPPED_RANGES):
+            continue
+        ch = chr(cp)
+        if unicodedata.category(ch) in ("Cn", "Co", "Cs"):
+            continue
+        folded = fold(ch)
+        if folded != ch:
+            entries.append((cp, folded))
+    return entries
+
+
+def pack(entries):
+    """The string pool and (code point, offset, length) rows pointing into it."""
+    pool = bytearray()
+    offsets = {}
+    rows = []
+    for cp, folded in entries:
+        data = folded.encode("utf-8")
+        offset = offsets.get(data)
+        if offset is None:
+            offset = pool.find(data) if data else -1
+            if offset < 0:
+                # Stripped code points point at the current end of the pool
+                offset = len(pool)
+                pool += data
+            offsets[data] = offset
+        rows.append((cp, offset, len(data)))
+    if len(pool) >= 0x10000 or max(length for _, _, length in rows) > 0xFF:
+        sys.exit("fold_pool no longer fits fold_entry's uint16_t offset / uint8_t length")
+    return pool, rows
+
+
+def render(pool, rows):
+    lines = [POOL_START]
+    for i in range(0, len(pool), 32):
+        lines.append('    "%s"' % "".join("\\x%02X" % b for b in pool[i:i + 32]))
+    lines[-1] += ";"
+    lines.append("")
+    lines.append(TABLE_START)
+    for i in range(0, len(rows), 8):
+        lines.append("    " + ", ".join("{0x%04X,%d,%d}" % row for row in rows[i:i + 8]) + ",")
+    lines.append(TABLE_END)
+    return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Regenerate the folding table in unicode_fold.cpp.")
+    parser.add_argument("--source", default=DEFAULT_SOURCE, help="unicode_fold.cpp to update")
+    parser.add_argument("--check", action="store_true", help="only report whether the table is up to date")
+    parser.add_argument("--unicode-version", default=EXPECTED_UNICODE_VERSION,
+                        help="Unicode version this Python must provide (default %(default)s)")
+    args = parser.parse_args()
+
+    if unicodedata.unidata_version != args.unicode_version:
+        sys.exit("this Python provides Unicode %s, the table is generated from %s"
+                 % (unicodedata.unidata_version, args.unicode_version))
+
+    with open(args.source, encoding="utf-8", newline="") as f:
+        text = f.read()
+    newline = "\r\n" if "\r\n" in text else "\n"
+    lines = text.split(newline)
+    try:
+        start = lines.index(POOL_START)
+        end = lines.index(TABLE_END, lines.index(TABLE_START, start))
+    except ValueError:
+        sys.exit("%s: fold_pool / fold_table not found" % args.source)
+
+    pool, rows = pack(fold_entries())
+    generated = render(pool, rows)
+    if args.check:
+        if lines[start:end + 1] != generated:
+            sys.exit("%s is out of date; run %s" % (args.source, os.path.relpath(__file__)))
+        print("%d entries, %d pool bytes: up to date" % (len(rows), len(pool)))
+        return
+
+    lines[start:end + 1] = generated
+    with open(args.source, "w", encoding="utf-8", newline="") as f:
+        f.write(newline.join(lines))
+    print("%d entries, %d pool bytes written to %s" % (len(rows), len(pool), args.source))
+
+
+if __name__ == "__main__":
+    main()
@@ -5,69 +5,346 @@
 #include "async_io_manager.h"
 #include "preferences.h"
 #include <shlwapi.h>
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
-static std::mutex g_tf_mutex;
-static pfc::string8 g_tf_artist;
-static pfc::string8 g_tf_title;
-static pfc::string8 g_tf_cover;
-static pfc::string8 g_tf_source;
-static pfc::string8 g_tf_track_path;
+// Artwork info of the current track, published as an immutable snapshot. Field
+// rendering runs for every visible playlist row on several threads; reading the
+// snapshot costs one reference count instead of a mutex and five string copies.
+// Writers build a new snapshot and swap it in under g_tf_write_mutex.
+struct tf_artwork_info {
+    metadb_handle_ptr track;
+    pfc::string8 track_path;
+    pfc::string8 artist;
+    pfc::string8 title;
+    pfc::string8 cover;
+    pfc::string8 source;
+    bool from_cache_check = false;                      // Recorded by process_field checking the disk cache
+    std::chrono::steady_clock::time_point checked_at;   // Recorded or last confirmed at this time
+};
+
+static std::mutex g_tf_write_mutex;
+static std::shared_ptr<const tf_artwork_info> g_tf_info;
+
+// MSVC implements std::atomic_load/atomic_store on shared_ptr with one spin lock
+// shared by every such call in the process, which would serialize all row readers.
+// Readers load g_tf_info that way only when g_tf_generation shows a new snapshot
+// and otherwise reuse their thread's copy. The copy is a weak_ptr so no thread keeps
+// a snapshot, and the metadb handle in it, alive after it is replaced or cleared.
+static std::atomic<uint64_t> g_tf_generation(0);
+
+struct tf_info_reader_cache {
+    uint64_t generation = 0;
+    std::weak_ptr<const tf_artwork_info> info;
+};
+static thread_local tf_info_reader_cache t_tf_reader_cache;
+
+// Writers only, under g_tf_write_mutex
+static std::shared_ptr<const tf_artwork_info> load_published_tf_info() {
+    return std::atomic_load(&g_tf_info);
+}
+
+static void publish_tf_info(std::shared_ptr<const tf_artwork_info> info) {
+    std::atomic_store(&g_tf_info, std::move(info));
+    g_tf_generation.fetch_add(1, std::memory_order_release);
+}
+
+static std::shared_ptr<const tf_artwork_info> load_tf_info() {
+    tf_info_reader_cache& cache = t_tf_reader_cache;
+    uint64_t generation = g_tf_generation.load(std::memory_order_acquire);
+    if (generation != cache.generation) {
+        // The snapshot loaded here is at least as new as generation; if it is newer, the
+        // next call reloads once more
+        cache.info = std::atomic_load(&g_tf_info);
+        cache.generation = generation;
+    }
+    return cache.info.lock();
+}
+
+// Artwork recorded per track, so playlist rows other than the now-playing one can show
+// it. Entries hold their metadb handle, which keeps the raw pointer key valid;
+// g_recorded_order lists the keys oldest first for eviction.
+static const size_t MAX_RECORDED_TRACKS = 4096;
+
+// A recorded cover file can be pruned from the disk cache or replaced later. Entries are
+// checked again after this long: process_field's own cache checks (hits and misses) are
+// dropped so the row checks the disk cache again, pipeline entries are kept only while
+// their cover file exists.
+static const std::chrono::seconds RECORDED_TRACK_TTL(60);
+
+struct recorded_track_entry {
+    std::shared_ptr<const tf_artwork_info> info;
+    std::list<const metadb_handle*>::iterator order;
+};
+
+static std::shared_mutex g_recorded_mutex;
+static std::unordered_map<const metadb_handle*, recorded_track_entry> g_recorded_tracks;
+static std::list<const metadb_handle*> g_recorded_order;
+
+// Handles whose fields changed since the last flush; one main-thread flush
+// refreshes them with a single dispatch_refresh call
+static std::mutex g_refresh_mutex;
+static metadb_handle_list g_pending_refresh;
+static bool g_refresh_scheduled = false;
+
+static std::shared_ptr<tf_artwork_info> make_tf_info(metadb_handle_ptr track, const char* artist, const char* title, const char* cover_path, const char* source) {
+    auto info = std::make_shared<tf_artwork_info>();
+    info->track = track;
+    info->track_path = track.is_valid() ? track->get_path() : "";
+    info->artist = artist ? artist : "";
+    info->title = title ? title : "";
+    info->cover = cover_path ? cover_path : "";
+    info->source = source ? source : "";
+    info->checked_at = std::chrono::steady_clock::now();
+    return info;
+}
+
+// If this is the same track/metadata and we already have a resolved non-Cache provider,
+// do not let a subsequent "Cache" source downgrade it.
+static void keep_resolved_source(const tf_artwork_info& current, tf_artwork_info& next) {
+    if (current.track_path == next.track_path && current.artist == next.artist && current.title == next.title &&
+        !current.source.is_empty() && current.source != "Cache" && next.source == "Cache") {
+        next.source = current.source;
+    }
+}
+
+static bool same_tf_info(const tf_artwork_info& a, const tf_artwork_info& b) {
+    return a.track_path == b.track_path && a.artist == b.artist && a.title == b.title &&
+           a.cover == b.cover && a.source == b.source && a.from_cache_check == b.from_cache_check;
+}
+
+// Returns true if the recorded info for the track changed
+static bool store_recorded_track(const std::shared_ptr<tf_artwork_info>& info) {
+    const metadb_handle* key = info->track.get_ptr();
+    if (!key) return false;
+
+    std::unique_lock<std::shared_mutex> lock(g_recorded_mutex);
+    auto it = g_recorded_tracks.find(key);
+    if (it != g_recorded_tracks.end()) {
+        keep_resolved_source(*it->second.info, *info);
+        if (same_tf_info(*it->second.info, *info)) return false;
+        it->second.info = info;
+        g_recorded_order.splice(g_recorded_order.end(), g_recorded_order, it->second.order);
+        return true;
+    }
+
+    g_recorded_order.push_back(key);
+    recorded_track_entry entry;
+    entry.info = info;
+    entry.order = std::prev(g_recorded_order.end());
+    g_recorded_tracks.emplace(key, std::move(entry));
+
+    while (g_recorded_tracks.size() > MAX_RECORDED_TRACKS) {
+        g_recorded_tracks.erase(g_recorded_order.front());
+        g_recorded_order.pop_front();
+    }
+    return true;
+}
+
+static std::shared_ptr<const tf_artwork_info> find_recorded_track(const metadb_handle* handle) {
+    std::shared_lock<std::shared_mutex> lock(g_recorded_mutex);
+    auto it = g_recorded_tracks.find(handle);
+    if (it == g_recorded_tracks.end()) return nullptr;
+    return it->second.info;
+}
+
+// Drops the handle's entry unless it was replaced since info was read
+static void forget_recorded_entry(const metadb_handle* handle, const std::shared_ptr<const tf_artwork_info>& info) {
+    std::unique_lock<std::shared_mutex> lock(g_recorded_mutex);
+    auto it = g_recorded_tracks.find(handle);
+    if (it == g_recorded_tracks.end() || it->second.info != info) return;
+    g_recorded_order.erase(it->second.order);
+    g_recorded_tracks.erase(it);
+}
+
+// Checks an entry older than RECORDED_TRACK_TTL; returns it renewed, or nullptr once dropped
+static std::shared_ptr<const tf_artwork_info> recheck_recorded_entry(const metadb_handle* handle, const std::shared_ptr<const tf_artwork_info>& info) {
+    if (info->from_cache_check || (!info->cover.is_empty() && !PathFileExistsA(info->cover.c_str()))) {
+        forget_recorded_entry(handle, info);
+        return nullptr;
+    }
+
+    auto renewed = std::make_shared<tf_artwork_info>(*info);
+    renewed->checked_at = std::chrono::steady_clock::now();
+    std::unique_lock<std::shared_mutex> lock(g_recorded_mutex);
+    auto it = g_recorded_tracks.find(handle);
+    if (it == g_recorded_tracks.end()) return nullptr;
+    if (it->second.info == info) it->second.info = renewed;
+    return it->second.info;
+}
+
+// In single-file mode every track shares the "current" cache file, so a recorded
+// cover path would show whatever played last
+static bool can_record_tracks() {
+    return !cfg_single_file_cache;
+}
+
+static void queue_refresh(const metadb_handle_ptr& track) {
+    if (!track.is_valid() || core_api::is_shutting_down()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(g_refresh_mutex);
+        g_pending_refresh.add_item(track);
+        if (g_refresh_scheduled) return;
+        g_refresh_scheduled = true;
+    }
+
+    async_io_manager::instance().post_to_main_thread([]() {
+        metadb_handle_list handles;
+        {
+            std::lock_guard<std::mutex> lock(g_refresh_mutex);
+            handles = g_pending_refresh;
+            g_pending_refresh.remove_all();
+            g_refresh_scheduled = false;
+        }
+
+        metadb_handle_list_helper::sort_by_pointer_remove_duplicates(handles);
+        if (handles.get_count() == 0 || core_api::is_shutting_down()) return;
+        try {
+            metadb_io::get()->dispatch_refresh(handles);
+        } catch (...) {}
+    });
+}
 
 void titleformat_provider::set_track_artwork_info(metadb_handle_ptr track, const char* artist, const char* title, const char* cover_path, const char* source) {
     if (core_api::is_shutting_down()) return;
 
     bool changed = false;
     {
-        std::lock_guard<std::mutex> lock(g_tf_mutex);
-        pfc::string8 new_path = track.is_valid() ? track->get_path() : "";
-        pfc::string8 new_artist = artist ? artist : "";
-        pfc::string8 new_title = title ? title : "";
-        pfc::string8 new_cover = cover_path ? cover_path : "";
-        pfc::string8 new_source = source ? source : "";
-
-        // If this is the same track/metadata and we already have a resolved non-Cache provider,
-        // do not let a subsequent "Cache" source downgrade it.
-        if (g_tf_track_path == new_path && g_tf_artist == new_artist && g_tf_title == new_title &&
-            !g_tf_source.is_empty() && g_tf_source != "Cache" && new_source == "Cache") {
-            new_source = g_tf_source;
+        std::lock_guard<std::mutex> lock(g_tf_write_mutex);
+        std::shared_ptr<const tf_artwork_info> current = load_published_tf_info();
+        std::shared_ptr<tf_artwork_info> next = make_tf_info(track, artist, title, cover_path, source);
+
+        if (current) keep_resolved_source(*current, *next);
+
+        // Found artwork stays visible on the track's row after playback moves on. Recording
+        // comes first because it may still adjust next, which is immutable once published.
+        bool recorded_changed = false;
+        if (track.is_valid() && (!next->cover.is_empty() || !next->source.is_empty()) && can_record_tracks()) {
+            recorded_changed = store_recorded_track(next);
         }
 
-        if (g_tf_track_path != new_path || g_tf_artist != new_artist || g_tf_title != new_title ||
-            g_tf_cover != new_cover || g_tf_source != new_source) {
-            changed = true;
-            g_tf_track_path = new_path;
-            g_tf_artist = new_artist;
-            g_tf_title = new_title;
-            g_tf_cover = new_cover;
-            g_tf_source = new_source;
+        if (current) {
+            changed = !same_tf_info(*current, *next);
+        } else {
+            changed = !next->track_path.is_empty() || !next->artist.is_empty() || !next->title.is_empty() ||
+                      !next->cover.is_empty() || !next->source.is_empty();
         }
+
+        if (changed) {
+            publish_tf_info(next);
+        }
+        changed = changed || recorded_changed;
     }
 
-    if (changed && track.is_valid() && core_api::is_main_thread() && !core_api::is_shutting_down()) {
-        try {
-            metadb_io::get()->dispatch_refresh(track);
-        } catch (...) {}
+    if (changed) queue_refresh(track);
+}
+
+void titleformat_provider::forget_recorded_artwork(bool refresh_rows) {
+    std::vector<metadb_handle_ptr> forgotten;
+    {
+        std::unique_lock<std::shared_mutex> lock(g_recorded_mutex);
+        forgotten.reserve(g_recorded_tracks.size());
+        for (const auto& entry : g_recorded_tracks) {
+            forgotten.push_back(entry.second.info->track);
+        }
+        g_recorded_tracks.clear();
+        g_recorded_order.clear();
+    }
+
+    if (!refresh_rows) {
+        // Quitting: the queued flush will not run, and no handle may outlive the core
+        std::lock_guard<std::mutex> lock(g_refresh_mutex);
+        g_pending_refresh.remove_all();
+        return;
+    }
+
+    // Rows that showed recorded artwork go back to checking the disk cache
+    for (const auto& track : forgotten) {
+        queue_refresh(track);
     }
 }
 
-void titleformat_provider::clear_track_artwork_info() {
+void titleformat_provider::forget_track_artwork(metadb_handle_ptr track) {
+    if (!track.is_valid()) return;
+    bool forgotten = false;
     {
-        std::lock_guard<std::mutex> lock(g_tf_mutex);
-        g_tf_track_path.reset();
-        g_tf_artist.reset();
-        g_tf_title.reset();
-        g_tf_cover.reset();
-        g_tf_source.reset();
+        std::unique_lock<std::shared_mutex> lock(g_recorded_mutex);
+        auto it = g_recorded_tracks.find(track.get_ptr());
+        if (it != g_recorded_tracks.end()) {
+            g_recorded_order.erase(it->second.order);
+            g_recorded_tracks.erase(it);
+            forgotten = true;
+        }
     }
+    if (forgotten) queue_refresh(track);
+}
+
+void titleformat_provider::forget_cover_files(const std::vector<pfc::string8>& cover_paths) {
+    auto is_forgotten = [&cover_paths](const pfc::string8& cover) {
+        if (cover.is_empty()) return false;
+        for (const auto& path : cover_paths) {
+            if (_stricmp(path.c_str(), cover.c_str()) == 0) return true;
+        }
+        return false;
+    };
+
+    std::vector<metadb_handle_ptr> forgotten;
+    {
+        std::unique_lock<std::shared_mutex> lock(g_recorded_mutex);
+        for (auto it = g_recorded_tracks.begin(); it != g_recorded_tracks.end();) {
+            if (is_forgotten(it->second.info->cover)) {
+                forgotten.push_back(it->second.info->track);
+                g_recorded_order.erase(it->second.order);
+                it = g_recorded_tracks.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // The now-playing track keeps its artist and title until the pipeline publishes new artwork
+    {
+        std::lock_guard<std::mutex> lock(g_tf_write_mutex);
+        std::shared_ptr<const tf_artwork_info> current = load_published_tf_info();
+        if (current && is_forgotten(current->cover)) {
+            auto next = std::make_shared<tf_artwork_info>(*current);
+            next->cover.reset();
+            next->source.reset();
+            publish_tf_info(next);
+            forgotten.push_back(current->track);
+        }
+    }
+
+    for (const auto& track : forgotten) {
+        queue_refresh(track);
+    }
+}
+
+void titleformat_provider::clear_track_artwork_info() {
+    std::lock_guard<std::mutex> lock(g_tf_write_mutex);
+    publish_tf_info(nullptr);
 }
 
 void titleformat_provider::get_track_artwork_info(pfc::string8& out_artist, pfc::string8& out_title, pfc::string8& out_cover, pfc::string8& out_source) {
-    std::lock_guard<std::mutex> lock(g_tf_mutex);
-    out_artist = g_tf_artist;
-    out_title = g_tf_title;
-    out_cover = g_tf_cover;
-    out_source = g_tf_source;
+    std::shared_ptr<const tf_artwork_info> info = load_tf_info();
+    if (!info) {
+        out_artist.reset();
+        out_title.reset();
+        out_cover.reset();
+        out_source.reset();
+        return;
+    }
+    out_artist = info->artist;
+    out_title = info->title;
+    out_cover = info->cover;
+    out_source = info->source;
 }
 
 class foo_artwork_display_field_provider : public metadb_display_field_provider {
@@ -100,41 +377,63 @@ public:
         if (!out || core_api::is_shutting_down()) return false;
 
         try {
-            pfc::string8 current_artist, current_title, current_cover, current_source, current_path;
-            {
-                std::lock_guard<std::mutex> lock(g_tf_mutex);
-                current_artist = g_tf_artist;
-                current_title = g_tf_title;
-                current_cover = g_tf_cover;
-                current_source = g_tf_source;
-                current_path = g_tf_track_path;
-            }
+            std::shared_ptr<const tf_artwork_info> current = load_tf_info();
 
-            pfc::string8 field_val;
             bool is_current_track = false;
-
-            if (handle != nullptr && !current_path.is_empty()) {
-                const char* h_path = handle->get_path();
-                if (h_path && strcmp(h_path, current_path.c_str()) == 0) {
+            if (handle == nullptr) {
+                is_current_track = true;
+            } else if (current && !current->track_path.is_empty()) {
+                // Same handle is the common case; other handles of the same path (e.g. cue subsongs) still match
+                if (current->track.get_ptr() == handle) {
                     is_current_track = true;
+                } else {
+                    const char* h_path = handle->get_path();
+                    if (h_path && strcmp(h_path, current->track_path.c_str()) == 0) {
+                        is_current_track = true;
+                    }
                 }
-            } else if (handle == nullptr) {
-                is_current_track = true;
             }
 
-            // 1. If matching active playing track and dynamic/resolved values are present, use them
-            if (is_current_track) {
+            // 1. If matching active playing track and dynamic/resolved values are present, write them straight from the snapshot
+            if (is_current_track && current) {
+                const pfc::string8* current_val = nullptr;
                 switch (index) {
-                    case field_artist: if (!current_artist.is_empty()) field_val = current_artist; break;
-                    case field_title: if (!current_title.is_empty()) field_val = current_title; break;
+                    case field_artist: current_val = &current->artist; break;
+                    case field_title: current_val = &current->title; break;
                     case field_cover:
-                    case field_path: if (!current_cover.is_empty()) field_val = current_cover; break;
-                    case field_source: if (!current_source.is_empty()) field_val = current_source; break;
+                    case field_path: current_val = &current->cover; break;
+                    case field_source: current_val = &current->source; break;
+                }
+                if (current_val && !current_val->is_empty()) {
+                    out->write(titleformat_inputtypes::meta, current_val->c_str());
+                    return true;
                 }
             }
 
-            // 2. If field_val is empty and handle is provided, extract directly from handle's metadata / disk cache
-            if (field_val.is_empty() && handle != nullptr && !core_api::is_shutting_down()) {
+            // 2. Artwork recorded earlier for this track
+            std::shared_ptr<const tf_artwork_info> recorded = handle != nullptr ? find_recorded_track(handle) : nullptr;
+            if (recorded && std::chrono::steady_clock::now() - recorded->checked_at >= RECORDED_TRACK_TTL) {
+                recorded = recheck_recorded_entry(handle, recorded);
+            }
+            if (recorded) {
+                const pfc::string8* recorded_val = nullptr;
+                switch (index) {
+                    case field_artist: recorded_val = &recorded->artist; break;
+                    case field_title: recorded_val = &recorded->title; break;
+                    case field_cover:
+                    case field_path: recorded_val = &recorded->cover; break;
+                    case field_source: recorded_val = &recorded->source; break;
+                }
+                if (recorded_val && !recorded_val->is_empty()) {
+                    out->write(titleformat_inputtypes::meta, recorded_val->c_str());
+                    return true;
+                }
+            }
+
+            pfc::string8 field_val;
+
+            // 3. Otherwise, if handle is provided, extract directly from handle's metadata / disk cache
+            if (handle != nullptr && !core_api::is_shutting_down()) {
                 try {
                     metadb_info_container::ptr info_container = handle->get_info_ref();
                     if (info_container.is_valid()) {
@@ -153,17 +452,22 @@ public:
                     }
                 } catch (...) {}
 
-                if (index == field_cover || index == field_path) {
+                // A recorded cache check without a cover is a miss that is still fresh
+                bool known_miss = recorded && recorded->from_cache_check;
+                if ((index == field_cover || index == field_path || index == field_source) && !known_miss) {
                     pfc::string8 key = artwork_manager::generate_cache_key_for_track(handle);
                     pfc::string8 cache_file = async_io_manager::instance().get_cache_file_path(key);
-                    if (PathFileExistsA(cache_file.c_str())) {
-                        field_val = cache_file;
+                    bool found = PathFileExistsA(cache_file.c_str()) != FALSE;
+                    if (found) {
+                        field_val = index == field_source ? pfc::string8("Cache") : cache_file;
                     }
-                } else if (index == field_source) {
-                    pfc::string8 key = artwork_manager::generate_cache_key_for_track(handle);
-                    pfc::string8 cache_file = async_io_manager::instance().get_cache_file_path(key);
-                    if (PathFileExistsA(cache_file.c_str())) {
-                        field_val = "Cache";
+
+                    // Remember the outcome, hit or miss, so the next redraws of this row skip the key and file check
+                    if (!recorded && can_record_tracks()) {
+                        std::shared_ptr<tf_artwork_info> check = found ? make_tf_info(handle, "", "", cache_file.c_str(), "Cache")
+                                                                       : make_tf_info(handle, "", "", "", "");
+                        check->from_cache_check = true;
+                        store_recorded_track(check);
                     }
                 }
             }
@@ -1,9 +1,20 @@
 #pragma once
 #include "stdafx.h"
+#include <vector>
 
 class titleformat_provider {
 public:
     static void set_track_artwork_info(metadb_handle_ptr track, const char* artist, const char* title, const char* cover_path, const char* source);
     static void clear_track_artwork_info();
     static void get_track_artwork_info(pfc::string8& out_artist, pfc::string8& out_title, pfc::string8& out_cover, pfc::string8& out_source);
+
+    // Drop the artwork recorded per track (set_track_artwork_info keeps it so %foo_artwork_*%
+    // fields work on every playlist row), e.g. after the disk cache was cleared. Without
+    // refresh_rows, as on quit, the rows are not redrawn and queued refreshes are dropped.
+    static void forget_recorded_artwork(bool refresh_rows = true);
+    // Drop the artwork recorded for one track, e.g. after its artwork was rejected
+    static void forget_track_artwork(metadb_handle_ptr track);
+    // Drop every recorded artwork whose cover is one of these files, e.g. after they were
+    // removed from the disk cache; the now-playing track loses its cover and source
+    static void forget_cover_files(const std::vector<pfc::string8>& cover_paths);
 };
@@ -0,0 +1,26 @@
+#include "stdafx.h"
+#include "titleformat_script_cache.h"
+#include <map>
+#include <mutex>
+#include <string>
+
+static std::mutex g_script_mutex;
+static std::map<std::string, service_ptr_t<titleformat_object>> g_scripts;
+
+service_ptr_t<titleformat_object> titleformat_script_cache::get(const char* pattern) {
+    std::string key(pattern ? pattern : "");
+
+    std::lock_guard<std::mutex> lock(g_script_mutex);
+    auto it = g_scripts.find(key);
+    if (it != g_scripts.end()) return it->second;
+
+    service_ptr_t<titleformat_object> script;
+    static_api_ptr_t<titleformat_compiler>()->compile_safe(script, key.c_str());
+    g_scripts[key] = script;
+    return script;
+}
+
+void titleformat_script_cache::clear() {
+    std::lock_guard<std::mutex> lock(g_script_mutex);
+    g_scripts.clear();
+}
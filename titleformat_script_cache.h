@@ -0,0 +1,15 @@
+#pragma once
+#include "stdafx.h"
+
+// Process-wide cache of compiled titleformat scripts, keyed by pattern text.
+// Compiled scripts are immutable, so one instance can be evaluated from any
+// thread; lookups that run on every poll or pipeline run reuse it instead of
+// recompiling the pattern each time.
+class titleformat_script_cache {
+public:
+    // Compiled script for pattern; invalid patterns compile the way compile_safe does
+    static service_ptr_t<titleformat_object> get(const char* pattern);
+
+    // Release all scripts; called on shutdown, before the core services go away
+    static void clear();
+};
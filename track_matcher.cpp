@@ -0,0 +1,199 @@
+#include "stdafx.h"
+#include "track_matcher.h"
+#include "metadata_cleaner.h"
+#include "unicode_fold.h"
+#include "candidate_ranker.h"
+#include <algorithm>
+
+std::string normalize_for_matching(const std::string& s) {
+    // First fold accents and case (ö→o, Ł→l, Ά→α, Ё→е, etc.)
+    std::string folded = unicode_fold(s);
+
+    std::string result;
+    result.reserve(folded.size());
+
+    for (size_t i = 0; i < folded.size(); ++i) {
+        char c = folded[i];
+
+        // Skip punctuation (periods, commas, apostrophes, etc.)
+        if (c == '.' || c == ',' || c == '\'' || c == '!' || c == '?' || c == '-') {
+            continue;
+        }
+
+        // Treat underscores as spaces (common in stream metadata)
+        if (c == '_') {
+            result += ' ';
+            continue;
+        }
+
+        result += c;
+    }
+
+    // Normalize " and " to " & " for consistent comparison
+    // Process the result to handle "and" vs "&"
+    std::string normalized;
+    normalized.reserve(result.size());
+
+    for (size_t i = 0; i < result.size(); ++i) {
+        // Check for " and " pattern (with spaces)
+        if (i + 4 < result.size() &&
+            result[i] == ' ' &&
+            result[i+1] == 'a' &&
+            result[i+2] == 'n' &&
+            result[i+3] == 'd' &&
+            result[i+4] == ' ') {
+            normalized += ' ';  // Replace " and " with single space (remove the word entirely)
+            i += 4;  // Skip past " and " (loop will add 1 more)
+            continue;
+        }
+
+        // Check for " & " pattern
+        if (i + 2 < result.size() &&
+            result[i] == ' ' &&
+            result[i+1] == '&' &&
+            result[i+2] == ' ') {
+            normalized += ' ';  // Replace " & " with single space
+            i += 2;  // Skip past " & "
+            continue;
+        }
+
+        normalized += result[i];
+    }
+
+    // Collapse multiple spaces into one
+    result.clear();
+    bool last_was_space = false;
+    for (char c : normalized) {
+        if (c == ' ') {
+            if (!last_was_space) {
+                result += c;
+                last_was_space = true;
+            }
+        } else {
+            result += c;
+            last_was_space = false;
+        }
+    }
+
+    // Trim leading/trailing spaces
+    size_t start = result.find_first_not_of(' ');
+    if (start == std::string::npos) return "";
+    size_t end = result.find_last_not_of(' ');
+
+    return result.substr(start, end - start + 1);
+}
+
+// Helper to strip "The " prefix from artist names for fuzzy matching
+static std::string strip_the_prefix(const std::string& s) {
+    if (s.size() > 4) {
+        // Check for "The " prefix (case-insensitive)
+        if ((s[0] == 'T' || s[0] == 't') &&
+            (s[1] == 'H' || s[1] == 'h') &&
+            (s[2] == 'E' || s[2] == 'e') &&
+            s[3] == ' ') {
+            return s.substr(4);
+        }
+    }
+    return s;
+}
+
+artist_match_key::artist_match_key(const std::string& name) {
+    full = normalize_for_matching(name);
+    std::string name_stripped = strip_the_prefix(name);
+    stripped = name_stripped.size() == name.size() ? full : normalize_for_matching(name_stripped);
+
+    std::string first_raw = MetadataCleaner::extract_first_artist(name.c_str());
+    has_first = !first_raw.empty();
+    if (has_first) {
+        first_differs = first_raw != name;
+        if (!first_differs) {
+            first = full;
+            first_stripped = stripped;
+        } else {
+            first = normalize_for_matching(first_raw);
+            std::string first_raw_stripped = strip_the_prefix(first_raw);
+            first_stripped = first_raw_stripped.size() == first_raw.size() ? first : normalize_for_matching(first_raw_stripped);
+        }
+    }
+
+    std::string second_raw = MetadataCleaner::extract_second_artist(name.c_str());
+    has_second = !second_raw.empty();
+    if (has_second) second = normalize_for_matching(second_raw);
+}
+
+bool artists_match(const artist_match_key& a, const artist_match_key& b) {
+    // Whole names, then with "The " stripped from both
+    if (a.full == b.full) return true;
+    if (a.stripped == b.stripped) return true;
+
+    // Extracted first artists for multi-artist collaborations
+    if (a.has_first && b.has_first && (a.first_differs || b.first_differs)) {
+        if (a.first == b.first) return true;
+        if (a.first_stripped == b.first_stripped) return true;
+    }
+
+    if (a.has_first && a.first_differs) {
+        if (a.first == b.full) return true;
+        if (a.first_stripped == b.stripped) return true;
+    }
+
+    if (b.has_first && b.first_differs) {
+        if (a.full == b.first) return true;
+        if (a.stripped == b.first_stripped) return true;
+    }
+
+    // Extracted second artists (e.g. Gouryella from Ferry Corsten pres. Gouryella)
+    if (a.has_second) {
+        if (a.second == b.full) return true;
+        if (b.has_first && a.second == b.first) return true;
+    }
+
+    if (b.has_second) {
+        if (a.full == b.second) return true;
+        if (a.has_first && a.first == b.second) return true;
+    }
+
+    return false;
+}
+
+double artist_similarity(const artist_match_key& candidate, const artist_match_key& query) {
+    if (artists_match(candidate, query)) return 1.0;
+
+    double best = candidate_ranker::similarity(candidate.full, query.full);
+    best = (std::max)(best, candidate_ranker::similarity(candidate.stripped, query.stripped));
+    if (candidate.has_first && query.has_first) {
+        best = (std::max)(best, candidate_ranker::similarity(candidate.first_stripped, query.first_stripped));
+    }
+    return best;
+}
+
+double title_similarity(const std::string& candidate_title, const std::string& query_title_key) {
+    std::string key = normalize_for_matching(candidate_title);
+    if (key == query_title_key) return 1.0;
+
+    double best = candidate_ranker::similarity(key, query_title_key);
+
+    // "Title (Remastered 2011)" or "Title - Radio Edit" is still the same song, just not quite an exact hit
+    std::string cleaned = MetadataCleaner::extract_primary_title(MetadataCleaner::clean_for_search(candidate_title.c_str()).c_str());
+    std::string cleaned_key = normalize_for_matching(cleaned);
+    if (!cleaned_key.empty() && cleaned_key != key) {
+        best = (std::max)(best, 0.95 * candidate_ranker::similarity(cleaned_key, query_title_key));
+    }
+    return best;
+}
+
+double score_candidate(const artist_match_key& query_artist, const std::string& query_title_key, unsigned expected_seconds,
+                       const std::string& artist, const std::string& title, const std::string& release, unsigned seconds) {
+    double artist_sim = artist_similarity(artist_match_key(artist), query_artist);
+    if (artist_sim < candidate_ranker::MIN_ARTIST_SIMILARITY) return 0.0;
+
+    double title_sim = title.empty() ? 0.0 : title_similarity(title, query_title_key);
+
+    // Cover acts carry the markers in their name as often as in the album ("... Tribute Band")
+    double release_factor = candidate_ranker::release_factor(normalize_for_matching(artist), query_artist.full);
+    if (!release.empty()) {
+        release_factor = (std::min)(release_factor, candidate_ranker::release_factor(normalize_for_matching(release), query_title_key));
+    }
+    return candidate_ranker::score(artist_sim, title_sim, release_factor,
+                                  candidate_ranker::duration_factor(expected_seconds, seconds));
+}
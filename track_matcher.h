@@ -0,0 +1,41 @@
+#pragma once
+#include "stdafx.h"
+#include <string>
+
+// Matching of provider search results against the track being looked up. Only
+// depends on MetadataCleaner, unicode_fold and candidate_ranker, not on the
+// foobar2000 SDK or the network code, so it can be exercised on its own.
+
+// Normalize string for fuzzy matching: removes diacritics, punctuation, normalizes "AND"/"&", lowercases
+std::string normalize_for_matching(const std::string& s);
+
+// Fuzzy artist comparison: handles case, punctuation, "The " prefix, and "AND"/"&" differences.
+// A case-insensitive match always normalizes to equal keys, so every variant of a name is
+// reduced to one normalized key up front and comparisons are plain string compares.
+struct artist_match_key {
+    std::string full;               // normalize_for_matching(name)
+    std::string stripped;           // ... without a leading "The "
+    bool has_first = false;         // extract_first_artist gave a non-empty result
+    bool first_differs = false;     // ... that is not the whole name
+    std::string first;
+    std::string first_stripped;
+    bool has_second = false;
+    std::string second;
+
+    explicit artist_match_key(const std::string& name);
+};
+
+bool artists_match(const artist_match_key& a, const artist_match_key& b);
+
+// Graded version of artists_match for ranking: 1.0 for anything artists_match accepts,
+// otherwise the closest trigram similarity between the normalized name variants
+double artist_similarity(const artist_match_key& candidate, const artist_match_key& query);
+
+// Similarity of a provider's title to the normalized query title
+double title_similarity(const std::string& candidate_title, const std::string& query_title_key);
+
+// Score of one provider result for the track being searched. release is the album the
+// result comes from and seconds its length; either may be empty/0 when the provider
+// does not report it.
+double score_candidate(const artist_match_key& query_artist, const std::string& query_title_key, unsigned expected_seconds,
+                       const std::string& artist, const std::string& title, const std::string& release, unsigned seconds);
@@ -1,8 +1,10 @@
 #include "stdafx.h"
 #include <windowsx.h>
 #include "artwork_manager.h"
+#include "artwork_events.h"
 #include "artwork_viewer_popup.h"
 #include "metadata_cleaner.h"
+#include "titleformat_script_cache.h"
 #include "webp_decoder.h"
 #include <gdiplus.h>
 #include <atlbase.h>
@@ -39,67 +41,15 @@ extern void trigger_main_component_search(metadb_handle_ptr track);
 extern void trigger_main_component_search_with_metadata(const std::string& artist, const std::string& title);
 extern void trigger_main_component_local_search(metadb_handle_ptr track);
 
-// External function to get main component artwork bitmap (for priority checking)
-extern HBITMAP get_main_component_artwork_bitmap();
-
 // Global list to track DUI artwork element instances for external refresh
 static pfc::list_t<class artwork_ui_element*> g_dui_artwork_panels;
 
-// Forward declarations for the event system (matching sdk_main.cpp)
-enum class ArtworkEventType {
-    ARTWORK_LOADED,     // New artwork loaded successfully
-    ARTWORK_LOADING,    // Search started
-    ARTWORK_FAILED,     // Search failed
-    ARTWORK_CLEARED     // Artwork cleared
-};
-
-struct ArtworkEvent {
-    ArtworkEventType type;
-    HBITMAP bitmap;
-    std::string source;
-    std::string artist;
-    std::string title;
-    
-    ArtworkEvent(ArtworkEventType t, HBITMAP bmp = nullptr, const std::string& src = "", 
-                 const std::string& art = "", const std::string& ttl = "")
-        : type(t), bitmap(bmp), source(src), artist(art), title(ttl) {}
-};
-
-// Artwork event listener interface
-class IArtworkEventListener {
-public:
-    virtual ~IArtworkEventListener() = default;
-    virtual void on_artwork_event(const ArtworkEvent& event) = 0;
-};
-
-// Forward declare the event manager class
-class ArtworkEventManager {
-public:
-    static ArtworkEventManager& get();
-    void subscribe(IArtworkEventListener* listener);
-    void unsubscribe(IArtworkEventListener* listener);
-    void notify(const ArtworkEvent& event);
-};
-
-// External references to event manager methods
-extern void subscribe_to_artwork_events(IArtworkEventListener* listener);
-extern void unsubscribe_from_artwork_events(IArtworkEventListener* listener);
-
 // Custom message for artwork loading completion
 #define WM_USER_ARTWORK_LOADED (WM_USER + 100)
 
-// Custom message for thread-safe artwork event dispatching
+// Artwork event handed to the window by on_artwork_event (lParam = const ArtworkEvent*)
 #define WM_USER_ARTWORK_EVENT (WM_USER + 101)
 
-// Heap-allocated struct for passing artwork event data via PostMessage
-struct ArtworkEventData {
-    ArtworkEventType type;
-    HBITMAP bitmap;
-    std::string source;
-    std::string artist;
-    std::string title;
-};
-
 // For now, we'll create a simplified version without ATL dependencies
 // This creates a basic component that can be extended later
 class artwork_ui_element : public ui_element_instance, public CWindowImpl<artwork_ui_element>, public IArtworkEventListener {
@@ -187,7 +137,7 @@ private:
     void draw_placeholder(HDC hdc, const RECT& rect);
     
     // GDI+ helpers
-    bool load_image_from_memory(const t_uint8* data, size_t size);
+    bool load_image_from_memory(const image_buffer& data);
     void cleanup_gdiplus_image();
     
     
@@ -527,6 +477,7 @@ void artwork_ui_element::notify(const GUID& p_what, t_size p_param1, const void*
 
 
 LRESULT artwork_ui_element::OnDestroy(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled) {
+    artwork_manager::set_panel_artwork_size(this, 0);
     if (m_download_fade_timer_id) {
         KillTimer(1002);
         m_download_fade_timer_id = 0;
@@ -604,6 +555,9 @@ LRESULT artwork_ui_element::OnPaint(UINT uMsg, WPARAM wParam, LPARAM lParam, BOO
 
 LRESULT artwork_ui_element::OnSize(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled) {
     GetClientRect(&m_client_rect);
+
+    // Client size is in device pixels (DPI aware host), so this already includes the DPI scale
+    artwork_manager::set_panel_artwork_size(this, (unsigned)(std::max)(m_client_rect.right - m_client_rect.left, m_client_rect.bottom - m_client_rect.top));
     
     // Use RedrawWindow for flicker-free resizing instead of Invalidate()
     RedrawWindow(NULL, NULL, RDW_INVALIDATE | RDW_UPDATENOW | RDW_NOCHILDREN);
@@ -843,18 +797,11 @@ void artwork_ui_element::on_playback_new_track(metadb_handle_ptr track) {
         static_api_ptr_t<playback_control> pc;
         metadb_handle_ptr now_playing;
         if (pc->get_now_playing(now_playing) && now_playing == track) {
-            static_api_ptr_t<titleformat_compiler> compiler;
-            service_ptr_t<titleformat_object> script_artist, script_title, script_album, script_station;
-            compiler->compile_force(script_artist, "%artist%");
-            compiler->compile_force(script_title, "%title%");
-            compiler->compile_force(script_album, "%album%");
-            compiler->compile_force(script_station, "%stream_name%");
-
             pfc::string8 s;
-            if (pc->playback_format_title(nullptr, s, script_artist, nullptr, playback_control::display_level_titles) && !s.is_empty() && s != "?") artist = s;
-            if (pc->playback_format_title(nullptr, s, script_title, nullptr, playback_control::display_level_titles) && !s.is_empty() && s != "?") title = s;
-            if (pc->playback_format_title(nullptr, s, script_album, nullptr, playback_control::display_level_titles) && !s.is_empty() && s != "?") album = s;
-            if (pc->playback_format_title(nullptr, s, script_station, nullptr, playback_control::display_level_titles) && !s.is_empty() && s != "?") station = s;
+            if (pc->playback_format_title(nullptr, s, titleformat_script_cache::get("%artist%"), nullptr, playback_control::display_level_titles) && !s.is_empty() && s != "?") artist = s;
+            if (pc->playback_format_title(nullptr, s, titleformat_script_cache::get("%title%"), nullptr, playback_control::display_level_titles) && !s.is_empty() && s != "?") title = s;
+            if (pc->playback_format_title(nullptr, s, titleformat_script_cache::get("%album%"), nullptr, playback_control::display_level_titles) && !s.is_empty() && s != "?") album = s;
+            if (pc->playback_format_title(nullptr, s, titleformat_script_cache::get("%stream_name%"), nullptr, playback_control::display_level_titles) && !s.is_empty() && s != "?") station = s;
         }
 
         if (artist.is_empty() && title.is_empty()) {
@@ -1147,7 +1094,7 @@ void artwork_ui_element::on_artwork_loaded(const artwork_manager::artwork_result
     m_artwork_loading = false;
     
     if (result.success && result.data.get_size() > 0) {
-        if (load_image_from_memory(result.data.get_ptr(), result.data.get_size())) {
+        if (load_image_from_memory(result.data)) {
             // Store artwork source and show OSD for Default UI
             std::string source = result.source.is_empty() ? "Unknown" : result.source.c_str();
             m_artwork_source = source;
@@ -1588,14 +1535,16 @@ void artwork_ui_element::draw_placeholder(HDC hdc, const RECT& rect) {
     // No placeholder rectangle or icon needed
 }
 
-bool artwork_ui_element::load_image_from_memory(const t_uint8* data, size_t size) {
-    
+bool artwork_ui_element::load_image_from_memory(const image_buffer& data) {
+    const t_uint8* bytes = data.get_ptr();
+    size_t size = data.get_size();
+
     cleanup_gdiplus_image();
     cleanup_gdiplus_infobar_image();
 
     // Try WIC-based WebP decoding first
-    if (is_webp_signature(data, size)) {
-        Gdiplus::Bitmap* webp_bitmap = decode_webp_via_wic(data, size);
+    if (is_webp_signature(bytes, size)) {
+        Gdiplus::Bitmap* webp_bitmap = decode_webp_via_wic(bytes, size);
         if (webp_bitmap) {
             m_artwork_image = webp_bitmap;
 
@@ -1603,7 +1552,7 @@ bool artwork_ui_element::load_image_from_memory(const t_uint8* data, size_t size
             static_api_ptr_t<playback_control> pc;
             m_was_playing = pc->is_playing();
             if (!m_infobar_bitmap && cfg_infobar && m_was_playing && is_internet_stream(m_current_track)) {
-                Gdiplus::Bitmap* infobar_bitmap = decode_webp_via_wic(data, size);
+                Gdiplus::Bitmap* infobar_bitmap = decode_webp_via_wic(bytes, size);
                 if (infobar_bitmap && infobar_bitmap->GetLastStatus() == Gdiplus::Ok) {
                     m_infobar_bitmap = infobar_bitmap;
                 } else {
@@ -1616,24 +1565,9 @@ bool artwork_ui_element::load_image_from_memory(const t_uint8* data, size_t size
         return false; // WebP detected but decoding failed (old Windows etc.)
     }
 
-    // Create IStream from memory
-    HGLOBAL hGlobal = GlobalAlloc(GMEM_MOVEABLE, size);
-    if (!hGlobal) {
-        return false;
-    }
-    
-    void* pData = GlobalLock(hGlobal);
-    if (!pData) {
-        GlobalFree(hGlobal);
-        return false;
-    }
-    
-    memcpy(pData, data, size);
-    GlobalUnlock(hGlobal);
-    
-    IStream* stream = nullptr;
-    if (CreateStreamOnHGlobal(hGlobal, TRUE, &stream) != S_OK) {
-        GlobalFree(hGlobal);
+    // Create IStream over the shared buffer (no HGLOBAL copy)
+    IStream* stream = data.create_stream();
+    if (!stream) {
         return false;
     }
     
@@ -1679,25 +1613,9 @@ bool artwork_ui_element::load_image_from_memory(const t_uint8* data, size_t size
 
     if (!m_infobar_bitmap && cfg_infobar && m_was_playing && is_internet_stream(m_current_track)) {
         
-        // Create IStream from memory2
-        
-        HGLOBAL hGlobal2 = GlobalAlloc(GMEM_MOVEABLE, size);
-        if (!hGlobal2) {
-            return false;
-        }
-
-        void* pData2 = GlobalLock(hGlobal2);
-        if (!pData2) {
-            GlobalFree(hGlobal2);
-            return false;
-        }
-
-        memcpy(pData2, data, size);
-        GlobalUnlock(hGlobal2);
-
-        IStream* stream2 = nullptr;
-        if (CreateStreamOnHGlobal(hGlobal2, TRUE, &stream2) != S_OK) {
-            GlobalFree(hGlobal2);
+        // Second stream over the same shared buffer
+        IStream* stream2 = data.create_stream();
+        if (!stream2) {
             return false;
         }
         //infobar
@@ -2119,29 +2037,18 @@ std::string artwork_ui_element::clean_metadata_for_search(const char* metadata)
 void artwork_ui_element::on_artwork_event(const ArtworkEvent& event) {
     if (!IsWindow()) return;
 
-    // Marshal to the main thread via PostMessage to avoid modifying GDI+ state
-    // from background threads. Heap-allocate a copy of the event data.
-    auto* data = new ArtworkEventData();
-    data->type = event.type;
-    data->bitmap = event.bitmap;
-    data->source = event.source;
-    data->artist = event.artist;
-    data->title = event.title;
-    if (!PostMessage(WM_USER_ARTWORK_EVENT, 0, reinterpret_cast<LPARAM>(data))) {
-        delete data; // PostMessage failed (window destroyed, etc.)
-    }
+    // Events are delivered on the main thread, already coalesced; SendMessage runs
+    // the handler now, while the event still holds a reference to its image
+    SendMessage(WM_USER_ARTWORK_EVENT, 0, reinterpret_cast<LPARAM>(&event));
 }
 
 LRESULT artwork_ui_element::OnArtworkEvent(UINT uMsg, WPARAM wParam, LPARAM lParam, BOOL& bHandled) {
-    auto* event = reinterpret_cast<ArtworkEventData*>(lParam);
+    const ArtworkEvent* event = reinterpret_cast<const ArtworkEvent*>(lParam);
     if (!event) {
         bHandled = TRUE;
         return 0;
     }
 
-    // Take ownership — ensure we delete the heap-allocated data when done
-    std::unique_ptr<ArtworkEventData> event_guard(event);
-
     switch (event->type) {
         case ArtworkEventType::ARTWORK_LOADED:
             {
@@ -2286,13 +2193,13 @@ bool artwork_ui_element::should_prefer_local_artwork() {
     if (is_internet_stream(m_current_track)) return false;
     
     // Check if main component already found local artwork
-    HBITMAP main_bitmap = get_main_component_artwork_bitmap();
-    return (main_bitmap != NULL);
+    return get_main_component_artwork_image() != nullptr;
 }
 
 bool artwork_ui_element::load_local_artwork_from_main_component() {
-    HBITMAP main_bitmap = get_main_component_artwork_bitmap();
-    if (!main_bitmap) return false;
+    // Keep the main component's image alive while it is converted
+    shared_hbitmap main_image = get_main_component_artwork_image();
+    if (!main_image) return false;
     
     // If we already have artwork with a valid source (like "Deezer"), don't override it
     if (m_artwork_image && !m_artwork_source.empty() && m_artwork_source != "Unknown") {
@@ -2303,7 +2210,7 @@ bool artwork_ui_element::load_local_artwork_from_main_component() {
     cleanup_gdiplus_image();
     
     try {
-        m_artwork_image = Gdiplus::Bitmap::FromHBITMAP(main_bitmap, NULL);
+        m_artwork_image = Gdiplus::Bitmap::FromHBITMAP(main_image.get(), NULL);
         
         if (m_artwork_image && m_artwork_image->GetLastStatus() == Gdiplus::Ok) {
             m_artwork_loading = false;
@@ -0,0 +1,755 @@
+#include "stdafx.h"
+#include "unicode_fold.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+
+struct fold_entry {
+    uint16_t code_point;
+    uint16_t offset;    // Into fold_pool
+    uint8_t length;     // 0 strips the code point (combining accents)
+};
+
+// Generated from the Unicode 14.0 character database for every assigned BMP code
+// point whose folded form differs: NFKD, drop combining diacritical marks
+// (U+0300-036F, 1AB0-1AFF, 1DC0-1DFF, 20D0-20FF, FE20-FE2F), case fold, repeat the
+// decomposition, then map æ ø œ ð đ ł ħ ı ŧ þ ŀ ƀ ɨ ʉ ɍ ɏ ƶ ȥ ǥ ĸ to ASCII.
+// Cyrillic й keeps its breve. Hangul syllables, enclosed CJK, CJK compatibility
+// ideographs and Arabic ligature words are left composed.
+// Regenerate with tests/tools/gen_unicode_fold.py; do not edit by hand.
+static const char fold_pool[] =
+    "\x20\x61\x32\x33\xCE\xBC\x31\x6F\x31\xE2\x81\x84\x34\x31\xE2\x81\x84\x32\x33\xE2\x81\x84\x34\x61\x65\x63\x69\x64\x6E\x75\x79\x74"
+    "\x68\x73\x73\x67\x69\x6A\x6B\x6C\x6C\xC2\xB7\xCA\xBC\x6E\xC5\x8B\x6F\x65\x72\x77\x7A\x62\xC9\x93\xC6\x83\xC6\x85\xC9\x94\xC6\x88"
+    "\xC9\x96\xC9\x97\xC6\x8C\xC7\x9D\xC9\x99\xC9\x9B\xC6\x92\xC9\xA0\xC9\xA3\xC9\xA9\xC6\x99\xC9\xAF\xC9\xB2\xC9\xB5\xC6\xA3\xC6\xA5"
+    "\xCA\x80\xC6\xA8\xCA\x83\xC6\xAD\xCA\x88\xCA\x8A\xCA\x8B\xC6\xB4\xCA\x92\xC6\xB9\xC6\xBD\x64\x7A\x6C\x6A\x6E\x6A\xC6\x95\xC6\xBF"
+    "\xC8\x9D\xC6\x9E\xC8\xA3\xE2\xB1\xA5\xC8\xBC\xC6\x9A\xE2\xB1\xA6\xC9\x82\xCA\x8C\xC9\x87\xC9\x89\xC9\x8B\xC9\xA6\xC9\xB9\xC9\xBB"
+    "\xCA\x81\x78\xCA\x95\xCD\xB1\xCD\xB3\xCA\xB9\xCD\xB7\x3B\xCF\xB3\xCE\xB1\xCE\xB5\xCE\xB7\xCE\xB9\xCE\xBF\xCF\x85\xCF\x89\xCE\xB2"
+    "\xCE\xB3\xCE\xB4\xCE\xB6\xCE\xB8\xCE\xBA\xCE\xBB\xCE\xBD\xCE\xBE\xCF\x80\xCF\x81\xCF\x83\xCF\x84\xCF\x86\xCF\x87\xCF\x88\xCF\x97"
+    "\xCF\x99\xCF\x9B\xCF\x9D\xCF\x9F\xCF\xA1\xCF\xA3\xCF\xA5\xCF\xA7\xCF\xA9\xCF\xAB\xCF\xAD\xCF\xAF\xCF\xB8\xCF\xBB\xCD\xBB\xCD\xBC"
+    "\xCD\xBD\xD0\xB5\xD1\x92\xD0\xB3\xD1\x94\xD1\x95\xD1\x96\xD1\x98\xD1\x99\xD1\x9A\xD1\x9B\xD0\xBA\xD0\xB8\xD1\x83\xD1\x9F\xD0\xB0"
+    "\xD0\xB1\xD0\xB2\xD0\xB4\xD0\xB6\xD0\xB7\xD0\xB9\xD0\xBB\xD0\xBC\xD0\xBD\xD0\xBE\xD0\xBF\xD1\x80\xD1\x81\xD1\x82\xD1\x84\xD1\x85"
+    "\xD1\x86\xD1\x87\xD1\x88\xD1\x89\xD1\x8A\xD1\x8B\xD1\x8C\xD1\x8D\xD1\x8E\xD1\x8F\xD1\xA1\xD1\xA3\xD1\xA5\xD1\xA7\xD1\xA9\xD1\xAB"
+    "\xD1\xAD\xD1\xAF\xD1\xB1\xD1\xB3\xD1\xB5\xD1\xB9\xD1\xBB\xD1\xBD\xD1\xBF\xD2\x81\xD2\x8B\xD2\x8D\xD2\x8F\xD2\x91\xD2\x93\xD2\x95"
+    "\xD2\x97\xD2\x99\xD2\x9B\xD2\x9D\xD2\x9F\xD2\xA1\xD2\xA3\xD2\xA5\xD2\xA7\xD2\xA9\xD2\xAB\xD2\xAD\xD2\xAF\xD2\xB1\xD2\xB3\xD2\xB5"
+    "\xD2\xB7\xD2\xB9\xD2\xBB\xD2\xBD\xD2\xBF\xD3\x8F\xD3\x84\xD3\x86\xD3\x88\xD3\x8A\xD3\x8C\xD3\x8E\xD3\x95\xD3\x99\xD3\xA1\xD3\xA9"
+    "\xD3\xB7\xD3\xBB\xD3\xBD\xD3\xBF\xD4\x81\xD4\x83\xD4\x85\xD4\x87\xD4\x89\xD4\x8B\xD4\x8D\xD4\x8F\xD4\x91\xD4\x93\xD4\x95\xD4\x97"
+    "\xD4\x99\xD4\x9B\xD4\x9D\xD4\x9F\xD4\xA1\xD4\xA3\xD4\xA5\xD4\xA7\xD4\xA9\xD4\xAB\xD4\xAD\xD4\xAF\xD5\xA1\xD5\xA2\xD5\xA3\xD5\xA4"
+    "\xD5\xA5\xD5\xA6\xD5\xA7\xD5\xA8\xD5\xA9\xD5\xAA\xD5\xAB\xD5\xAC\xD5\xAD\xD5\xAE\xD5\xAF\xD5\xB0\xD5\xB1\xD5\xB2\xD5\xB3\xD5\xB4"
+    "\xD5\xB5\xD5\xB6\xD5\xB7\xD5\xB8\xD5\xB9\xD5\xBA\xD5\xBB\xD5\xBC\xD5\xBD\xD5\xBE\xD5\xBF\xD6\x80\xD6\x81\xD6\x82\xD6\x83\xD6\x84"
+    "\xD6\x85\xD6\x86\xD5\xA5\xD6\x82\xD8\xA7\xD9\x93\xD8\xA7\xD9\x94\xD9\x88\xD9\x94\xD8\xA7\xD9\x95\xD9\x8A\xD9\x94\xD8\xA7\xD9\xB4"
+    "\xD9\x88\xD9\xB4\xDB\x87\xD9\xB4\xD9\x8A\xD9\xB4\xDB\x95\xD9\x94\xDB\x81\xD9\x94\xDB\x92\xD9\x94\xE0\xA4\xA8\xE0\xA4\xBC\xE0\xA4"
+    "\xB0\xE0\xA4\xBC\xE0\xA4\xB3\xE0\xA4\xBC\xE0\xA4\x95\xE0\xA4\xBC\xE0\xA4\x96\xE0\xA4\xBC\xE0\xA4\x97\xE0\xA4\xBC\xE0\xA4\x9C\xE0"
+    "\xA4\xBC\xE0\xA4\xA1\xE0\xA4\xBC\xE0\xA4\xA2\xE0\xA4\xBC\xE0\xA4\xAB\xE0\xA4\xBC\xE0\xA4\xAF\xE0\xA4\xBC\xE0\xA7\x87\xE0\xA6\xBE"
+    "\xE0\xA7\x87\xE0\xA7\x97\xE0\xA6\xA1\xE0\xA6\xBC\xE0\xA6\xA2\xE0\xA6\xBC\xE0\xA6\xAF\xE0\xA6\xBC\xE0\xA8\xB2\xE0\xA8\xBC\xE0\xA8"
+    "\xB8\xE0\xA8\xBC\xE0\xA8\x96\xE0\xA8\xBC\xE0\xA8\x97\xE0\xA8\xBC\xE0\xA8\x9C\xE0\xA8\xBC\xE0\xA8\xAB\xE0\xA8\xBC\xE0\xAD\x87\xE0"
+    "\xAD\x96\xE0\xAD\x87\xE0\xAC\xBE\xE0\xAD\x87\xE0\xAD\x97\xE0\xAC\xA1\xE0\xAC\xBC\xE0\xAC\xA2\xE0\xAC\xBC\xE0\xAE\x92\xE0\xAF\x97"
+    "\xE0\xAF\x86\xE0\xAE\xBE\xE0\xAF\x87\xE0\xAE\xBE\xE0\xAF\x86\xE0\xAF\x97\xE0\xB1\x86\xE0\xB1\x96\xE0\xB2\xBF\xE0\xB3\x95\xE0\xB3"
+    "\x86\xE0\xB3\x95\xE0\xB3\x86\xE0\xB3\x96\xE0\xB3\x86\xE0\xB3\x82\xE0\xB3\x86\xE0\xB3\x82\xE0\xB3\x95\xE0\xB5\x86\xE0\xB4\xBE\xE0"
+    "\xB5\x87\xE0\xB4\xBE\xE0\xB5\x86\xE0\xB5\x97\xE0\xB7\x99\xE0\xB7\x8A\xE0\xB7\x99\xE0\xB7\x8F\xE0\xB7\x99\xE0\xB7\x8F\xE0\xB7\x8A"
+    "\xE0\xB7\x99\xE0\xB7\x9F\xE0\xB9\x8D\xE0\xB8\xB2\xE0\xBB\x8D\xE0\xBA\xB2\xE0\xBA\xAB\xE0\xBA\x99\xE0\xBA\xAB\xE0\xBA\xA1\xE0\xBC"
+    "\x8B\xE0\xBD\x82\xE0\xBE\xB7\xE0\xBD\x8C\xE0\xBE\xB7\xE0\xBD\x91\xE0\xBE\xB7\xE0\xBD\x96\xE0\xBE\xB7\xE0\xBD\x9B\xE0\xBE\xB7\xE0"
+    "\xBD\x80\xE0\xBE\xB5\xE0\xBD\xB1\xE0\xBD\xB2\xE0\xBD\xB1\xE0\xBD\xB4\xE0\xBE\xB2\xE0\xBE\x80\xE0\xBE\xB2\xE0\xBD\xB1\xE0\xBE\x80"
+    "\xE0\xBE\xB3\xE0\xBE\x80\xE0\xBE\xB3\xE0\xBD\xB1\xE0\xBE\x80\xE0\xBE\x92\xE0\xBE\xB7\xE0\xBE\x9C\xE0\xBE\xB7\xE0\xBE\xA1\xE0\xBE"
+    "\xB7\xE0\xBE\xA6\xE0\xBE\xB7\xE0\xBE\xAB\xE0\xBE\xB7\xE0\xBE\x90\xE0\xBE\xB5\xE1\x80\xA5\xE1\x80\xAE\xE2\xB4\x80\xE2\xB4\x81\xE2"
+    "\xB4\x82\xE2\xB4\x83\xE2\xB4\x84\xE2\xB4\x85\xE2\xB4\x86\xE2\xB4\x87\xE2\xB4\x88\xE2\xB4\x89\xE2\xB4\x8A\xE2\xB4\x8B\xE2\xB4\x8C"
+    "\xE2\xB4\x8D\xE2\xB4\x8E\xE2\xB4\x8F\xE2\xB4\x90\xE2\xB4\x91\xE2\xB4\x92\xE2\xB4\x93\xE2\xB4\x94\xE2\xB4\x95\xE2\xB4\x96\xE2\xB4"
+    "\x97\xE2\xB4\x98\xE2\xB4\x99\xE2\xB4\x9A\xE2\xB4\x9B\xE2\xB4\x9C\xE2\xB4\x9D\xE2\xB4\x9E\xE2\xB4\x9F\xE2\xB4\xA0\xE2\xB4\xA1\xE2"
+    "\xB4\xA2\xE2\xB4\xA3\xE2\xB4\xA4\xE2\xB4\xA5\xE2\xB4\xA7\xE2\xB4\xAD\xE1\x83\x9C\xE1\x8F\xB0\xE1\x8F\xB1\xE1\x8F\xB2\xE1\x8F\xB3"
+    "\xE1\x8F\xB4\xE1\x8F\xB5\xE1\xAC\x85\xE1\xAC\xB5\xE1\xAC\x87\xE1\xAC\xB5\xE1\xAC\x89\xE1\xAC\xB5\xE1\xAC\x8B\xE1\xAC\xB5\xE1\xAC"
+    "\x8D\xE1\xAC\xB5\xE1\xAC\x91\xE1\xAC\xB5\xE1\xAC\xBA\xE1\xAC\xB5\xE1\xAC\xBC\xE1\xAC\xB5\xE1\xAC\xBE\xE1\xAC\xB5\xE1\xAC\xBF\xE1"
+    "\xAC\xB5\xE1\xAD\x82\xE1\xAC\xB5\xEA\x99\x8B\xE1\x83\x90\xE1\x83\x91\xE1\x83\x92\xE1\x83\x93\xE1\x83\x94\xE1\x83\x95\xE1\x83\x96"
+    "\xE1\x83\x97\xE1\x83\x98\xE1\x83\x99\xE1\x83\x9A\xE1\x83\x9B\xE1\x83\x9D\xE1\x83\x9E\xE1\x83\x9F\xE1\x83\xA0\xE1\x83\xA1\xE1\x83"
+    "\xA2\xE1\x83\xA3\xE1\x83\xA4\xE1\x83\xA5\xE1\x83\xA6\xE1\x83\xA7\xE1\x83\xA8\xE1\x83\xA9\xE1\x83\xAA\xE1\x83\xAB\xE1\x83\xAC\xE1"
+    "\x83\xAD\xE1\x83\xAE\xE1\x83\xAF\xE1\x83\xB0\xE1\x83\xB1\xE1\x83\xB2\xE1\x83\xB3\xE1\x83\xB4\xE1\x83\xB5\xE1\x83\xB6\xE1\x83\xB7"
+    "\xE1\x83\xB8\xE1\x83\xB9\xE1\x83\xBA\xE1\x83\xBD\xE1\x83\xBE\xE1\x83\xBF\x6D\x70\xC9\x90\xC9\x91\xE1\xB4\x82\xC9\x9C\xE1\xB4\x96"
+    "\xE1\xB4\x97\xE1\xB4\x9D\x76\xE1\xB4\xA5\xC9\x92\xC9\x95\x66\xC9\x9F\xC9\xA1\xC9\xA5\xC9\xAA\xE1\xB5\xBB\xCA\x9D\xC9\xAD\xE1\xB6"
+    "\x85\xCA\x9F\xC9\xB1\xC9\xB0\xC9\xB3\xC9\xB4\xC9\xB8\xCA\x82\xC6\xAB\xE1\xB4\x9C\xCA\x90\xCA\x91\x61\xCA\xBE\xE1\xBB\xBB\xE1\xBB"
+    "\xBD\xE1\xBB\xBF\x60\xE2\x80\x90\x2E\x2E\x2E\xE2\x80\xB2\xE2\x80\xB2\xE2\x80\xB2\xE2\x80\xB2\xE2\x80\xB2\xE2\x80\xB5\xE2\x80\xB5"
+    "\xE2\x80\xB5\xE2\x80\xB5\xE2\x80\xB5\x21\x21\x3F\x3F\x3F\x21\x30\x35\x36\x37\x38\x39\x2B\xE2\x88\x92\x3D\x28\x29\x72\x73\x61\x2F"
+    "\x63\x61\x2F\x73\xC2\xB0\x63\x63\x2F\x6F\x63\x2F\x75\xC2\xB0\x66\x6E\x6F\x71\x73\x6D\x74\x65\x6C\x74\x6D\xE2\x85\x8E\xD7\x90\xD7"
+    "\x91\xD7\x92\xD7\x93\x66\x61\x78\xE2\x88\x91\x31\xE2\x81\x84\x37\x31\xE2\x81\x84\x39\x31\xE2\x81\x84\x31\x30\x31\xE2\x81\x84\x33"
+    "\x32\xE2\x81\x84\x33\x31\xE2\x81\x84\x35\x32\xE2\x81\x84\x35\x33\xE2\x81\x84\x35\x34\xE2\x81\x84\x35\x31\xE2\x81\x84\x36\x35\xE2"
+    "\x81\x84\x36\x31\xE2\x81\x84\x38\x33\xE2\x81\x84\x38\x35\xE2\x81\x84\x38\x37\xE2\x81\x84\x38\x69\x69\x69\x69\x69\x69\x76\x76\x69"
+    "\x76\x69\x69\x76\x69\x69\x69\x69\x78\x78\x69\x78\x69\x69\xE2\x86\x84\x30\xE2\x81\x84\x33\xE2\x86\x90\xE2\x86\x92\xE2\x86\x94\xE2"
+    "\x87\x90\xE2\x87\x94\xE2\x87\x92\xE2\x88\x83\xE2\x88\x88\xE2\x88\x8B\xE2\x88\xA3\xE2\x88\xA5\xE2\x88\xAB\xE2\x88\xAB\xE2\x88\xAB"
+    "\xE2\x88\xAB\xE2\x88\xAB\xE2\x88\xAE\xE2\x88\xAE\xE2\x88\xAE\xE2\x88\xAE\xE2\x88\xAE\xE2\x88\xBC\xE2\x89\x83\xE2\x89\x85\xE2\x89"
+    "\x88\xE2\x89\xA1\xE2\x89\x8D\x3C\x3E\xE2\x89\xA4\xE2\x89\xA5\xE2\x89\xB2\xE2\x89\xB3\xE2\x89\xB6\xE2\x89\xB7\xE2\x89\xBA\xE2\x89"
+    "\xBB\xE2\x8A\x82\xE2\x8A\x83\xE2\x8A\x86\xE2\x8A\x87\xE2\x8A\xA2\xE2\x8A\xA8\xE2\x8A\xA9\xE2\x8A\xAB\xE2\x89\xBC\xE2\x89\xBD\xE2"
+    "\x8A\x91\xE2\x8A\x92\xE2\x8A\xB2\xE2\x8A\xB3\xE2\x8A\xB4\xE2\x8A\xB5\xE3\x80\x88\xE3\x80\x89\x31\x31\x31\x32\x31\x33\x31\x34\x31"
+    "\x35\x31\x36\x31\x37\x31\x38\x31\x39\x32\x30\x28\x31\x29\x28\x32\x29\x28\x33\x29\x28\x34\x29\x28\x35\x29\x28\x36\x29\x28\x37\x29"
+    "\x28\x38\x29\x28\x39\x29\x28\x31\x30\x29\x28\x31\x31\x29\x28\x31\x32\x29\x28\x31\x33\x29\x28\x31\x34\x29\x28\x31\x35\x29\x28\x31"
+    "\x36\x29\x28\x31\x37\x29\x28\x31\x38\x29\x28\x31\x39\x29\x28\x32\x30\x29\x31\x2E\x32\x2E\x33\x2E\x34\x2E\x35\x2E\x36\x2E\x37\x2E"
+    "\x38\x2E\x39\x2E\x31\x30\x2E\x31\x31\x2E\x31\x32\x2E\x31\x33\x2E\x31\x34\x2E\x31\x35\x2E\x31\x36\x2E\x31\x37\x2E\x31\x38\x2E\x31"
+    "\x39\x2E\x32\x30\x2E\x28\x61\x29\x28\x62\x29\x28\x63\x29\x28\x64\x29\x28\x65\x29\x28\x66\x29\x28\x67\x29\x28\x68\x29\x28\x69\x29"
+    "\x28\x6A\x29\x28\x6B\x29\x28\x6C\x29\x28\x6D\x29\x28\x6E\x29\x28\x6F\x29\x28\x70\x29\x28\x71\x29\x28\x72\x29\x28\x73\x29\x28\x74"
+    "\x29\x28\x75\x29\x28\x76\x29\x28\x77\x29\x28\x78\x29\x28\x79\x29\x28\x7A\x29\x3A\x3A\x3D\x3D\x3D\xE2\xAB\x9D\xE2\xB0\xB0\xE2\xB0"
+    "\xB1\xE2\xB0\xB2\xE2\xB0\xB3\xE2\xB0\xB4\xE2\xB0\xB5\xE2\xB0\xB6\xE2\xB0\xB7\xE2\xB0\xB8\xE2\xB0\xB9\xE2\xB0\xBA\xE2\xB0\xBB\xE2"
+    "\xB0\xBC\xE2\xB0\xBD\xE2\xB0\xBE\xE2\xB0\xBF\xE2\xB1\x80\xE2\xB1\x81\xE2\xB1\x82\xE2\xB1\x83\xE2\xB1\x84\xE2\xB1\x85\xE2\xB1\x86"
+    "\xE2\xB1\x87\xE2\xB1\x88\xE2\xB1\x89\xE2\xB1\x8A\xE2\xB1\x8B\xE2\xB1\x8C\xE2\xB1\x8D\xE2\xB1\x8E\xE2\xB1\x8F\xE2\xB1\x90\xE2\xB1"
+    "\x91\xE2\xB1\x92\xE2\xB1\x93\xE2\xB1\x94\xE2\xB1\x95\xE2\xB1\x96\xE2\xB1\x97\xE2\xB1\x98\xE2\xB1\x99\xE2\xB1\x9A\xE2\xB1\x9B\xE2"
+    "\xB1\x9C\xE2\xB1\x9D\xE2\xB1\x9E\xE2\xB1\x9F\xE2\xB1\xA1\xC9\xAB\xE1\xB5\xBD\xC9\xBD\xE2\xB1\xA8\xE2\xB1\xAA\xE2\xB1\xAC\xE2\xB1"
+    "\xB3\xE2\xB1\xB6\xC8\xBF\xC9\x80\xE2\xB2\x81\xE2\xB2\x83\xE2\xB2\x85\xE2\xB2\x87\xE2\xB2\x89\xE2\xB2\x8B\xE2\xB2\x8D\xE2\xB2\x8F"
+    "\xE2\xB2\x91\xE2\xB2\x93\xE2\xB2\x95\xE2\xB2\x97\xE2\xB2\x99\xE2\xB2\x9B\xE2\xB2\x9D\xE2\xB2\x9F\xE2\xB2\xA1\xE2\xB2\xA3\xE2\xB2"
+    "\xA5\xE2\xB2\xA7\xE2\xB2\xA9\xE2\xB2\xAB\xE2\xB2\xAD\xE2\xB2\xAF\xE2\xB2\xB1\xE2\xB2\xB3\xE2\xB2\xB5\xE2\xB2\xB7\xE2\xB2\xB9\xE2"
+    "\xB2\xBB\xE2\xB2\xBD\xE2\xB2\xBF\xE2\xB3\x81\xE2\xB3\x83\xE2\xB3\x85\xE2\xB3\x87\xE2\xB3\x89\xE2\xB3\x8B\xE2\xB3\x8D\xE2\xB3\x8F"
+    "\xE2\xB3\x91\xE2\xB3\x93\xE2\xB3\x95\xE2\xB3\x97\xE2\xB3\x99\xE2\xB3\x9B\xE2\xB3\x9D\xE2\xB3\x9F\xE2\xB3\xA1\xE2\xB3\xA3\xE2\xB3"
+    "\xAC\xE2\xB3\xAE\xE2\xB3\xB3\xE2\xB5\xA1\xE6\xAF\x8D\xE9\xBE\x9F\xE4\xB8\x80\xE4\xB8\xA8\xE4\xB8\xB6\xE4\xB8\xBF\xE4\xB9\x99\xE4"
+    "\xBA\x85\xE4\xBA\x8C\xE4\xBA\xA0\xE4\xBA\xBA\xE5\x84\xBF\xE5\x85\xA5\xE5\x85\xAB\xE5\x86\x82\xE5\x86\x96\xE5\x86\xAB\xE5\x87\xA0"
+    "\xE5\x87\xB5\xE5\x88\x80\xE5\x8A\x9B\xE5\x8B\xB9\xE5\x8C\x95\xE5\x8C\x9A\xE5\x8C\xB8\xE5\x8D\x81\xE5\x8D\x9C\xE5\x8D\xA9\xE5\x8E"
+    "\x82\xE5\x8E\xB6\xE5\x8F\x88\xE5\x8F\xA3\xE5\x9B\x97\xE5\x9C\x9F\xE5\xA3\xAB\xE5\xA4\x82\xE5\xA4\x8A\xE5\xA4\x95\xE5\xA4\xA7\xE5"
+    "\xA5\xB3\xE5\xAD\x90\xE5\xAE\x80\xE5\xAF\xB8\xE5\xB0\x8F\xE5\xB0\xA2\xE5\xB0\xB8\xE5\xB1\xAE\xE5\xB1\xB1\xE5\xB7\x9B\xE5\xB7\xA5"
+    "\xE5\xB7\xB1\xE5\xB7\xBE\xE5\xB9\xB2\xE5\xB9\xBA\xE5\xB9\xBF\xE5\xBB\xB4\xE5\xBB\xBE\xE5\xBC\x8B\xE5\xBC\x93\xE5\xBD\x90\xE5\xBD"
+    "\xA1\xE5\xBD\xB3\xE5\xBF\x83\xE6\x88\x88\xE6\x88\xB6\xE6\x89\x8B\xE6\x94\xAF\xE6\x94\xB4\xE6\x96\x87\xE6\x96\x97\xE6\x96\xA4\xE6"
+    "\x96\xB9\xE6\x97\xA0\xE6\x97\xA5\xE6\x9B\xB0\xE6\x9C\x88\xE6\x9C\xA8\xE6\xAC\xA0\xE6\xAD\xA2\xE6\xAD\xB9\xE6\xAE\xB3\xE6\xAF\x8B"
+    "\xE6\xAF\x94\xE6\xAF\x9B\xE6\xB0\x8F\xE6\xB0\x94\xE6\xB0\xB4\xE7\x81\xAB\xE7\x88\xAA\xE7\x88\xB6\xE7\x88\xBB\xE7\x88\xBF\xE7\x89"
+    "\x87\xE7\x89\x99\xE7\x89\x9B\xE7\x8A\xAC\xE7\x8E\x84\xE7\x8E\x89\xE7\x93\x9C\xE7\x93\xA6\xE7\x94\x98\xE7\x94\x9F\xE7\x94\xA8\xE7"
+    "\x94\xB0\xE7\x96\x8B\xE7\x96\x92\xE7\x99\xB6\xE7\x99\xBD\xE7\x9A\xAE\xE7\x9A\xBF\xE7\x9B\xAE\xE7\x9F\x9B\xE7\x9F\xA2\xE7\x9F\xB3"
+    "\xE7\xA4\xBA\xE7\xA6\xB8\xE7\xA6\xBE\xE7\xA9\xB4\xE7\xAB\x8B\xE7\xAB\xB9\xE7\xB1\xB3\xE7\xB3\xB8\xE7\xBC\xB6\xE7\xBD\x91\xE7\xBE"
+    "\x8A\xE7\xBE\xBD\xE8\x80\x81\xE8\x80\x8C\xE8\x80\x92\xE8\x80\xB3\xE8\x81\xBF\xE8\x82\x89\xE8\x87\xA3\xE8\x87\xAA\xE8\x87\xB3\xE8"
+    "\x87\xBC\xE8\x88\x8C\xE8\x88\x9B\xE8\x88\x9F\xE8\x89\xAE\xE8\x89\xB2\xE8\x89\xB8\xE8\x99\x8D\xE8\x99\xAB\xE8\xA1\x80\xE8\xA1\x8C"
+    "\xE8\xA1\xA3\xE8\xA5\xBE\xE8\xA6\x8B\xE8\xA7\x92\xE8\xA8\x80\xE8\xB0\xB7\xE8\xB1\x86\xE8\xB1\x95\xE8\xB1\xB8\xE8\xB2\x9D\xE8\xB5"
+    "\xA4\xE8\xB5\xB0\xE8\xB6\xB3\xE8\xBA\xAB\xE8\xBB\x8A\xE8\xBE\x9B\xE8\xBE\xB0\xE8\xBE\xB5\xE9\x82\x91\xE9\x85\x89\xE9\x87\x86\xE9"
+    "\x87\x8C\xE9\x87\x91\xE9\x95\xB7\xE9\x96\x80\xE9\x98\x9C\xE9\x9A\xB6\xE9\x9A\xB9\xE9\x9B\xA8\xE9\x9D\x91\xE9\x9D\x9E\xE9\x9D\xA2"
+    "\xE9\x9D\xA9\xE9\x9F\x8B\xE9\x9F\xAD\xE9\x9F\xB3\xE9\xA0\x81\xE9\xA2\xA8\xE9\xA3\x9B\xE9\xA3\x9F\xE9\xA6\x96\xE9\xA6\x99\xE9\xA6"
+    "\xAC\xE9\xAA\xA8\xE9\xAB\x98\xE9\xAB\x9F\xE9\xAC\xA5\xE9\xAC\xAF\xE9\xAC\xB2\xE9\xAC\xBC\xE9\xAD\x9A\xE9\xB3\xA5\xE9\xB9\xB5\xE9"
+    "\xB9\xBF\xE9\xBA\xA5\xE9\xBA\xBB\xE9\xBB\x83\xE9\xBB\x8D\xE9\xBB\x91\xE9\xBB\xB9\xE9\xBB\xBD\xE9\xBC\x8E\xE9\xBC\x93\xE9\xBC\xA0"
+    "\xE9\xBC\xBB\xE9\xBD\x8A\xE9\xBD\x92\xE9\xBE\x8D\xE9\xBE\x9C\xE9\xBE\xA0\xE3\x80\x92\xE5\x8D\x84\xE5\x8D\x85\xE3\x81\x8B\xE3\x82"
+    "\x99\xE3\x81\x8D\xE3\x82\x99\xE3\x81\x8F\xE3\x82\x99\xE3\x81\x91\xE3\x82\x99\xE3\x81\x93\xE3\x82\x99\xE3\x81\x95\xE3\x82\x99\xE3"
+    "\x81\x97\xE3\x82\x99\xE3\x81\x99\xE3\x82\x99\xE3\x81\x9B\xE3\x82\x99\xE3\x81\x9D\xE3\x82\x99\xE3\x81\x9F\xE3\x82\x99\xE3\x81\xA1"
+    "\xE3\x82\x99\xE3\x81\xA4\xE3\x82\x99\xE3\x81\xA6\xE3\x82\x99\xE3\x81\xA8\xE3\x82\x99\xE3\x81\xAF\xE3\x82\x99\xE3\x81\xAF\xE3\x82"
+    "\x9A\xE3\x81\xB2\xE3\x82\x99\xE3\x81\xB2\xE3\x82\x9A\xE3\x81\xB5\xE3\x82\x99\xE3\x81\xB5\xE3\x82\x9A\xE3\x81\xB8\xE3\x82\x99\xE3"
+    "\x81\xB8\xE3\x82\x9A\xE3\x81\xBB\xE3\x82\x99\xE3\x81\xBB\xE3\x82\x9A\xE3\x81\x86\xE3\x82\x99\x20\xE3\x82\x99\x20\xE3\x82\x9A\xE3"
+    "\x82\x9D\xE3\x82\x99\xE3\x82\x88\xE3\x82\x8A\xE3\x82\xAB\xE3\x82\x99\xE3\x82\xAD\xE3\x82\x99\xE3\x82\xAF\xE3\x82\x99\xE3\x82\xB1"
+    "\xE3\x82\x99\xE3\x82\xB3\xE3\x82\x99\xE3\x82\xB5\xE3\x82\x99\xE3\x82\xB7\xE3\x82\x99\xE3\x82\xB9\xE3\x82\x99\xE3\x82\xBB\xE3\x82"
+    "\x99\xE3\x82\xBD\xE3\x82\x99\xE3\x82\xBF\xE3\x82\x99\xE3\x83\x81\xE3\x82\x99\xE3\x83\x84\xE3\x82\x99\xE3\x83\x86\xE3\x82\x99\xE3"
+    "\x83\x88\xE3\x82\x99\xE3\x83\x8F\xE3\x82\x99\xE3\x83\x8F\xE3\x82\x9A\xE3\x83\x92\xE3\x82\x99\xE3\x83\x92\xE3\x82\x9A\xE3\x83\x95"
+    "\xE3\x82\x99\xE3\x83\x95\xE3\x82\x9A\xE3\x83\x98\xE3\x82\x99\xE3\x83\x98\xE3\x82\x9A\xE3\x83\x9B\xE3\x82\x99\xE3\x83\x9B\xE3\x82"
+    "\x9A\xE3\x82\xA6\xE3\x82\x99\xE3\x83\xAF\xE3\x82\x99\xE3\x83\xB0\xE3\x82\x99\xE3\x83\xB1\xE3\x82\x99\xE3\x83\xB2\xE3\x82\x99\xE3"
+    "\x83\xBD\xE3\x82\x99\xE3\x82\xB3\xE3\x83\x88\xE1\x84\x80\xE1\x84\x81\xE1\x86\xAA\xE1\x84\x82\xE1\x86\xAC\xE1\x86\xAD\xE1\x84\x83"
+    "\xE1\x84\x84\xE1\x84\x85\xE1\x86\xB0\xE1\x86\xB1\xE1\x86\xB2\xE1\x86\xB3\xE1\x86\xB4\xE1\x86\xB5\xE1\x84\x9A\xE1\x84\x86\xE1\x84"
+    "\x87\xE1\x84\x88\xE1\x84\xA1\xE1\x84\x89\xE1\x84\x8A\xE1\x84\x8B\xE1\x84\x8C\xE1\x84\x8D\xE1\x84\x8E\xE1\x84\x8F\xE1\x84\x90\xE1"
+    "\x84\x91\xE1\x84\x92\xE1\x85\xA1\xE1\x85\xA2\xE1\x85\xA3\xE1\x85\xA4\xE1\x85\xA5\xE1\x85\xA6\xE1\x85\xA7\xE1\x85\xA8\xE1\x85\xA9"
+    "\xE1\x85\xAA\xE1\x85\xAB\xE1\x85\xAC\xE1\x85\xAD\xE1\x85\xAE\xE1\x85\xAF\xE1\x85\xB0\xE1\x85\xB1\xE1\x85\xB2\xE1\x85\xB3\xE1\x85"
+    "\xB4\xE1\x85\xB5\xE1\x85\xA0\xE1\x84\x94\xE1\x84\x95\xE1\x87\x87\xE1\x87\x88\xE1\x87\x8C\xE1\x87\x8E\xE1\x87\x93\xE1\x87\x97\xE1"
+    "\x87\x99\xE1\x84\x9C\xE1\x87\x9D\xE1\x87\x9F\xE1\x84\x9D\xE1\x84\x9E\xE1\x84\xA0\xE1\x84\xA2\xE1\x84\xA3\xE1\x84\xA7\xE1\x84\xA9"
+    "\xE1\x84\xAB\xE1\x84\xAC\xE1\x84\xAD\xE1\x84\xAE\xE1\x84\xAF\xE1\x84\xB2\xE1\x84\xB6\xE1\x85\x80\xE1\x85\x87\xE1\x85\x8C\xE1\x87"
+    "\xB1\xE1\x87\xB2\xE1\x85\x97\xE1\x85\x98\xE1\x85\x99\xE1\x86\x84\xE1\x86\x85\xE1\x86\x88\xE1\x86\x91\xE1\x86\x92\xE1\x86\x94\xE1"
+    "\x86\x9E\xE1\x86\xA1\xE4\xB8\x89\xE5\x9B\x9B\xE4\xB8\x8A\xE4\xB8\xAD\xE4\xB8\x8B\xE7\x94\xB2\xE4\xB8\x99\xE4\xB8\x81\xE5\xA4\xA9"
+    "\xE5\x9C\xB0\xEA\x99\x81\xEA\x99\x83\xEA\x99\x85\xEA\x99\x87\xEA\x99\x89\xEA\x99\x8D\xEA\x99\x8F\xEA\x99\x91\xEA\x99\x93\xEA\x99"
+    "\x95\xEA\x99\x97\xEA\x99\x99\xEA\x99\x9B\xEA\x99\x9D\xEA\x99\x9F\xEA\x99\xA1\xEA\x99\xA3\xEA\x99\xA5\xEA\x99\xA7\xEA\x99\xA9\xEA"
+    "\x99\xAB\xEA\x99\xAD\xEA\x9A\x81\xEA\x9A\x83\xEA\x9A\x85\xEA\x9A\x87\xEA\x9A\x89\xEA\x9A\x8B\xEA\x9A\x8D\xEA\x9A\x8F\xEA\x9A\x91"
+    "\xEA\x9A\x93\xEA\x9A\x95\xEA\x9A\x97\xEA\x9A\x99\xEA\x9A\x9B\xEA\x9C\xA3\xEA\x9C\xA5\xEA\x9C\xA7\xEA\x9C\xA9\xEA\x9C\xAB\xEA\x9C"
+    "\xAD\xEA\x9C\xAF\xEA\x9C\xB3\xEA\x9C\xB5\xEA\x9C\xB7\xEA\x9C\xB9\xEA\x9C\xBB\xEA\x9C\xBD\xEA\x9C\xBF\xEA\x9D\x81\xEA\x9D\x83\xEA"
+    "\x9D\x85\xEA\x9D\x87\xEA\x9D\x89\xEA\x9D\x8B\xEA\x9D\x8D\xEA\x9D\x8F\xEA\x9D\x91\xEA\x9D\x93\xEA\x9D\x95\xEA\x9D\x97\xEA\x9D\x99"
+    "\xEA\x9D\x9B\xEA\x9D\x9D\xEA\x9D\x9F\xEA\x9D\xA1\xEA\x9D\xA3\xEA\x9D\xA5\xEA\x9D\xA7\xEA\x9D\xA9\xEA\x9D\xAB\xEA\x9D\xAD\xEA\x9D"
+    "\xAF\xEA\x9D\xBA\xEA\x9D\xBC\xE1\xB5\xB9\xEA\x9D\xBF\xEA\x9E\x81\xEA\x9E\x83\xEA\x9E\x85\xEA\x9E\x87\xEA\x9E\x8C\xEA\x9E\x91\xEA"
+    "\x9E\x93\xEA\x9E\x97\xEA\x9E\x99\xEA\x9E\x9B\xEA\x9E\x9D\xEA\x9E\x9F\xEA\x9E\xA1\xEA\x9E\xA3\xEA\x9E\xA5\xEA\x9E\xA7\xEA\x9E\xA9"
+    "\xC9\xAC\xCA\x9E\xCA\x87\xEA\xAD\x93\xEA\x9E\xB5\xEA\x9E\xB7\xEA\x9E\xB9\xEA\x9E\xBB\xEA\x9E\xBD\xEA\x9E\xBF\xEA\x9F\x81\xEA\x9F"
+    "\x83\xEA\x9E\x94\xE1\xB6\x8E\xEA\x9F\x88\xEA\x9F\x8A\xEA\x9F\x91\xEA\x9F\x97\xEA\x9F\x99\xEA\x9F\xB6\xEA\xAC\xB7\xEA\xAD\x92\xCA"
+    "\x8D\xE1\x8E\xA0\xE1\x8E\xA1\xE1\x8E\xA2\xE1\x8E\xA3\xE1\x8E\xA4\xE1\x8E\xA5\xE1\x8E\xA6\xE1\x8E\xA7\xE1\x8E\xA8\xE1\x8E\xA9\xE1"
+    "\x8E\xAA\xE1\x8E\xAB\xE1\x8E\xAC\xE1\x8E\xAD\xE1\x8E\xAE\xE1\x8E\xAF\xE1\x8E\xB0\xE1\x8E\xB1\xE1\x8E\xB2\xE1\x8E\xB3\xE1\x8E\xB4"
+    "\xE1\x8E\xB5\xE1\x8E\xB6\xE1\x8E\xB7\xE1\x8E\xB8\xE1\x8E\xB9\xE1\x8E\xBA\xE1\x8E\xBB\xE1\x8E\xBC\xE1\x8E\xBD\xE1\x8E\xBE\xE1\x8E"
+    "\xBF\xE1\x8F\x80\xE1\x8F\x81\xE1\x8F\x82\xE1\x8F\x83\xE1\x8F\x84\xE1\x8F\x85\xE1\x8F\x86\xE1\x8F\x87\xE1\x8F\x88\xE1\x8F\x89\xE1"
+    "\x8F\x8A\xE1\x8F\x8B\xE1\x8F\x8C\xE1\x8F\x8D\xE1\x8F\x8E\xE1\x8F\x8F\xE1\x8F\x90\xE1\x8F\x91\xE1\x8F\x92\xE1\x8F\x93\xE1\x8F\x94"
+    "\xE1\x8F\x95\xE1\x8F\x96\xE1\x8F\x97\xE1\x8F\x98\xE1\x8F\x99\xE1\x8F\x9A\xE1\x8F\x9B\xE1\x8F\x9C\xE1\x8F\x9D\xE1\x8F\x9E\xE1\x8F"
+    "\x9F\xE1\x8F\xA0\xE1\x8F\xA1\xE1\x8F\xA2\xE1\x8F\xA3\xE1\x8F\xA4\xE1\x8F\xA5\xE1\x8F\xA6\xE1\x8F\xA7\xE1\x8F\xA8\xE1\x8F\xA9\xE1"
+    "\x8F\xAA\xE1\x8F\xAB\xE1\x8F\xAC\xE1\x8F\xAD\xE1\x8F\xAE\xE1\x8F\xAF\x66\x66\x66\x69\x66\x6C\x66\x66\x6C\x73\x74\xD5\xB4\xD5\xB6"
+    "\xD5\xB4\xD5\xA5\xD5\xB4\xD5\xAB\xD5\xBE\xD5\xB6\xD5\xB4\xD5\xAD\xD7\x99\xD6\xB4\xD7\xB2\xD6\xB7\xD7\xA2\xD7\x94\xD7\x9B\xD7\x9C"
+    "\xD7\x9D\xD7\xA8\xD7\xAA\xD7\xA9\xD7\x81\xD7\xA9\xD7\x82\xD7\xA9\xD6\xBC\xD7\x81\xD7\xA9\xD6\xBC\xD7\x82\xD7\x90\xD6\xB7\xD7\x90"
+    "\xD6\xB8\xD7\x90\xD6\xBC\xD7\x91\xD6\xBC\xD7\x92\xD6\xBC\xD7\x93\xD6\xBC\xD7\x94\xD6\xBC\xD7\x95\xD6\xBC\xD7\x96\xD6\xBC\xD7\x98"
+    "\xD6\xBC\xD7\x99\xD6\xBC\xD7\x9A\xD6\xBC\xD7\x9B\xD6\xBC\xD7\x9C\xD6\xBC\xD7\x9E\xD6\xBC\xD7\xA0\xD6\xBC\xD7\xA1\xD6\xBC\xD7\xA3"
+    "\xD6\xBC\xD7\xA4\xD6\xBC\xD7\xA6\xD6\xBC\xD7\xA7\xD6\xBC\xD7\xA8\xD6\xBC\xD7\xAA\xD6\xBC\xD7\x95\xD6\xB9\xD7\x91\xD6\xBF\xD7\x9B"
+    "\xD6\xBF\xD7\xA4\xD6\xBF\xD7\x90\xD7\x9C\xD9\xB1\xD9\xBB\xD9\xBE\xDA\x80\xD9\xBA\xD9\xBF\xD9\xB9\xDA\xA4\xDA\xA6\xDA\x84\xDA\x83"
+    "\xDA\x86\xDA\x87\xDA\x8D\xDA\x8C\xDA\x8E\xDA\x88\xDA\x98\xDA\x91\xDA\xA9\xDA\xAF\xDA\xB3\xDA\xB1\xDA\xBA\xDA\xBB\xDA\xBE\xDA\xAD"
+    "\xDB\x86\xDB\x88\xDB\x8B\xDB\x85\xDB\x89\xDB\x90\xD9\x89\xD9\x8A\xD9\x94\xDB\x95\xD9\x8A\xD9\x94\xD9\x88\xD9\x8A\xD9\x94\xDB\x87"
+    "\xD9\x8A\xD9\x94\xDB\x86\xD9\x8A\xD9\x94\xDB\x88\xD9\x8A\xD9\x94\xDB\x90\xD9\x8A\xD9\x94\xD9\x89\xDB\x8C\xD9\x8A\xD9\x94\xD8\xAC"
+    "\xD9\x8A\xD9\x94\xD8\xAD\xD9\x8A\xD9\x94\xD9\x85\xD9\x8A\xD9\x94\xD9\x8A\xD8\xA8\xD8\xAC\xD8\xA8\xD8\xAD\xD8\xA8\xD8\xAE\xD8\xA8"
+    "\xD9\x85\xD8\xA8\xD9\x89\xD8\xA8\xD9\x8A\xD8\xAA\xD8\xAC\xD8\xAA\xD8\xAD\xD8\xAA\xD8\xAE\xD8\xAA\xD9\x85\xD8\xAA\xD9\x89\xD8\xAA"
+    "\xD9\x8A\xD8\xAB\xD8\xAC\xD8\xAB\xD9\x85\xD8\xAB\xD9\x89\xD8\xAB\xD9\x8A\xD8\xAC\xD8\xAD\xD8\xAC\xD9\x85\xD8\xAD\xD9\x85\xD8\xAE"
+    "\xD8\xAC\xD8\xAE\xD8\xAD\xD8\xAE\xD9\x85\xD8\xB3\xD8\xAC\xD8\xB3\xD8\xAD\xD8\xB3\xD8\xAE\xD8\xB3\xD9\x85\xD8\xB5\xD8\xAD\xD8\xB5"
+    "\xD9\x85\xD8\xB6\xD8\xAC\xD8\xB6\xD8\xAD\xD8\xB6\xD8\xAE\xD8\xB6\xD9\x85\xD8\xB7\xD8\xAD\xD8\xB7\xD9\x85\xD8\xB8\xD9\x85\xD8\xB9"
+    "\xD8\xAC\xD8\xB9\xD9\x85\xD8\xBA\xD8\xAC\xD8\xBA\xD9\x85\xD9\x81\xD8\xAC\xD9\x81\xD8\xAD\xD9\x81\xD8\xAE\xD9\x81\xD9\x85\xD9\x81"
+    "\xD9\x89\xD9\x81\xD9\x8A\xD9\x82\xD8\xAD\xD9\x82\xD9\x85\xD9\x82\xD9\x89\xD9\x82\xD9\x8A\xD9\x83\xD8\xA7\xD9\x83\xD8\xAC\xD9\x83"
+    "\xD8\xAD\xD9\x83\xD8\xAE\xD9\x83\xD9\x84\xD9\x83\xD9\x85\xD9\x83\xD9\x89\xD9\x83\xD9\x8A\xD9\x84\xD8\xAC\xD9\x84\xD8\xAD\xD9\x84"
+    "\xD8\xAE\xD9\x84\xD9\x85\xD9\x84\xD9\x89\xD9\x84\xD9\x8A\xD9\x85\xD8\xAC\xD9\x85\xD9\x85\xD9\x85\xD9\x89\xD9\x86\xD8\xAC\xD9\x86"
+    "\xD8\xAD\xD9\x86\xD8\xAE\xD9\x86\xD9\x85\xD9\x86\xD9\x89\xD9\x86\xD9\x8A\xD9\x87\xD8\xAC\xD9\x87\xD9\x85\xD9\x87\xD9\x89\xD9\x87"
+    "\xD9\x8A\xD9\x8A\xD8\xAD\xD9\x8A\xD8\xAE\xD9\x8A\xD9\x89\xD8\xB0\xD9\xB0\xD8\xB1\xD9\xB0\xD9\x89\xD9\xB0\x20\xD9\x8C\xD9\x91\x20"
+    "\xD9\x8D\xD9\x91\x20\xD9\x8E\xD9\x91\x20\xD9\x8F\xD9\x91\x20\xD9\x90\xD9\x91\x20\xD9\x91\xD9\xB0\xD9\x8A\xD9\x94\xD8\xB1\xD9\x8A"
+    "\xD9\x94\xD8\xB2\xD9\x8A\xD9\x94\xD9\x86\xD8\xA8\xD8\xB1\xD8\xA8\xD8\xB2\xD8\xA8\xD9\x86\xD8\xAA\xD8\xB1\xD8\xAA\xD8\xB2\xD8\xAA"
+    "\xD9\x86\xD8\xAB\xD8\xB1\xD8\xAB\xD8\xB2\xD8\xAB\xD9\x86\xD9\x85\xD8\xA7\xD9\x86\xD8\xB1\xD9\x86\xD8\xB2\xD9\x86\xD9\x86\xD9\x8A"
+    "\xD8\xB1\xD9\x8A\xD8\xB2\xD9\x8A\xD9\x86\xD9\x8A\xD9\x94\xD8\xAE\xD9\x8A\xD9\x94\xD9\x87\xD8\xA8\xD9\x87\xD8\xAA\xD9\x87\xD8\xB5"
+    "\xD8\xAE\xD9\x84\xD9\x87\xD9\x86\xD9\x87\xD9\x87\xD9\xB0\xD8\xAB\xD9\x87\xD8\xB3\xD9\x87\xD8\xB4\xD9\x85\xD8\xB4\xD9\x87\xD9\x80"
+    "\xD9\x8E\xD9\x91\xD9\x80\xD9\x8F\xD9\x91\xD9\x80\xD9\x90\xD9\x91\xD8\xB7\xD9\x89\xD8\xB7\xD9\x8A\xD8\xB9\xD9\x89\xD8\xB9\xD9\x8A"
+    "\xD8\xBA\xD9\x89\xD8\xBA\xD9\x8A\xD8\xB3\xD9\x89\xD8\xB3\xD9\x8A\xD8\xB4\xD9\x89\xD8\xB4\xD9\x8A\xD8\xAD\xD9\x89\xD8\xAC\xD9\x89"
+    "\xD8\xAE\xD9\x89\xD8\xB5\xD9\x89\xD8\xB5\xD9\x8A\xD8\xB6\xD9\x89\xD8\xB6\xD9\x8A\xD8\xB4\xD8\xAC\xD8\xB4\xD8\xAD\xD8\xB4\xD8\xAE"
+    "\xD8\xB4\xD8\xB1\xD8\xB3\xD8\xB1\xD8\xB5\xD8\xB1\xD8\xB6\xD8\xB1\xD8\xA7\xD9\x8B\xD8\xAA\xD8\xAC\xD9\x85\xD8\xAA\xD8\xAD\xD8\xAC"
+    "\xD8\xAA\xD8\xAD\xD9\x85\xD8\xAA\xD8\xAE\xD9\x85\xD8\xAA\xD9\x85\xD8\xAC\xD8\xAA\xD9\x85\xD8\xAD\xD8\xAA\xD9\x85\xD8\xAE\xD8\xAD"
+    "\xD9\x85\xD9\x8A\xD8\xAD\xD9\x85\xD9\x89\xD8\xB3\xD8\xAD\xD8\xAC\xD8\xB3\xD8\xAC\xD8\xAD\xD8\xB3\xD8\xAC\xD9\x89\xD8\xB3\xD9\x85"
+    "\xD8\xAD\xD8\xB3\xD9\x85\xD8\xAC\xD8\xB3\xD9\x85\xD9\x85\xD8\xB5\xD8\xAD\xD8\xAD\xD8\xB5\xD9\x85\xD9\x85\xD8\xB4\xD8\xAD\xD9\x85"
+    "\xD8\xB4\xD8\xAC\xD9\x8A\xD8\xB4\xD9\x85\xD8\xAE\xD8\xB4\xD9\x85\xD9\x85\xD8\xB6\xD8\xAD\xD9\x89\xD8\xB6\xD8\xAE\xD9\x85\xD8\xB7"
+    "\xD9\x85\xD8\xAD\xD8\xB7\xD9\x85\xD9\x85\xD8\xB7\xD9\x85\xD9\x8A\xD8\xB9\xD8\xAC\xD9\x85\xD8\xB9\xD9\x85\xD9\x85\xD8\xB9\xD9\x85"
+    "\xD9\x89\xD8\xBA\xD9\x85\xD9\x85\xD8\xBA\xD9\x85\xD9\x8A\xD8\xBA\xD9\x85\xD9\x89\xD9\x81\xD8\xAE\xD9\x85\xD9\x82\xD9\x85\xD8\xAD"
+    "\xD9\x82\xD9\x85\xD9\x85\xD9\x84\xD8\xAD\xD9\x85\xD9\x84\xD8\xAD\xD9\x8A\xD9\x84\xD8\xAD\xD9\x89\xD9\x84\xD8\xAC\xD8\xAC\xD9\x84"
+    "\xD8\xAE\xD9\x85\xD9\x84\xD9\x85\xD8\xAD\xD9\x85\xD8\xAD\xD8\xAC\xD9\x85\xD8\xAD\xD9\x8A\xD9\x85\xD8\xAC\xD8\xAD\xD9\x85\xD8\xAE"
+    "\xD9\x85\xD9\x85\xD8\xAC\xD8\xAE\xD9\x87\xD9\x85\xD8\xAC\xD9\x87\xD9\x85\xD9\x85\xD9\x86\xD8\xAD\xD9\x85\xD9\x86\xD8\xAD\xD9\x89"
+    "\xD9\x86\xD8\xAC\xD9\x85\xD9\x86\xD8\xAC\xD9\x89\xD9\x86\xD9\x85\xD9\x8A\xD9\x86\xD9\x85\xD9\x89\xD9\x8A\xD9\x85\xD9\x85\xD8\xA8"
+    "\xD8\xAE\xD9\x8A\xD8\xAA\xD8\xAC\xD9\x8A\xD8\xAA\xD8\xAC\xD9\x89\xD8\xAA\xD8\xAE\xD9\x8A\xD8\xAA\xD8\xAE\xD9\x89\xD8\xAA\xD9\x85"
+    "\xD9\x8A\xD8\xAA\xD9\x85\xD9\x89\xD8\xAC\xD9\x85\xD9\x8A\xD8\xAC\xD8\xAD\xD9\x89\xD8\xAC\xD9\x85\xD9\x89\xD8\xB3\xD8\xAE\xD9\x89"
+    "\xD8\xB5\xD8\xAD\xD9\x8A\xD8\xB4\xD8\xAD\xD9\x8A\xD8\xB6\xD8\xAD\xD9\x8A\xD9\x84\xD8\xAC\xD9\x8A\xD9\x84\xD9\x85\xD9\x8A\xD9\x8A"
+    "\xD8\xAC\xD9\x8A\xD9\x8A\xD9\x85\xD9\x8A\xD9\x85\xD9\x85\xD9\x8A\xD9\x82\xD9\x85\xD9\x8A\xD9\x86\xD8\xAD\xD9\x8A\xD8\xB9\xD9\x85"
+    "\xD9\x8A\xD9\x83\xD9\x85\xD9\x8A\xD9\x86\xD8\xAC\xD8\xAD\xD9\x85\xD8\xAE\xD9\x8A\xD9\x84\xD8\xAC\xD9\x85\xD9\x83\xD9\x85\xD9\x85"
+    "\xD8\xAC\xD8\xAD\xD9\x8A\xD8\xAD\xD8\xAC\xD9\x8A\xD9\x85\xD8\xAC\xD9\x8A\xD9\x81\xD9\x85\xD9\x8A\xD8\xA8\xD8\xAD\xD9\x8A\xD8\xB3"
+    "\xD8\xAE\xD9\x8A\xD9\x86\xD8\xAC\xD9\x8A\x2C\xE3\x80\x81\xE3\x80\x82\xE3\x80\x96\xE3\x80\x97\xE2\x80\x94\xE2\x80\x93\x5F\x7B\x7D"
+    "\xE3\x80\x94\xE3\x80\x95\xE3\x80\x90\xE3\x80\x91\xE3\x80\x8A\xE3\x80\x8B\xE3\x80\x8C\xE3\x80\x8D\xE3\x80\x8E\xE3\x80\x8F\x5B\x5D"
+    "\x23\x26\x2A\x2D\x5C\x24\x25\x40\x20\xD9\x8B\xD9\x80\xD9\x8B\xD9\x80\xD9\x91\x20\xD9\x92\xD9\x80\xD9\x92\xD8\xA1\xD8\xA9\xD8\xAF"
+    "\xD9\x84\xD8\xA7\xD9\x93\xD9\x84\xD8\xA7\xD9\x94\xD9\x84\xD8\xA7\xD9\x95\x22\x27\x5E\x7C\x7E\xE2\xA6\x85\xE2\xA6\x86\xE3\x83\xBB"
+    "\xE3\x82\xA1\xE3\x82\xA3\xE3\x82\xA5\xE3\x82\xA7\xE3\x82\xA9\xE3\x83\xA3\xE3\x83\xA5\xE3\x83\xA7\xE3\x83\x83\xE3\x83\xBC\xE3\x82"
+    "\xA2\xE3\x82\xA4\xE3\x82\xA8\xE3\x82\xAA\xE3\x83\x8A\xE3\x83\x8B\xE3\x83\x8C\xE3\x83\x8D\xE3\x83\x8E\xE3\x83\x9E\xE3\x83\x9F\xE3"
+    "\x83\xA0\xE3\x83\xA1\xE3\x83\xA2\xE3\x83\xA4\xE3\x83\xA6\xE3\x83\xA8\xE3\x83\xA9\xE3\x83\xAA\xE3\x83\xAB\xE3\x83\xAC\xE3\x83\xAD"
+    "\xE3\x83\xB3\xC2\xA2\xC2\xA3\xC2\xAC\xC2\xA6\xC2\xA5\xE2\x82\xA9\xE2\x94\x82\xE2\x86\x91\xE2\x86\x93\xE2\x96\xA0\xE2\x97\x8B";
+
+static const fold_entry fold_table[] = {
+    {0x00A0,0,1}, {0x00A8,0,1}, {0x00AA,1,1}, {0x00AF,0,1}, {0x00B2,2,1}, {0x00B3,3,1}, {0x00B4,0,1}, {0x00B5,4,2},
+    {0x00B8,0,1}, {0x00B9,6,1}, {0x00BA,7,1}, {0x00BC,8,5}, {0x00BD,13,5}, {0x00BE,18,5}, {0x00C0,1,1}, {0x00C1,1,1},
+    {0x00C2,1,1}, {0x00C3,1,1}, {0x00C4,1,1}, {0x00C5,1,1}, {0x00C6,23,2}, {0x00C7,25,1}, {0x00C8,24,1}, {0x00C9,24,1},
+    {0x00CA,24,1}, {0x00CB,24,1}, {0x00CC,26,1}, {0x00CD,26,1}, {0x00CE,26,1}, {0x00CF,26,1}, {0x00D0,27,1}, {0x00D1,28,1},
+    {0x00D2,7,1}, {0x00D3,7,1}, {0x00D4,7,1}, {0x00D5,7,1}, {0x00D6,7,1}, {0x00D8,7,1}, {0x00D9,29,1}, {0x00DA,29,1},
+    {0x00DB,29,1}, {0x00DC,29,1}, {0x00DD,30,1}, {0x00DE,31,2}, {0x00DF,33,2}, {0x00E0,1,1}, {0x00E1,1,1}, {0x00E2,1,1},
+    {0x00E3,1,1}, {0x00E4,1,1}, {0x00E5,1,1}, {0x00E6,23,2}, {0x00E7,25,1}, {0x00E8,24,1}, {0x00E9,24,1}, {0x00EA,24,1},
+    {0x00EB,24,1}, {0x00EC,26,1}, {0x00ED,26,1}, {0x00EE,26,1}, {0x00EF,26,1}, {0x00F0,27,1}, {0x00F1,28,1}, {0x00F2,7,1},
+    {0x00F3,7,1}, {0x00F4,7,1}, {0x00F5,7,1}, {0x00F6,7,1}, {0x00F8,7,1}, {0x00F9,29,1}, {0x00FA,29,1}, {0x00FB,29,1},
+    {0x00FC,29,1}, {0x00FD,30,1}, {0x00FE,31,2}, {0x00FF,30,1}, {0x0100,1,1}, {0x0101,1,1}, {0x0102,1,1}, {0x0103,1,1},
+    {0x0104,1,1}, {0x0105,1,1}, {0x0106,25,1}, {0x0107,25,1}, {0x0108,25,1}, {0x0109,25,1}, {0x010A,25,1}, {0x010B,25,1},
+    {0x010C,25,1}, {0x010D,25,1}, {0x010E,27,1}, {0x010F,27,1}, {0x0110,27,1}, {0x0111,27,1}, {0x0112,24,1}, {0x0113,24,1},
+    {0x0114,24,1}, {0x0115,24,1}, {0x0116,24,1}, {0x0117,24,1}, {0x0118,24,1}, {0x0119,24,1}, {0x011A,24,1}, {0x011B,24,1},
+    {0x011C,35,1}, {0x011D,35,1}, {0x011E,35,1}, {0x011F,35,1}, {0x0120,35,1}, {0x0121,35,1}, {0x0122,35,1}, {0x0123,35,1},
+    {0x0124,32,1}, {0x0125,32,1}, {0x0126,32,1}, {0x0127,32,1}, {0x0128,26,1}, {0x0129,26,1}, {0x012A,26,1}, {0x012B,26,1},
+    {0x012C,26,1}, {0x012D,26,1}, {0x012E,26,1}, {0x012F,26,1}, {0x0130,26,1}, {0x0131,26,1}, {0x0132,36,2}, {0x0133,36,2},
+    {0x0134,37,1}, {0x0135,37,1}, {0x0136,38,1}, {0x0137,38,1}, {0x0138,38,1}, {0x0139,39,1}, {0x013A,39,1}, {0x013B,39,1},
+    {0x013C,39,1}, {0x013D,39,1}, {0x013E,39,1}, {0x013F,40,3}, {0x0140,40,3}, {0x0141,39,1}, {0x0142,39,1}, {0x0143,28,1},
+    {0x0144,28,1}, {0x0145,28,1}, {0x0146,28,1}, {0x0147,28,1}, {0x0148,28,1}, {0x0149,43,3}, {0x014A,46,2}, {0x014C,7,1},
+    {0x014D,7,1}, {0x014E,7,1}, {0x014F,7,1}, {0x0150,7,1}, {0x0151,7,1}, {0x0152,48,2}, {0x0153,48,2}, {0x0154,50,1},
+    {0x0155,50,1}, {0x0156,50,1}, {0x0157,50,1}, {0x0158,50,1}, {0x0159,50,1}, {0x015A,33,1}, {0x015B,33,1}, {0x015C,33,1},
+    {0x015D,33,1}, {0x015E,33,1}, {0x015F,33,1}, {0x0160,33,1}, {0x0161,33,1}, {0x0162,31,1}, {0x0163,31,1}, {0x0164,31,1},
+    {0x0165,31,1}, {0x0166,31,1}, {0x0167,31,1}, {0x0168,29,1}, {0x0169,29,1}, {0x016A,29,1}, {0x016B,29,1}, {0x016C,29,1},
+    {0x016D,29,1}, {0x016E,29,1}, {0x016F,29,1}, {0x0170,29,1}, {0x0171,29,1}, {0x0172,29,1}, {0x0173,29,1}, {0x0174,51,1},
+    {0x0175,51,1}, {0x0176,30,1}, {0x0177,30,1}, {0x0178,30,1}, {0x0179,52,1}, {0x017A,52,1}, {0x017B,52,1}, {0x017C,52,1},
+    {0x017D,52,1}, {0x017E,52,1}, {0x017F,33,1}, {0x0180,53,1}, {0x0181,54,2}, {0x0182,56,2}, {0x0184,58,2}, {0x0186,60,2},
+    {0x0187,62,2}, {0x0189,64,2}, {0x018A,66,2}, {0x018B,68,2}, {0x018E,70,2}, {0x018F,72,2}, {0x0190,74,2}, {0x0191,76,2},
+    {0x0193,78,2}, {0x0194,80,2}, {0x0196,82,2}, {0x0197,26,1}, {0x0198,84,2}, {0x019C,86,2}, {0x019D,88,2}, {0x019F,90,2},
+    {0x01A0,7,1}, {0x01A1,7,1}, {0x01A2,92,2}, {0x01A4,94,2}, {0x01A6,96,2}, {0x01A7,98,2}, {0x01A9,100,2}, {0x01AC,102,2},
+    {0x01AE,104,2}, {0x01AF,29,1}, {0x01B0,29,1}, {0x01B1,106,2}, {0x01B2,108,2}, {0x01B3,110,2}, {0x01B5,52,1}, {0x01B6,52,1},
+    {0x01B7,112,2}, {0x01B8,114,2}, {0x01BC,116,2}, {0x01C4,118,2}, {0x01C5,118,2}, {0x01C6,118,2}, {0x01C7,120,2}, {0x01C8,120,2},
+    {0x01C9,120,2}, {0x01CA,122,2}, {0x01CB,122,2}, {0x01CC,122,2}, {0x01CD,1,1}, {0x01CE,1,1}, {0x01CF,26,1}, {0x01D0,26,1},
+    {0x01D1,7,1}, {0x01D2,7,1}, {0x01D3,29,1}, {0x01D4,29,1}, {0x01D5,29,1}, {0x01D6,29,1}, {0x01D7,29,1}, {0x01D8,29,1},
+    {0x01D9,29,1}, {0x01DA,29,1}, {0x01DB,29,1}, {0x01DC,29,1}, {0x01DE,1,1}, {0x01DF,1,1}, {0x01E0,1,1}, {0x01E1,1,1},
+    {0x01E2,23,2}, {0x01E3,23,2}, {0x01E4,35,1}, {0x01E5,35,1}, {0x01E6,35,1}, {0x01E7,35,1}, {0x01E8,38,1}, {0x01E9,38,1},
+    {0x01EA,7,1}, {0x01EB,7,1}, {0x01EC,7,1}, {0x01ED,7,1}, {0x01EE,112,2}, {0x01EF,112,2}, {0x01F0,37,1}, {0x01F1,118,2},
+    {0x01F2,118,2}, {0x01F3,118,2}, {0x01F4,35,1}, {0x01F5,35,1}, {0x01F6,124,2}, {0x01F7,126,2}, {0x01F8,28,1}, {0x01F9,28,1},
+    {0x01FA,1,1}, {0x01FB,1,1}, {0x01FC,23,2}, {0x01FD,23,2}, {0x01FE,7,1}, {0x01FF,7,1}, {0x0200,1,1}, {0x0201,1,1},
+    {0x0202,1,1}, {0x0203,1,1}, {0x0204,24,1}, {0x0205,24,1}, {0x0206,24,1}, {0x0207,24,1}, {0x0208,26,1}, {0x0209,26,1},
+    {0x020A,26,1}, {0x020B,26,1}, {0x020C,7,1}, {0x020D,7,1}, {0x020E,7,1}, {0x020F,7,1}, {0x0210,50,1}, {0x0211,50,1},
+    {0x0212,50,1}, {0x0213,50,1}, {0x0214,29,1}, {0x0215,29,1}, {0x0216,29,1}, {0x0217,29,1}, {0x0218,33,1}, {0x0219,33,1},
+    {0x021A,31,1}, {0x021B,31,1}, {0x021C,128,2}, {0x021E,32,1}, {0x021F,32,1}, {0x0220,130,2}, {0x0222,132,2}, {0x0224,52,1},
+    {0x0225,52,1}, {0x0226,1,1}, {0x0227,1,1}, {0x0228,24,1}, {0x0229,24,1}, {0x022A,7,1}, {0x022B,7,1}, {0x022C,7,1},
+    {0x022D,7,1}, {0x022E,7,1}, {0x022F,7,1}, {0x0230,7,1}, {0x0231,7,1}, {0x0232,30,1}, {0x0233,30,1}, {0x023A,134,3},
+    {0x023B,137,2}, {0x023D,139,2}, {0x023E,141,3}, {0x0241,144,2}, {0x0243,53,1}, {0x0244,29,1}, {0x0245,146,2}, {0x0246,148,2},
+    {0x0248,150,2}, {0x024A,152,2}, {0x024C,50,1}, {0x024D,50,1}, {0x024E,30,1}, {0x024F,30,1}, {0x0268,26,1}, {0x0289,29,1},
+    {0x02B0,32,1}, {0x02B1,154,2}, {0x02B2,37,1}, {0x02B3,50,1}, {0x02B4,156,2}, {0x02B5,158,2}, {0x02B6,160,2}, {0x02B7,51,1},
+    {0x02B8,30,1}, {0x02D8,0,1}, {0x02D9,0,1}, {0x02DA,0,1}, {0x02DB,0,1}, {0x02DC,0,1}, {0x02DD,0,1}, {0x02E0,80,2},
+    {0x02E1,39,1}, {0x02E2,33,1}, {0x02E3,162,1}, {0x02E4,163,2}, {0x0300,165,0}, {0x0301,165,0}, {0x0302,165,0}, {0x0303,165,0},
+    {0x0304,165,0}, {0x0305,165,0}, {0x0306,165,0}, {0x0307,165,0}, {0x0308,165,0}, {0x0309,165,0}, {0x030A,165,0}, {0x030B,165,0},
+    {0x030C,165,0}, {0x030D,165,0}, {0x030E,165,0}, {0x030F,165,0}, {0x0310,165,0}, {0x0311,165,0}, {0x0312,165,0}, {0x0313,165,0},
+    {0x0314,165,0}, {0x0315,165,0}, {0x0316,165,0}, {0x0317,165,0}, {0x0318,165,0}, {0x0319,165,0}, {0x031A,165,0}, {0x031B,165,0},
+    {0x031C,165,0}, {0x031D,165,0}, {0x031E,165,0}, {0x031F,165,0}, {0x0320,165,0}, {0x0321,165,0}, {0x0322,165,0}, {0x0323,165,0},
+    {0x0324,165,0}, {0x0325,165,0}, {0x0326,165,0}, {0x0327,165,0}, {0x0328,165,0}, {0x0329,165,0}, {0x032A,165,0}, {0x032B,165,0},
+    {0x032C,165,0}, {0x032D,165,0}, {0x032E,165,0}, {0x032F,165,0}, {0x0330,165,0}, {0x0331,165,0}, {0x0332,165,0}, {0x0333,165,0},
+    {0x0334,165,0}, {0x0335,165,0}, {0x0336,165,0}, {0x0337,165,0}, {0x0338,165,0}, {0x0339,165,0}, {0x033A,165,0}, {0x033B,165,0},
+    {0x033C,165,0}, {0x033D,165,0}, {0x033E,165,0}, {0x033F,165,0}, {0x0340,165,0}, {0x0341,165,0}, {0x0342,165,0}, {0x0343,165,0},
+    {0x0344,165,0}, {0x0345,165,0}, {0x0346,165,0}, {0x0347,165,0}, {0x0348,165,0}, {0x0349,165,0}, {0x034A,165,0}, {0x034B,165,0},
+    {0x034C,165,0}, {0x034D,165,0}, {0x034E,165,0}, {0x034F,165,0}, {0x0350,165,0}, {0x0351,165,0}, {0x0352,165,0}, {0x0353,165,0},
+    {0x0354,165,0}, {0x0355,165,0}, {0x0356,165,0}, {0x0357,165,0}, {0x0358,165,0}, {0x0359,165,0}, {0x035A,165,0}, {0x035B,165,0},
+    {0x035C,165,0}, {0x035D,165,0}, {0x035E,165,0}, {0x035F,165,0}, {0x0360,165,0}, {0x0361,165,0}, {0x0362,165,0}, {0x0363,165,0},
+    {0x0364,165,0}, {0x0365,165,0}, {0x0366,165,0}, {0x0367,165,0}, {0x0368,165,0}, {0x0369,165,0}, {0x036A,165,0}, {0x036B,165,0},
+    {0x036C,165,0}, {0x036D,165,0}, {0x036E,165,0}, {0x036F,165,0}, {0x0370,165,2}, {0x0372,167,2}, {0x0374,169,2}, {0x0376,171,2},
+    {0x037A,0,1}, {0x037E,173,1}, {0x037F,174,2}, {0x0384,0,1}, {0x0385,0,1}, {0x0386,176,2}, {0x0387,41,2}, {0x0388,178,2},
+    {0x0389,180,2}, {0x038A,182,2}, {0x038C,184,2}, {0x038E,186,2}, {0x038F,188,2}, {0x0390,182,2}, {0x0391,176,2}, {0x0392,190,2},
+    {0x0393,192,2}, {0x0394,194,2}, {0x0395,178,2}, {0x0396,196,2}, {0x0397,180,2}, {0x0398,198,2}, {0x0399,182,2}, {0x039A,200,2},
+    {0x039B,202,2}, {0x039C,4,2}, {0x039D,204,2}, {0x039E,206,2}, {0x039F,184,2}, {0x03A0,208,2}, {0x03A1,210,2}, {0x03A3,212,2},
+    {0x03A4,214,2}, {0x03A5,186,2}, {0x03A6,216,2}, {0x03A7,218,2}, {0x03A8,220,2}, {0x03A9,188,2}, {0x03AA,182,2}, {0x03AB,186,2},
+    {0x03AC,176,2}, {0x03AD,178,2}, {0x03AE,180,2}, {0x03AF,182,2}, {0x03B0,186,2}, {0x03C2,212,2}, {0x03CA,182,2}, {0x03CB,186,2},
+    {0x03CC,184,2}, {0x03CD,186,2}, {0x03CE,188,2}, {0x03CF,222,2}, {0x03D0,190,2}, {0x03D1,198,2}, {0x03D2,186,2}, {0x03D3,186,2},
+    {0x03D4,186,2}, {0x03D5,216,2}, {0x03D6,208,2}, {0x03D8,224,2}, {0x03DA,226,2}, {0x03DC,228,2}, {0x03DE,230,2}, {0x03E0,232,2},
+    {0x03E2,234,2}, {0x03E4,236,2}, {0x03E6,238,2}, {0x03E8,240,2}, {0x03EA,242,2}, {0x03EC,244,2}, {0x03EE,246,2}, {0x03F0,200,2},
+    {0x03F1,210,2}, {0x03F2,212,2}, {0x03F4,198,2}, {0x03F5,178,2}, {0x03F7,248,2}, {0x03F9,212,2}, {0x03FA,250,2}, {0x03FD,252,2},
+    {0x03FE,254,2}, {0x03FF,256,2}, {0x0400,258,2}, {0x0401,258,2}, {0x0402,260,2}, {0x0403,262,2}, {0x0404,264,2}, {0x0405,266,2},
+    {0x0406,268,2}, {0x0407,268,2}, {0x0408,270,2}, {0x0409,272,2}, {0x040A,274,2}, {0x040B,276,2}, {0x040C,278,2}, {0x040D,280,2},
+    {0x040E,282,2}, {0x040F,284,2}, {0x0410,286,2}, {0x0411,288,2}, {0x0412,290,2}, {0x0413,262,2}, {0x0414,292,2}, {0x0415,258,2},
+    {0x0416,294,2}, {0x0417,296,2}, {0x0418,280,2}, {0x0419,298,2}, {0x041A,278,2}, {0x041B,300,2}, {0x041C,302,2}, {0x041D,304,2},
+    {0x041E,306,2}, {0x041F,308,2}, {0x0420,310,2}, {0x0421,312,2}, {0x0422,314,2}, {0x0423,282,2}, {0x0424,316,2}, {0x0425,318,2},
+    {0x0426,320,2}, {0x0427,322,2}, {0x0428,324,2}, {0x0429,326,2}, {0x042A,328,2}, {0x042B,330,2}, {0x042C,332,2}, {0x042D,334,2},
+    {0x042E,336,2}, {0x042F,338,2}, {0x0450,258,2}, {0x0451,258,2}, {0x0453,262,2}, {0x0457,268,2}, {0x045C,278,2}, {0x045D,280,2},
+    {0x045E,282,2}, {0x0460,340,2}, {0x0462,342,2}, {0x0464,344,2}, {0x0466,346,2}, {0x0468,348,2}, {0x046A,350,2}, {0x046C,352,2},
+    {0x046E,354,2}, {0x0470,356,2}, {0x0472,358,2}, {0x0474,360,2}, {0x0476,360,2}, {0x0477,360,2}, {0x0478,362,2}, {0x047A,364,2},
+    {0x047C,366,2}, {0x047E,368,2}, {0x0480,370,2}, {0x048A,372,2}, {0x048C,374,2}, {0x048E,376,2}, {0x0490,378,2}, {0x0492,380,2},
+    {0x0494,382,2}, {0x0496,384,2}, {0x0498,386,2}, {0x049A,388,2}, {0x049C,390,2}, {0x049E,392,2}, {0x04A0,394,2}, {0x04A2,396,2},
+    {0x04A4,398,2}, {0x04A6,400,2}, {0x04A8,402,2}, {0x04AA,404,2}, {0x04AC,406,2}, {0x04AE,408,2}, {0x04B0,410,2}, {0x04B2,412,2},
+    {0x04B4,414,2}, {0x04B6,416,2}, {0x04B8,418,2}, {0x04BA,420,2}, {0x04BC,422,2}, {0x04BE,424,2}, {0x04C0,426,2}, {0x04C1,294,2},
+    {0x04C2,294,2}, {0x04C3,428,2}, {0x04C5,430,2}, {0x04C7,432,2}, {0x04C9,434,2}, {0x04CB,436,2}, {0x04CD,438,2}, {0x04D0,286,2},
+    {0x04D1,286,2}, {0x04D2,286,2}, {0x04D3,286,2}, {0x04D4,440,2}, {0x04D6,258,2}, {0x04D7,258,2}, {0x04D8,442,2}, {0x04DA,442,2},
+    {0x04DB,442,2}, {0x04DC,294,2}, {0x04DD,294,2}, {0x04DE,296,2}, {0x04DF,296,2}, {0x04E0,444,2}, {0x04E2,280,2}, {0x04E3,280,2},
+    {0x04E4,280,2}, {0x04E5,280,2}, {0x04E6,306,2}, {0x04E7,306,2}, {0x04E8,446,2}, {0x04EA,446,2}, {0x04EB,446,2}, {0x04EC,334,2},
+    {0x04ED,334,2}, {0x04EE,282,2}, {0x04EF,282,2}, {0x04F0,282,2}, {0x04F1,282,2}, {0x04F2,282,2}, {0x04F3,282,2}, {0x04F4,322,2},
+    {0x04F5,322,2}, {0x04F6,448,2}, {0x04F8,330,2}, {0x04F9,330,2}, {0x04FA,450,2}, {0x04FC,452,2}, {0x04FE,454,2}, {0x0500,456,2},
+    {0x0502,458,2}, {0x0504,460,2}, {0x0506,462,2}, {0x0508,464,2}, {0x050A,466,2}, {0x050C,468,2}, {0x050E,470,2}, {0x0510,472,2},
+    {0x0512,474,2}, {0x0514,476,2}, {0x0516,478,2}, {0x0518,480,2}, {0x051A,482,2}, {0x051C,484,2}, {0x051E,486,2}, {0x0520,488,2},
+    {0x0522,490,2}, {0x0524,492,2}, {0x0526,494,2}, {0x0528,496,2}, {0x052A,498,2}, {0x052C,500,2}, {0x052E,502,2}, {0x0531,504,2},
+    {0x0532,506,2}, {0x0533,508,2}, {0x0534,510,2}, {0x0535,512,2}, {0x0536,514,2}, {0x0537,516,2}, {0x0538,518,2}, {0x0539,520,2},
+    {0x053A,522,2}, {0x053B,524,2}, {0x053C,526,2}, {0x053D,528,2}, {0x053E,530,2}, {0x053F,532,2}, {0x0540,534,2}, {0x0541,536,2},
+    {0x0542,538,2}, {0x0543,540,2}, {0x0544,542,2}, {0x0545,544,2}, {0x0546,546,2}, {0x0547,548,2}, {0x0548,550,2}, {0x0549,552,2},
+    {0x054A,554,2}, {0x054B,556,2}, {0x054C,558,2}, {0x054D,560,2}, {0x054E,562,2}, {0x054F,564,2}, {0x0550,566,2}, {0x0551,568,2},
+    {0x0552,570,2}, {0x0553,572,2}, {0x0554,574,2}, {0x0555,576,2}, {0x0556,578,2}, {0x0587,580,4}, {0x0622,584,4}, {0x0623,588,4},
+    {0x0624,592,4}, {0x0625,596,4}, {0x0626,600,4}, {0x0675,604,4}, {0x0676,608,4}, {0x0677,612,4}, {0x0678,616,4}, {0x06C0,620,4},
+    {0x06C2,624,4}, {0x06D3,628,4}, {0x0929,632,6}, {0x0931,638,6}, {0x0934,644,6}, {0x0958,650,6}, {0x0959,656,6}, {0x095A,662,6},
+    {0x095B,668,6}, {0x095C,674,6}, {0x095D,680,6}, {0x095E,686,6}, {0x095F,692,6}, {0x09CB,698,6}, {0x09CC,704,6}, {0x09DC,710,6},
+    {0x09DD,716,6}, {0x09DF,722,6}, {0x0A33,728,6}, {0x0A36,734,6}, {0x0A59,740,6}, {0x0A5A,746,6}, {0x0A5B,752,6}, {0x0A5E,758,6},
+    {0x0B48,764,6}, {0x0B4B,770,6}, {0x0B4C,776,6}, {0x0B5C,782,6}, {0x0B5D,788,6}, {0x0B94,794,6}, {0x0BCA,800,6}, {0x0BCB,806,6},
+    {0x0BCC,812,6}, {0x0C48,818,6}, {0x0CC0,824,6}, {0x0CC7,830,6}, {0x0CC8,836,6}, {0x0CCA,842,6}, {0x0CCB,848,9}, {0x0D4A,857,6},
+    {0x0D4B,863,6}, {0x0D4C,869,6}, {0x0DDA,875,6}, {0x0DDC,881,6}, {0x0DDD,887,9}, {0x0DDE,896,6}, {0x0E33,902,6}, {0x0EB3,908,6},
+    {0x0EDC,914,6}, {0x0EDD,920,6}, {0x0F0C,926,3}, {0x0F43,929,6}, {0x0F4D,935,6}, {0x0F52,941,6}, {0x0F57,947,6}, {0x0F5C,953,6},
+    {0x0F69,959,6}, {0x0F73,965,6}, {0x0F75,971,6}, {0x0F76,977,6}, {0x0F77,983,9}, {0x0F78,992,6}, {0x0F79,998,9}, {0x0F81,986,6},
+    {0x0F93,1007,6}, {0x0F9D,1013,6}, {0x0FA2,1019,6}, {0x0FA7,1025,6}, {0x0FAC,1031,6}, {0x0FB9,1037,6}, {0x1026,1043,6}, {0x10A0,1049,3},
+    {0x10A1,1052,3}, {0x10A2,1055,3}, {0x10A3,1058,3}, {0x10A4,1061,3}, {0x10A5,1064,3}, {0x10A6,1067,3}, {0x10A7,1070,3}, {0x10A8,1073,3},
+    {0x10A9,1076,3}, {0x10AA,1079,3}, {0x10AB,1082,3}, {0x10AC,1085,3}, {0x10AD,1088,3}, {0x10AE,1091,3}, {0x10AF,1094,3}, {0x10B0,1097,3},
+    {0x10B1,1100,3}, {0x10B2,1103,3}, {0x10B3,1106,3}, {0x10B4,1109,3}, {0x10B5,1112,3}, {0x10B6,1115,3}, {0x10B7,1118,3}, {0x10B8,1121,3},
+    {0x10B9,1124,3}, {0x10BA,1127,3}, {0x10BB,1130,3}, {0x10BC,1133,3}, {0x10BD,1136,3}, {0x10BE,1139,3}, {0x10BF,1142,3}, {0x10C0,1145,3},
+    {0x10C1,1148,3}, {0x10C2,1151,3}, {0x10C3,1154,3}, {0x10C4,1157,3}, {0x10C5,1160,3}, {0x10C7,1163,3}, {0x10CD,1166,3}, {0x10FC,1169,3},
+    {0x13F8,1172,3}, {0x13F9,1175,3}, {0x13FA,1178,3}, {0x13FB,1181,3}, {0x13FC,1184,3}, {0x13FD,1187,3}, {0x1AB0,165,0}, {0x1AB1,165,0},
+    {0x1AB2,165,0}, {0x1AB3,165,0}, {0x1AB4,165,0}, {0x1AB5,165,0}, {0x1AB6,165,0}, {0x1AB7,165,0}, {0x1AB8,165,0}, {0x1AB9,165,0},
+    {0x1ABA,165,0}, {0x1ABB,165,0}, {0x1ABC,165,0}, {0x1ABD,165,0}, {0x1ABE,165,0}, {0x1ABF,165,0}, {0x1AC0,165,0}, {0x1AC1,165,0},
+    {0x1AC2,165,0}, {0x1AC3,165,0}, {0x1AC4,165,0}, {0x1AC5,165,0}, {0x1AC6,165,0}, {0x1AC7,165,0}, {0x1AC8,165,0}, {0x1AC9,165,0},
+    {0x1ACA,165,0}, {0x1ACB,165,0}, {0x1ACC,165,0}, {0x1ACD,165,0}, {0x1ACE,165,0}, {0x1B06,1190,6}, {0x1B08,1196,6}, {0x1B0A,1202,6},
+    {0x1B0C,1208,6}, {0x1B0E,1214,6}, {0x1B12,1220,6}, {0x1B3B,1226,6}, {0x1B3D,1232,6}, {0x1B40,1238,6}, {0x1B41,1244,6}, {0x1B43,1250,6},
+    {0x1C80,290,2}, {0x1C81,292,2}, {0x1C82,306,2}, {0x1C83,312,2}, {0x1C84,314,2}, {0x1C85,314,2}, {0x1C86,328,2}, {0x1C87,342,2},
+    {0x1C88,1256,3}, {0x1C90,1259,3}, {0x1C91,1262,3}, {0x1C92,1265,3}, {0x1C93,1268,3}, {0x1C94,1271,3}, {0x1C95,1274,3}, {0x1C96,1277,3},
+    {0x1C97,1280,3}, {0x1C98,1283,3}, {0x1C99,1286,3}, {0x1C9A,1289,3}, {0x1C9B,1292,3}, {0x1C9C,1169,3}, {0x1C9D,1295,3}, {0x1C9E,1298,3},
+    {0x1C9F,1301,3}, {0x1CA0,1304,3}, {0x1CA1,1307,3}, {0x1CA2,1310,3}, {0x1CA3,1313,3}, {0x1CA4,1316,3}, {0x1CA5,1319,3}, {0x1CA6,1322,3},
+    {0x1CA7,1325,3}, {0x1CA8,1328,3}, {0x1CA9,1331,3}, {0x1CAA,1334,3}, {0x1CAB,1337,3}, {0x1CAC,1340,3}, {0x1CAD,1343,3}, {0x1CAE,1346,3},
+    {0x1CAF,1349,3}, {0x1CB0,1352,3}, {0x1CB1,1355,3}, {0x1CB2,1358,3}, {0x1CB3,1361,3}, {0x1CB4,1364,3}, {0x1CB5,1367,3}, {0x1CB6,1370,3},
+    {0x1CB7,1373,3}, {0x1CB8,1376,3}, {0x1CB9,1379,3}, {0x1CBA,1382,3}, {0x1CBD,1385,3}, {0x1CBE,1388,3}, {0x1CBF,1391,3}, {0x1D2C,1,1},
+    {0x1D2D,23,2}, {0x1D2E,53,1}, {0x1D30,27,1}, {0x1D31,24,1}, {0x1D32,70,2}, {0x1D33,35,1}, {0x1D34,32,1}, {0x1D35,26,1},
+    {0x1D36,37,1}, {0x1D37,38,1}, {0x1D38,39,1}, {0x1D39,1394,1}, {0x1D3A,28,1}, {0x1D3C,7,1}, {0x1D3D,132,2}, {0x1D3E,1395,1},
+    {0x1D3F,50,1}, {0x1D40,31,1}, {0x1D41,29,1}, {0x1D42,51,1}, {0x1D43,1,1}, {0x1D44,1396,2}, {0x1D45,1398,2}, {0x1D46,1400,3},
+    {0x1D47,53,1}, {0x1D48,27,1}, {0x1D49,24,1}, {0x1D4A,72,2}, {0x1D4B,74,2}, {0x1D4C,1403,2}, {0x1D4D,35,1}, {0x1D4F,38,1},
+    {0x1D50,1394,1}, {0x1D51,46,2}, {0x1D52,7,1}, {0x1D53,60,2}, {0x1D54,1405,3}, {0x1D55,1408,3}, {0x1D56,1395,1}, {0x1D57,31,1},
+    {0x1D58,29,1}, {0x1D59,1411,3}, {0x1D5A,86,2}, {0x1D5B,1414,1}, {0x1D5C,1415,3}, {0x1D5D,190,2}, {0x1D5E,192,2}, {0x1D5F,194,2},
+    {0x1D60,216,2}, {0x1D61,218,2}, {0x1D62,26,1}, {0x1D63,50,1}, {0x1D64,29,1}, {0x1D65,1414,1}, {0x1D66,190,2}, {0x1D67,192,2},
+    {0x1D68,210,2}, {0x1D69,216,2}, {0x1D6A,218,2}, {0x1D78,304,2}, {0x1D9B,1418,2}, {0x1D9C,25,1}, {0x1D9D,1420,2}, {0x1D9E,27,1},
+    {0x1D9F,1403,2}, {0x1DA0,1422,1}, {0x1DA1,1423,2}, {0x1DA2,1425,2}, {0x1DA3,1427,2}, {0x1DA4,26,1}, {0x1DA5,82,2}, {0x1DA6,1429,2},
+    {0x1DA7,1431,3}, {0x1DA8,1434,2}, {0x1DA9,1436,2}, {0x1DAA,1438,3}, {0x1DAB,1441,2}, {0x1DAC,1443,2}, {0x1DAD,1445,2}, {0x1DAE,88,2},
+    {0x1DAF,1447,2}, {0x1DB0,1449,2}, {0x1DB1,90,2}, {0x1DB2,1451,2}, {0x1DB3,1453,2}, {0x1DB4,100,2}, {0x1DB5,1455,2}, {0x1DB6,29,1},
+    {0x1DB7,106,2}, {0x1DB8,1457,3}, {0x1DB9,108,2}, {0x1DBA,146,2}, {0x1DBB,52,1}, {0x1DBC,1460,2}, {0x1DBD,1462,2}, {0x1DBE,112,2},
+    {0x1DBF,198,2}, {0x1DC0,165,0}, {0x1DC1,165,0}, {0x1DC2,165,0}, {0x1DC3,165,0}, {0x1DC4,165,0}, {0x1DC5,165,0}, {0x1DC6,165,0},
+    {0x1DC7,165,0}, {0x1DC8,165,0}, {0x1DC9,165,0}, {0x1DCA,165,0}, {0x1DCB,165,0}, {0x1DCC,165,0}, {0x1DCD,165,0}, {0x1DCE,165,0},
+    {0x1DCF,165,0}, {0x1DD0,165,0}, {0x1DD1,165,0}, {0x1DD2,165,0}, {0x1DD3,165,0}, {0x1DD4,165,0}, {0x1DD5,165,0}, {0x1DD6,165,0},
+    {0x1DD7,165,0}, {0x1DD8,165,0}, {0x1DD9,165,0}, {0x1DDA,165,0}, {0x1DDB,165,0}, {0x1DDC,165,0}, {0x1DDD,165,0}, {0x1DDE,165,0},
+    {0x1DDF,165,0}, {0x1DE0,165,0}, {0x1DE1,165,0}, {0x1DE2,165,0}, {0x1DE3,165,0}, {0x1DE4,165,0}, {0x1DE5,165,0}, {0x1DE6,165,0},
+    {0x1DE7,165,0}, {0x1DE8,165,0}, {0x1DE9,165,0}, {0x1DEA,165,0}, {0x1DEB,165,0}, {0x1DEC,165,0}, {0x1DED,165,0}, {0x1DEE,165,0},
+    {0x1DEF,165,0}, {0x1DF0,165,0}, {0x1DF1,165,0}, {0x1DF2,165,0}, {0x1DF3,165,0}, {0x1DF4,165,0}, {0x1DF5,165,0}, {0x1DF6,165,0},
+    {0x1DF7,165,0}, {0x1DF8,165,0}, {0x1DF9,165,0}, {0x1DFA,165,0}, {0x1DFB,165,0}, {0x1DFC,165,0}, {0x1DFD,165,0}, {0x1DFE,165,0},
+    {0x1DFF,165,0}, {0x1E00,1,1}, {0x1E01,1,1}, {0x1E02,53,1}, {0x1E03,53,1}, {0x1E04,53,1}, {0x1E05,53,1}, {0x1E06,53,1},
+    {0x1E07,53,1}, {0x1E08,25,1}, {0x1E09,25,1}, {0x1E0A,27,1}, {0x1E0B,27,1}, {0x1E0C,27,1}, {0x1E0D,27,1}, {0x1E0E,27,1},
+    {0x1E0F,27,1}, {0x1E10,27,1}, {0x1E11,27,1}, {0x1E12,27,1}, {0x1E13,27,1}, {0x1E14,24,1}, {0x1E15,24,1}, {0x1E16,24,1},
+    {0x1E17,24,1}, {0x1E18,24,1}, {0x1E19,24,1}, {0x1E1A,24,1}, {0x1E1B,24,1}, {0x1E1C,24,1}, {0x1E1D,24,1}, {0x1E1E,1422,1},
+    {0x1E1F,1422,1}, {0x1E20,35,1}, {0x1E21,35,1}, {0x1E22,32,1}, {0x1E23,32,1}, {0x1E24,32,1}, {0x1E25,32,1}, {0x1E26,32,1},
+    {0x1E27,32,1}, {0x1E28,32,1}, {0x1E29,32,1}, {0x1E2A,32,1}, {0x1E2B,32,1}, {0x1E2C,26,1}, {0x1E2D,26,1}, {0x1E2E,26,1},
+    {0x1E2F,26,1}, {0x1E30,38,1}, {0x1E31,38,1}, {0x1E32,38,1}, {0x1E33,38,1}, {0x1E34,38,1}, {0x1E35,38,1}, {0x1E36,39,1},
+    {0x1E37,39,1}, {0x1E38,39,1}, {0x1E39,39,1}, {0x1E3A,39,1}, {0x1E3B,39,1}, {0x1E3C,39,1}, {0x1E3D,39,1}, {0x1E3E,1394,1},
+    {0x1E3F,1394,1}, {0x1E40,1394,1}, {0x1E41,1394,1}, {0x1E42,1394,1}, {0x1E43,1394,1}, {0x1E44,28,1}, {0x1E45,28,1}, {0x1E46,28,1},
+    {0x1E47,28,1}, {0x1E48,28,1}, {0x1E49,28,1}, {0x1E4A,28,1}, {0x1E4B,28,1}, {0x1E4C,7,1}, {0x1E4D,7,1}, {0x1E4E,7,1},
+    {0x1E4F,7,1}, {0x1E50,7,1}, {0x1E51,7,1}, {0x1E52,7,1}, {0x1E53,7,1}, {0x1E54,1395,1}, {0x1E55,1395,1}, {0x1E56,1395,1},
+    {0x1E57,1395,1}, {0x1E58,50,1}, {0x1E59,50,1}, {0x1E5A,50,1}, {0x1E5B,50,1}, {0x1E5C,50,1}, {0x1E5D,50,1}, {0x1E5E,50,1},
+    {0x1E5F,50,1}, {0x1E60,33,1}, {0x1E61,33,1}, {0x1E62,33,1}, {0x1E63,33,1}, {0x1E64,33,1}, {0x1E65,33,1}, {0x1E66,33,1},
+    {0x1E67,33,1}, {0x1E68,33,1}, {0x1E69,33,1}, {0x1E6A,31,1}, {0x1E6B,31,1}, {0x1E6C,31,1}, {0x1E6D,31,1}, {0x1E6E,31,1},
+    {0x1E6F,31,1}, {0x1E70,31,1}, {0x1E71,31,1}, {0x1E72,29,1}, {0x1E73,29,1}, {0x1E74,29,1}, {0x1E75,29,1}, {0x1E76,29,1},
+    {0x1E77,29,1}, {0x1E78,29,1}, {0x1E79,29,1}, {0x1E7A,29,1}, {0x1E7B,29,1}, {0x1E7C,1414,1}, {0x1E7D,1414,1}, {0x1E7E,1414,1},
+    {0x1E7F,1414,1}, {0x1E80,51,1}, {0x1E81,51,1}, {0x1E82,51,1}, {0x1E83,51,1}, {0x1E84,51,1}, {0x1E85,51,1}, {0x1E86,51,1},
+    {0x1E87,51,1}, {0x1E88,51,1}, {0x1E89,51,1}, {0x1E8A,162,1}, {0x1E8B,162,1}, {0x1E8C,162,1}, {0x1E8D,162,1}, {0x1E8E,30,1},
+    {0x1E8F,30,1}, {0x1E90,52,1}, {0x1E91,52,1}, {0x1E92,52,1}, {0x1E93,52,1}, {0x1E94,52,1}, {0x1E95,52,1}, {0x1E96,32,1},
+    {0x1E97,31,1}, {0x1E98,51,1}, {0x1E99,30,1}, {0x1E9A,1464,3}, {0x1E9B,33,1}, {0x1E9E,33,2}, {0x1EA0,1,1}, {0x1EA1,1,1},
+    {0x1EA2,1,1}, {0x1EA3,1,1}, {0x1EA4,1,1}, {0x1EA5,1,1}, {0x1EA6,1,1}, {0x1EA7,1,1}, {0x1EA8,1,1}, {0x1EA9,1,1},
+    {0x1EAA,1,1}, {0x1EAB,1,1}, {0x1EAC,1,1}, {0x1EAD,1,1}, {0x1EAE,1,1}, {0x1EAF,1,1}, {0x1EB0,1,1}, {0x1EB1,1,1},
+    {0x1EB2,1,1}, {0x1EB3,1,1}, {0x1EB4,1,1}, {0x1EB5,1,1}, {0x1EB6,1,1}, {0x1EB7,1,1}, {0x1EB8,24,1}, {0x1EB9,24,1},
+    {0x1EBA,24,1}, {0x1EBB,24,1}, {0x1EBC,24,1}, {0x1EBD,24,1}, {0x1EBE,24,1}, {0x1EBF,24,1}, {0x1EC0,24,1}, {0x1EC1,24,1},
+    {0x1EC2,24,1}, {0x1EC3,24,1}, {0x1EC4,24,1}, {0x1EC5,24,1}, {0x1EC6,24,1}, {0x1EC7,24,1}, {0x1EC8,26,1}, {0x1EC9,26,1},
+    {0x1ECA,26,1}, {0x1ECB,26,1}, {0x1ECC,7,1}, {0x1ECD,7,1}, {0x1ECE,7,1}, {0x1ECF,7,1}, {0x1ED0,7,1}, {0x1ED1,7,1},
+    {0x1ED2,7,1}, {0x1ED3,7,1}, {0x1ED4,7,1}, {0x1ED5,7,1}, {0x1ED6,7,1}, {0x1ED7,7,1}, {0x1ED8,7,1}, {0x1ED9,7,1},
+    {0x1EDA,7,1}, {0x1EDB,7,1}, {0x1EDC,7,1}, {0x1EDD,7,1}, {0x1EDE,7,1}, {0x1EDF,7,1}, {0x1EE0,7,1}, {0x1EE1,7,1},
+    {0x1EE2,7,1}, {0x1EE3,7,1}, {0x1EE4,29,1}, {0x1EE5,29,1}, {0x1EE6,29,1}, {0x1EE7,29,1}, {0x1EE8,29,1}, {0x1EE9,29,1},
+    {0x1EEA,29,1}, {0x1EEB,29,1}, {0x1EEC,29,1}, {0x1EED,29,1}, {0x1EEE,29,1}, {0x1EEF,29,1}, {0x1EF0,29,1}, {0x1EF1,29,1},
+    {0x1EF2,30,1}, {0x1EF3,30,1}, {0x1EF4,30,1}, {0x1EF5,30,1}, {0x1EF6,30,1}, {0x1EF7,30,1}, {0x1EF8,30,1}, {0x1EF9,30,1},
+    {0x1EFA,1467,3}, {0x1EFC,1470,3}, {0x1EFE,1473,3}, {0x1F00,176,2}, {0x1F01,176,2}, {0x1F02,176,2}, {0x1F03,176,2}, {0x1F04,176,2},
+    {0x1F05,176,2}, {0x1F06,176,2}, {0x1F07,176,2}, {0x1F08,176,2}, {0x1F09,176,2}, {0x1F0A,176,2}, {0x1F0B,176,2}, {0x1F0C,176,2},
+    {0x1F0D,176,2}, {0x1F0E,176,2}, {0x1F0F,176,2}, {0x1F10,178,2}, {0x1F11,178,2}, {0x1F12,178,2}, {0x1F13,178,2}, {0x1F14,178,2},
+    {0x1F15,178,2}, {0x1F18,178,2}, {0x1F19,178,2}, {0x1F1A,178,2}, {0x1F1B,178,2}, {0x1F1C,178,2}, {0x1F1D,178,2}, {0x1F20,180,2},
+    {0x1F21,180,2}, {0x1F22,180,2}, {0x1F23,180,2}, {0x1F24,180,2}, {0x1F25,180,2}, {0x1F26,180,2}, {0x1F27,180,2}, {0x1F28,180,2},
+    {0x1F29,180,2}, {0x1F2A,180,2}, {0x1F2B,180,2}, {0x1F2C,180,2}, {0x1F2D,180,2}, {0x1F2E,180,2}, {0x1F2F,180,2}, {0x1F30,182,2},
+    {0x1F31,182,2}, {0x1F32,182,2}, {0x1F33,182,2}, {0x1F34,182,2}, {0x1F35,182,2}, {0x1F36,182,2}, {0x1F37,182,2}, {0x1F38,182,2},
+    {0x1F39,182,2}, {0x1F3A,182,2}, {0x1F3B,182,2}, {0x1F3C,182,2}, {0x1F3D,182,2}, {0x1F3E,182,2}, {0x1F3F,182,2}, {0x1F40,184,2},
+    {0x1F41,184,2}, {0x1F42,184,2}, {0x1F43,184,2}, {0x1F44,184,2}, {0x1F45,184,2}, {0x1F48,184,2}, {0x1F49,184,2}, {0x1F4A,184,2},
+    {0x1F4B,184,2}, {0x1F4C,184,2}, {0x1F4D,184,2}, {0x1F50,186,2}, {0x1F51,186,2}, {0x1F52,186,2}, {0x1F53,186,2}, {0x1F54,186,2},
+    {0x1F55,186,2}, {0x1F56,186,2}, {0x1F57,186,2}, {0x1F59,186,2}, {0x1F5B,186,2}, {0x1F5D,186,2}, {0x1F5F,186,2}, {0x1F60,188,2},
+    {0x1F61,188,2}, {0x1F62,188,2}, {0x1F63,188,2}, {0x1F64,188,2}, {0x1F65,188,2}, {0x1F66,188,2}, {0x1F67,188,2}, {0x1F68,188,2},
+    {0x1F69,188,2}, {0x1F6A,188,2}, {0x1F6B,188,2}, {0x1F6C,188,2}, {0x1F6D,188,2}, {0x1F6E,188,2}, {0x1F6F,188,2}, {0x1F70,176,2},
+    {0x1F71,176,2}, {0x1F72,178,2}, {0x1F73,178,2}, {0x1F74,180,2}, {0x1F75,180,2}, {0x1F76,182,2}, {0x1F77,182,2}, {0x1F78,184,2},
+    {0x1F79,184,2}, {0x1F7A,186,2}, {0x1F7B,186,2}, {0x1F7C,188,2}, {0x1F7D,188,2}, {0x1F80,176,2}, {0x1F81,176,2}, {0x1F82,176,2},
+    {0x1F83,176,2}, {0x1F84,176,2}, {0x1F85,176,2}, {0x1F86,176,2}, {0x1F87,176,2}, {0x1F88,176,2}, {0x1F89,176,2}, {0x1F8A,176,2},
+    {0x1F8B,176,2}, {0x1F8C,176,2}, {0x1F8D,176,2}, {0x1F8E,176,2}, {0x1F8F,176,2}, {0x1F90,180,2}, {0x1F91,180,2}, {0x1F92,180,2},
+    {0x1F93,180,2}, {0x1F94,180,2}, {0x1F95,180,2}, {0x1F96,180,2}, {0x1F97,180,2}, {0x1F98,180,2}, {0x1F99,180,2}, {0x1F9A,180,2},
+    {0x1F9B,180,2}, {0x1F9C,180,2}, {0x1F9D,180,2}, {0x1F9E,180,2}, {0x1F9F,180,2}, {0x1FA0,188,2}, {0x1FA1,188,2}, {0x1FA2,188,2},
+    {0x1FA3,188,2}, {0x1FA4,188,2}, {0x1FA5,188,2}, {0x1FA6,188,2}, {0x1FA7,188,2}, {0x1FA8,188,2}, {0x1FA9,188,2}, {0x1FAA,188,2},
+    {0x1FAB,188,2}, {0x1FAC,188,2}, {0x1FAD,188,2}, {0x1FAE,188,2}, {0x1FAF,188,2}, {0x1FB0,176,2}, {0x1FB1,176,2}, {0x1FB2,176,2},
+    {0x1FB3,176,2}, {0x1FB4,176,2}, {0x1FB6,176,2}, {0x1FB7,176,2}, {0x1FB8,176,2}, {0x1FB9,176,2}, {0x1FBA,176,2}, {0x1FBB,176,2},
+    {0x1FBC,176,2}, {0x1FBD,0,1}, {0x1FBE,182,2}, {0x1FBF,0,1}, {0x1FC0,0,1}, {0x1FC1,0,1}, {0x1FC2,180,2}, {0x1FC3,180,2},
+    {0x1FC4,180,2}, {0x1FC6,180,2}, {0x1FC7,180,2}, {0x1FC8,178,2}, {0x1FC9,178,2}, {0x1FCA,180,2}, {0x1FCB,180,2}, {0x1FCC,180,2},
+    {0x1FCD,0,1}, {0x1FCE,0,1}, {0x1FCF,0,1}, {0x1FD0,182,2}, {0x1FD1,182,2}, {0x1FD2,182,2}, {0x1FD3,182,2}, {0x1FD6,182,2},
+    {0x1FD7,182,2}, {0x1FD8,182,2}, {0x1FD9,182,2}, {0x1FDA,182,2}, {0x1FDB,182,2}, {0x1FDD,0,1}, {0x1FDE,0,1}, {0x1FDF,0,1},
+    {0x1FE0,186,2}, {0x1FE1,186,2}, {0x1FE2,186,2}, {0x1FE3,186,2}, {0x1FE4,210,2}, {0x1FE5,210,2}, {0x1FE6,186,2}, {0x1FE7,186,2},
+    {0x1FE8,186,2}, {0x1FE9,186,2}, {0x1FEA,186,2}, {0x1FEB,186,2}, {0x1FEC,210,2}, {0x1FED,0,1}, {0x1FEE,0,1}, {0x1FEF,1476,1},
+    {0x1FF2,188,2}, {0x1FF3,188,2}, {0x1FF4,188,2}, {0x1FF6,188,2}, {0x1FF7,188,2}, {0x1FF8,184,2}, {0x1FF9,184,2}, {0x1FFA,188,2},
+    {0x1FFB,188,2}, {0x1FFC,188,2}, {0x1FFD,0,1}, {0x1FFE,0,1}, {0x2000,0,1}, {0x2001,0,1}, {0x2002,0,1}, {0x2003,0,1},
+    {0x2004,0,1}, {0x2005,0,1}, {0x2006,0,1}, {0x2007,0,1}, {0x2008,0,1}, {0x2009,0,1}, {0x200A,0,1}, {0x2011,1477,3},
+    {0x2017,0,1}, {0x2024,1480,1}, {0x2025,1481,2}, {0x2026,1480,3}, {0x202F,0,1}, {0x2033,1483,6}, {0x2034,1489,9}, {0x2036,1498,6},
+    {0x2037,1504,9}, {0x203C,1513,2}, {0x203E,0,1}, {0x2047,1515,2}, {0x2048,1517,2}, {0x2049,1514,2}, {0x2057,1483,12}, {0x205F,0,1},
+    {0x2070,1519,1}, {0x2071,26,1}, {0x2074,12,1}, {0x2075,1520,1}, {0x2076,1521,1}, {0x2077,1522,1}, {0x2078,1523,1}, {0x2079,1524,1},
+    {0x207A,1525,1}, {0x207B,1526,3}, {0x207C,1529,1}, {0x207D,1530,1}, {0x207E,1531,1}, {0x207F,28,1}, {0x2080,1519,1}, {0x2081,6,1},
+    {0x2082,2,1}, {0x2083,3,1}, {0x2084,12,1}, {0x2085,1520,1}, {0x2086,1521,1}, {0x2087,1522,1}, {0x2088,1523,1}, {0x2089,1524,1},
+    {0x208A,1525,1}, {0x208B,1526,3}, {0x208C,1529,1}, {0x208D,1530,1}, {0x208E,1531,1}, {0x2090,1,1}, {0x2091,24,1}, {0x2092,7,1},
+    {0x2093,162,1}, {0x2094,72,2}, {0x2095,32,1}, {0x2096,38,1}, {0x2097,39,1}, {0x2098,1394,1}, {0x2099,28,1}, {0x209A,1395,1},
+    {0x209B,33,1}, {0x209C,31,1}, {0x20A8,1532,2}, {0x20D0,165,0}, {0x20D1,165,0}, {0x20D2,165,0}, {0x20D3,165,0}, {0x20D4,165,0},
+    {0x20D5,165,0}, {0x20D6,165,0}, {0x20D7,165,0}, {0x20D8,165,0}, {0x20D9,165,0}, {0x20DA,165,0}, {0x20DB,165,0}, {0x20DC,165,0},
+    {0x20DD,165,0}, {0x20DE,165,0}, {0x20DF,165,0}, {0x20E0,165,0}, {0x20E1,165,0}, {0x20E2,165,0}, {0x20E3,165,0}, {0x20E4,165,0},
+    {0x20E5,165,0}, {0x20E6,165,0}, {0x20E7,165,0}, {0x20E8,165,0}, {0x20E9,165,0}, {0x20EA,165,0}, {0x20EB,165,0}, {0x20EC,165,0},
+    {0x20ED,165,0}, {0x20EE,165,0}, {0x20EF,165,0}, {0x20F0,165,0}, {0x2100,1534,3}, {0x2101,1537,3}, {0x2102,25,1}, {0x2103,1540,3},
+    {0x2105,1543,3}, {0x2106,1546,3}, {0x2107,74,2}, {0x2109,1549,3}, {0x210A,35,1}, {0x210B,32,1}, {0x210C,32,1}, {0x210D,32,1},
+    {0x210E,32,1}, {0x210F,32,1}, {0x2110,26,1}, {0x2111,26,1}, {0x2112,39,1}, {0x2113,39,1}, {0x2115,28,1}, {0x2116,1552,2},
+    {0x2119,1395,1}, {0x211A,1554,1}, {0x211B,50,1}, {0x211C,50,1}, {0x211D,50,1}, {0x2120,1555,2}, {0x2121,1557,3}, {0x2122,1560,2},
+    {0x2124,52,1}, {0x2126,188,2}, {0x2128,52,1}, {0x212A,38,1}, {0x212B,1,1}, {0x212C,53,1}, {0x212D,25,1}, {0x212F,24,1},
+    {0x2130,24,1}, {0x2131,1422,1}, {0x2132,1562,3}, {0x2133,1394,1}, {0x2134,7,1}, {0x2135,1565,2}, {0x2136,1567,2}, {0x2137,1569,2},
+    {0x2138,1571,2}, {0x2139,26,1}, {0x213B,1573,3}, {0x213C,208,2}, {0x213D,192,2}, {0x213E,192,2}, {0x213F,208,2}, {0x2140,1576,3},
+    {0x2145,27,1}, {0x2146,27,1}, {0x2147,24,1}, {0x2148,26,1}, {0x2149,37,1}, {0x2150,1579,5}, {0x2151,1584,5}, {0x2152,1589,6},
+    {0x2153,1595,5}, {0x2154,1600,5}, {0x2155,1605,5}, {0x2156,1610,5}, {0x2157,1615,5}, {0x2158,1620,5}, {0x2159,1625,5}, {0x215A,1630,5},
+    {0x215B,1635,5}, {0x215C,1640,5}, {0x215D,1645,5}, {0x215E,1650,5}, {0x215F,8,4}, {0x2160,26,1}, {0x2161,1655,2}, {0x2162,1657,3},
+    {0x2163,1660,2}, {0x2164,1414,1}, {0x2165,1662,2}, {0x2166,1664,3}, {0x2167,1667,4}, {0x2168,1671,2}, {0x2169,162,1}, {0x216A,1673,2},
+    {0x216B,1675,3}, {0x216C,39,1}, {0x216D,25,1}, {0x216E,27,1}, {0x216F,1394,1}, {0x2170,26,1}, {0x2171,1655,2}, {0x2172,1657,3},
+    {0x2173,1660,2}, {0x2174,1414,1}, {0x2175,1662,2}, {0x2176,1664,3}, {0x2177,1667,4}, {0x2178,1671,2}, {0x2179,162,1}, {0x217A,1673,2},
+    {0x217B,1675,3}, {0x217C,39,1}, {0x217D,25,1}, {0x217E,27,1}, {0x217F,1394,1}, {0x2183,1678,3}, {0x2189,1681,5}, {0x219A,1686,3},
+    {0x219B,1689,3}, {0x21AE,1692,3}, {0x21CD,1695,3}, {0x21CE,1698,3}, {0x21CF,1701,3}, {0x2204,1704,3}, {0x2209,1707,3}, {0x220C,1710,3},
+    {0x2224,1713,3}, {0x2226,1716,3}, {0x222C,1719,6}, {0x222D,1725,9}, {0x222F,1734,6}, {0x2230,1740,9}, {0x2241,1749,3}, {0x2244,1752,3},
+    {0x2247,1755,3}, {0x2249,1758,3}, {0x2260,1529,1}, {0x2262,1761,3}, {0x226D,1764,3}, {0x226E,1767,1}, {0x226F,1768,1}, {0x2270,1769,3},
+    {0x2271,1772,3}, {0x2274,1775,3}, {0x2275,1778,3}, {0x2278,1781,3}, {0x2279,1784,3}, {0x2280,1787,3}, {0x2281,1790,3}, {0x2284,1793,3},
+    {0x2285,1796,3}, {0x2288,1799,3}, {0x2289,1802,3}, {0x22AC,1805,3}, {0x22AD,1808,3}, {0x22AE,1811,3}, {0x22AF,1814,3}, {0x22E0,1817,3},
+    {0x22E1,1820,3}, {0x22E2,1823,3}, {0x22E3,1826,3}, {0x22EA,1829,3}, {0x22EB,1832,3}, {0x22EC,1835,3}, {0x22ED,1838,3}, {0x2329,1841,3},
+    {0x232A,1844,3}, {0x2460,6,1}, {0x2461,2,1}, {0x2462,3,1}, {0x2463,12,1}, {0x2464,1520,1}, {0x2465,1521,1}, {0x2466,1522,1},
+    {0x2467,1523,1}, {0x2468,1524,1}, {0x2469,1593,2}, {0x246A,1847,2}, {0x246B,1849,2}, {0x246C,1851,2}, {0x246D,1853,2}, {0x246E,1855,2},
+    {0x246F,1857,2}, {0x2470,1859,2}, {0x2471,1861,2}, {0x2472,1863,2}, {0x2473,1865,2}, {0x2474,1867,3}, {0x2475,1870,3}, {0x2476,1873,3},
+    {0x2477,1876,3}, {0x2478,1879,3}, {0x2479,1882,3}, {0x247A,1885,3}, {0x247B,1888,3}, {0x247C,1891,3}, {0x247D,1894,4}, {0x247E,1898,4},
+    {0x247F,1902,4}, {0x2480,1906,4}, {0x2481,1910,4}, {0x2482,1914,4}, {0x2483,1918,4}, {0x2484,1922,4}, {0x2485,1926,4}, {0x2486,1930,4},
+    {0x2487,1934,4}, {0x2488,1938,2}, {0x2489,1940,2}, {0x248A,1942,2}, {0x248B,1944,2}, {0x248C,1946,2}, {0x248D,1948,2}, {0x248E,1950,2},
+    {0x248F,1952,2}, {0x2490,1954,2}, {0x2491,1956,3}, {0x2492,1959,3}, {0x2493,1962,3}, {0x2494,1965,3}, {0x2495,1968,3}, {0x2496,1971,3},
+    {0x2497,1974,3}, {0x2498,1977,3}, {0x2499,1980,3}, {0x249A,1983,3}, {0x249B,1986,3}, {0x249C,1989,3}, {0x249D,1992,3}, {0x249E,1995,3},
+    {0x249F,1998,3}, {0x24A0,2001,3}, {0x24A1,2004,3}, {0x24A2,2007,3}, {0x24A3,2010,3}, {0x24A4,2013,3}, {0x24A5,2016,3}, {0x24A6,2019,3},
+    {0x24A7,2022,3}, {0x24A8,2025,3}, {0x24A9,2028,3}, {0x24AA,2031,3}, {0x24AB,2034,3}, {0x24AC,2037,3}, {0x24AD,2040,3}, {0x24AE,2043,3},
+    {0x24AF,2046,3}, {0x24B0,2049,3}, {0x24B1,2052,3}, {0x24B2,2055,3}, {0x24B3,2058,3}, {0x24B4,2061,3}, {0x24B5,2064,3}, {0x24B6,1,1},
+    {0x24B7,53,1}, {0x24B8,25,1}, {0x24B9,27,1}, {0x24BA,24,1}, {0x24BB,1422,1}, {0x24BC,35,1}, {0x24BD,32,1}, {0x24BE,26,1},
+    {0x24BF,37,1}, {0x24C0,38,1}, {0x24C1,39,1}, {0x24C2,1394,1}, {0x24C3,28,1}, {0x24C4,7,1}, {0x24C5,1395,1}, {0x24C6,1554,1},
+    {0x24C7,50,1}, {0x24C8,33,1}, {0x24C9,31,1}, {0x24CA,29,1}, {0x24CB,1414,1}, {0x24CC,51,1}, {0x24CD,162,1}, {0x24CE,30,1},
+    {0x24CF,52,1}, {0x24D0,1,1}, {0x24D1,53,1}, {0x24D2,25,1}, {0x24D3,27,1}, {0x24D4,24,1}, {0x24D5,1422,1}, {0x24D6,35,1},
+    {0x24D7,32,1}, {0x24D8,26,1}, {0x24D9,37,1}, {0x24DA,38,1}, {0x24DB,39,1}, {0x24DC,1394,1}, {0x24DD,28,1}, {0x24DE,7,1},
+    {0x24DF,1395,1}, {0x24E0,1554,1}, {0x24E1,50,1}, {0x24E2,33,1}, {0x24E3,31,1}, {0x24E4,29,1}, {0x24E5,1414,1}, {0x24E6,51,1},
+    {0x24E7,162,1}, {0x24E8,30,1}, {0x24E9,52,1}, {0x24EA,1519,1}, {0x2A0C,1719,12}, {0x2A74,2067,3}, {0x2A75,2070,2}, {0x2A76,2069,3},
+    {0x2ADC,2072,3}, {0x2C00,2075,3}, {0x2C01,2078,3}, {0x2C02,2081,3}, {0x2C03,2084,3}, {0x2C04,2087,3}, {0x2C05,2090,3}, {0x2C06,2093,3},
+    {0x2C07,2096,3}, {0x2C08,2099,3}, {0x2C09,2102,3}, {0x2C0A,2105,3}, {0x2C0B,2108,3}, {0x2C0C,2111,3}, {0x2C0D,2114,3}, {0x2C0E,2117,3},
+    {0x2C0F,2120,3}, {0x2C10,2123,3}, {0x2C11,2126,3}, {0x2C12,2129,3}, {0x2C13,2132,3}, {0x2C14,2135,3}, {0x2C15,2138,3}, {0x2C16,2141,3},
+    {0x2C17,2144,3}, {0x2C18,2147,3}, {0x2C19,2150,3}, {0x2C1A,2153,3}, {0x2C1B,2156,3}, {0x2C1C,2159,3}, {0x2C1D,2162,3}, {0x2C1E,2165,3},
+    {0x2C1F,2168,3}, {0x2C20,2171,3}, {0x2C21,2174,3}, {0x2C22,2177,3}, {0x2C23,2180,3}, {0x2C24,2183,3}, {0x2C25,2186,3}, {0x2C26,2189,3},
+    {0x2C27,2192,3}, {0x2C28,2195,3}, {0x2C29,2198,3}, {0x2C2A,2201,3}, {0x2C2B,2204,3}, {0x2C2C,2207,3}, {0x2C2D,2210,3}, {0x2C2E,2213,3},
+    {0x2C2F,2216,3}, {0x2C60,2219,3}, {0x2C62,2222,2}, {0x2C63,2224,3}, {0x2C64,2227,2}, {0x2C67,2229,3}, {0x2C69,2232,3}, {0x2C6B,2235,3},
+    {0x2C6D,1398,2}, {0x2C6E,1443,2}, {0x2C6F,1396,2}, {0x2C70,1418,2}, {0x2C72,2238,3}, {0x2C75,2241,3}, {0x2C7C,37,1}, {0x2C7D,1414,1},
+    {0x2C7E,2244,2}, {0x2C7F,2246,2}, {0x2C80,2248,3}, {0x2C82,2251,3}, {0x2C84,2254,3}, {0x2C86,2257,3}, {0x2C88,2260,3}, {0x2C8A,2263,3},
+    {0x2C8C,2266,3}, {0x2C8E,2269,3}, {0x2C90,2272,3}, {0x2C92,2275,3}, {0x2C94,2278,3}, {0x2C96,2281,3}, {0x2C98,2284,3}, {0x2C9A,2287,3},
+    {0x2C9C,2290,3}, {0x2C9E,2293,3}, {0x2CA0,2296,3}, {0x2CA2,2299,3}, {0x2CA4,2302,3}, {0x2CA6,2305,3}, {0x2CA8,2308,3}, {0x2CAA,2311,3},
+    {0x2CAC,2314,3}, {0x2CAE,2317,3}, {0x2CB0,2320,3}, {0x2CB2,2323,3}, {0x2CB4,2326,3}, {0x2CB6,2329,3}, {0x2CB8,2332,3}, {0x2CBA,2335,3},
+    {0x2CBC,2338,3}, {0x2CBE,2341,3}, {0x2CC0,2344,3}, {0x2CC2,2347,3}, {0x2CC4,2350,3}, {0x2CC6,2353,3}, {0x2CC8,2356,3}, {0x2CCA,2359,3},
+    {0x2CCC,2362,3}, {0x2CCE,2365,3}, {0x2CD0,2368,3}, {0x2CD2,2371,3}, {0x2CD4,2374,3}, {0x2CD6,2377,3}, {0x2CD8,2380,3}, {0x2CDA,2383,3},
+    {0x2CDC,2386,3}, {0x2CDE,2389,3}, {0x2CE0,2392,3}, {0x2CE2,2395,3}, {0x2CEB,2398,3}, {0x2CED,2401,3}, {0x2CF2,2404,3}, {0x2D6F,2407,3},
+    {0x2E9F,2410,3}, {0x2EF3,2413,3}, {0x2F00,2416,3}, {0x2F01,2419,3}, {0x2F02,2422,3}, {0x2F03,2425,3}, {0x2F04,2428,3}, {0x2F05,2431,3},
+    {0x2F06,2434,3}, {0x2F07,2437,3}, {0x2F08,2440,3}, {0x2F09,2443,3}, {0x2F0A,2446,3}, {0x2F0B,2449,3}, {0x2F0C,2452,3}, {0x2F0D,2455,3},
+    {0x2F0E,2458,3}, {0x2F0F,2461,3}, {0x2F10,2464,3}, {0x2F11,2467,3}, {0x2F12,2470,3}, {0x2F13,2473,3}, {0x2F14,2476,3}, {0x2F15,2479,3},
+    {0x2F16,2482,3}, {0x2F17,2485,3}, {0x2F18,2488,3}, {0x2F19,2491,3}, {0x2F1A,2494,3}, {0x2F1B,2497,3}, {0x2F1C,2500,3}, {0x2F1D,2503,3},
+    {0x2F1E,2506,3}, {0x2F1F,2509,3}, {0x2F20,2512,3}, {0x2F21,2515,3}, {0x2F22,2518,3}, {0x2F23,2521,3}, {0x2F24,2524,3}, {0x2F25,2527,3},
+    {0x2F26,2530,3}, {0x2F27,2533,3}, {0x2F28,2536,3}, {0x2F29,2539,3}, {0x2F2A,2542,3}, {0x2F2B,2545,3}, {0x2F2C,2548,3}, {0x2F2D,2551,3},
+    {0x2F2E,2554,3}, {0x2F2F,2557,3}, {0x2F30,2560,3}, {0x2F31,2563,3}, {0x2F32,2566,3}, {0x2F33,2569,3}, {0x2F34,2572,3}, {0x2F35,2575,3},
+    {0x2F36,2578,3}, {0x2F37,2581,3}, {0x2F38,2584,3}, {0x2F39,2587,3}, {0x2F3A,2590,3}, {0x2F3B,2593,3}, {0x2F3C,2596,3}, {0x2F3D,2599,3},
+    {0x2F3E,2602,3}, {0x2F3F,2605,3}, {0x2F40,2608,3}, {0x2F41,2611,3}, {0x2F42,2614,3}, {0x2F43,2617,3}, {0x2F44,2620,3}, {0x2F45,2623,3},
+    {0x2F46,2626,3}, {0x2F47,2629,3}, {0x2F48,2632,3}, {0x2F49,2635,3}, {0x2F4A,2638,3}, {0x2F4B,2641,3}, {0x2F4C,2644,3}, {0x2F4D,2647,3},
+    {0x2F4E,2650,3}, {0x2F4F,2653,3}, {0x2F50,2656,3}, {0x2F51,2659,3}, {0x2F52,2662,3}, {0x2F53,2665,3}, {0x2F54,2668,3}, {0x2F55,2671,3},
+    {0x2F56,2674,3}, {0x2F57,2677,3}, {0x2F58,2680,3}, {0x2F59,2683,3}, {0x2F5A,2686,3}, {0x2F5B,2689,3}, {0x2F5C,2692,3}, {0x2F5D,2695,3},
+    {0x2F5E,2698,3}, {0x2F5F,2701,3}, {0x2F60,2704,3}, {0x2F61,2707,3}, {0x2F62,2710,3}, {0x2F63,2713,3}, {0x2F64,2716,3}, {0x2F65,2719,3},
+    {0x2F66,2722,3}, {0x2F67,2725,3}, {0x2F68,2728,3}, {0x2F69,2731,3}, {0x2F6A,2734,3}, {0x2F6B,2737,3}, {0x2F6C,2740,3}, {0x2F6D,2743,3},
+    {0x2F6E,2746,3}, {0x2F6F,2749,3}, {0x2F70,2752,3}, {0x2F71,2755,3}, {0x2F72,2758,3}, {0x2F73,2761,3}, {0x2F74,2764,3}, {0x2F75,2767,3},
+    {0x2F76,2770,3}, {0x2F77,2773,3}, {0x2F78,2776,3}, {0x2F79,2779,3}, {0x2F7A,2782,3}, {0x2F7B,2785,3}, {0x2F7C,2788,3}, {0x2F7D,2791,3},
+    {0x2F7E,2794,3}, {0x2F7F,2797,3}, {0x2F80,2800,3}, {0x2F81,2803,3}, {0x2F82,2806,3}, {0x2F83,2809,3}, {0x2F84,2812,3}, {0x2F85,2815,3},
+    {0x2F86,2818,3}, {0x2F87,2821,3}, {0x2F88,2824,3}, {0x2F89,2827,3}, {0x2F8A,2830,3}, {0x2F8B,2833,3}, {0x2F8C,2836,3}, {0x2F8D,2839,3},
+    {0x2F8E,2842,3}, {0x2F8F,2845,3}, {0x2F90,2848,3}, {0x2F91,2851,3}, {0x2F92,2854,3}, {0x2F93,2857,3}, {0x2F94,2860,3}, {0x2F95,2863,3},
+    {0x2F96,2866,3}, {0x2F97,2869,3}, {0x2F98,2872,3}, {0x2F99,2875,3}, {0x2F9A,2878,3}, {0x2F9B,2881,3}, {0x2F9C,2884,3}, {0x2F9D,2887,3},
+    {0x2F9E,2890,3}, {0x2F9F,2893,3}, {0x2FA0,2896,3}, {0x2FA1,2899,3}, {0x2FA2,2902,3}, {0x2FA3,2905,3}, {0x2FA4,2908,3}, {0x2FA5,2911,3},
+    {0x2FA6,2914,3}, {0x2FA7,2917,3}, {0x2FA8,2920,3}, {0x2FA9,2923,3}, {0x2FAA,2926,3}, {0x2FAB,2929,3}, {0x2FAC,2932,3}, {0x2FAD,2935,3},
+    {0x2FAE,2938,3}, {0x2FAF,2941,3}, {0x2FB0,2944,3}, {0x2FB1,2947,3}, {0x2FB2,2950,3}, {0x2FB3,2953,3}, {0x2FB4,2956,3}, {0x2FB5,2959,3},
+    {0x2FB6,2962,3}, {0x2FB7,2965,3}, {0x2FB8,2968,3}, {0x2FB9,2971,3}, {0x2FBA,2974,3}, {0x2FBB,2977,3}, {0x2FBC,2980,3}, {0x2FBD,2983,3},
+    {0x2FBE,2986,3}, {0x2FBF,2989,3}, {0x2FC0,2992,3}, {0x2FC1,2995,3}, {0x2FC2,2998,3}, {0x2FC3,3001,3}, {0x2FC4,3004,3}, {0x2FC5,3007,3},
+    {0x2FC6,3010,3}, {0x2FC7,3013,3}, {0x2FC8,3016,3}, {0x2FC9,3019,3}, {0x2FCA,3022,3}, {0x2FCB,3025,3}, {0x2FCC,3028,3}, {0x2FCD,3031,3},
+    {0x2FCE,3034,3}, {0x2FCF,3037,3}, {0x2FD0,3040,3}, {0x2FD1,3043,3}, {0x2FD2,3046,3}, {0x2FD3,3049,3}, {0x2FD4,3052,3}, {0x2FD5,3055,3},
+    {0x3000,0,1}, {0x3036,3058,3}, {0x3038,2485,3}, {0x3039,3061,3}, {0x303A,3064,3}, {0x304C,3067,6}, {0x304E,3073,6}, {0x3050,3079,6},
+    {0x3052,3085,6}, {0x3054,3091,6}, {0x3056,3097,6}, {0x3058,3103,6}, {0x305A,3109,6}, {0x305C,3115,6}, {0x305E,3121,6}, {0x3060,3127,6},
+    {0x3062,3133,6}, {0x3065,3139,6}, {0x3067,3145,6}, {0x3069,3151,6}, {0x3070,3157,6}, {0x3071,3163,6}, {0x3073,3169,6}, {0x3074,3175,6},
+    {0x3076,3181,6}, {0x3077,3187,6}, {0x3079,3193,6}, {0x307A,3199,6}, {0x307C,3205,6}, {0x307D,3211,6}, {0x3094,3217,6}, {0x309B,3223,4},
+    {0x309C,3227,4}, {0x309E,3231,6}, {0x309F,3237,6}, {0x30AC,3243,6}, {0x30AE,3249,6}, {0x30B0,3255,6}, {0x30B2,3261,6}, {0x30B4,3267,6},
+    {0x30B6,3273,6}, {0x30B8,3279,6}, {0x30BA,3285,6}, {0x30BC,3291,6}, {0x30BE,3297,6}, {0x30C0,3303,6}, {0x30C2,3309,6}, {0x30C5,3315,6},
+    {0x30C7,3321,6}, {0x30C9,3327,6}, {0x30D0,3333,6}, {0x30D1,3339,6}, {0x30D3,3345,6}, {0x30D4,3351,6}, {0x30D6,3357,6}, {0x30D7,3363,6},
+    {0x30D9,3369,6}, {0x30DA,3375,6}, {0x30DC,3381,6}, {0x30DD,3387,6}, {0x30F4,3393,6}, {0x30F7,3399,6}, {0x30F8,3405,6}, {0x30F9,3411,6},
+    {0x30FA,3417,6}, {0x30FE,3423,6}, {0x30FF,3429,6}, {0x3131,3435,3}, {0x3132,3438,3}, {0x3133,3441,3}, {0x3134,3444,3}, {0x3135,3447,3},
+    {0x3136,3450,3}, {0x3137,3453,3}, {0x3138,3456,3}, {0x3139,3459,3}, {0x313A,3462,3}, {0x313B,3465,3}, {0x313C,3468,3}, {0x313D,3471,3},
+    {0x313E,3474,3}, {0x313F,3477,3}, {0x3140,3480,3}, {0x3141,3483,3}, {0x3142,3486,3}, {0x3143,3489,3}, {0x3144,3492,3}, {0x3145,3495,3},
+    {0x3146,3498,3}, {0x3147,3501,3}, {0x3148,3504,3}, {0x3149,3507,3}, {0x314A,3510,3}, {0x314B,3513,3}, {0x314C,3516,3}, {0x314D,3519,3},
+    {0x314E,3522,3}, {0x314F,3525,3}, {0x3150,3528,3}, {0x3151,3531,3}, {0x3152,3534,3}, {0x3153,3537,3}, {0x3154,3540,3}, {0x3155,3543,3},
+    {0x3156,3546,3}, {0x3157,3549,3}, {0x3158,3552,3}, {0x3159,3555,3}, {0x315A,3558,3}, {0x315B,3561,3}, {0x315C,3564,3}, {0x315D,3567,3},
+    {0x315E,3570,3}, {0x315F,3573,3}, {0x3160,3576,3}, {0x3161,3579,3}, {0x3162,3582,3}, {0x3163,3585,3}, {0x3164,3588,3}, {0x3165,3591,3},
+    {0x3166,3594,3}, {0x3167,3597,3}, {0x3168,3600,3}, {0x3169,3603,3}, {0x316A,3606,3}, {0x316B,3609,3}, {0x316C,3612,3}, {0x316D,3615,3},
+    {0x316E,3618,3}, {0x316F,3621,3}, {0x3170,3624,3}, {0x3171,3627,3}, {0x3172,3630,3}, {0x3173,3633,3}, {0x3174,3636,3}, {0x3175,3639,3},
+    {0x3176,3642,3}, {0x3177,3645,3}, {0x3178,3648,3}, {0x3179,3651,3}, {0x317A,3654,3}, {0x317B,3657,3}, {0x317C,3660,3}, {0x317D,3663,3},
+    {0x317E,3666,3}, {0x317F,3669,3}, {0x3180,3672,3}, {0x3181,3675,3}, {0x3182,3678,3}, {0x3183,3681,3}, {0x3184,3684,3}, {0x3185,3687,3},
+    {0x3186,3690,3}, {0x3187,3693,3}, {0x3188,3696,3}, {0x3189,3699,3}, {0x318A,3702,3}, {0x318B,3705,3}, {0x318C,3708,3}, {0x318D,3711,3},
+    {0x318E,3714,3}, {0x3192,2416,3}, {0x3193,2434,3}, {0x3194,3717,3}, {0x3195,3720,3}, {0x3196,3723,3}, {0x3197,3726,3}, {0x3198,3729,3},
+    {0x3199,3732,3}, {0x319A,2428,3}, {0x319B,3735,3}, {0x319C,3738,3}, {0x319D,3741,3}, {0x319E,3744,3}, {0x319F,2440,3}, {0xA640,3747,3},
+    {0xA642,3750,3}, {0xA644,3753,3}, {0xA646,3756,3}, {0xA648,3759,3}, {0xA64A,1256,3}, {0xA64C,3762,3}, {0xA64E,3765,3}, {0xA650,3768,3},
+    {0xA652,3771,3}, {0xA654,3774,3}, {0xA656,3777,3}, {0xA658,3780,3}, {0xA65A,3783,3}, {0xA65C,3786,3}, {0xA65E,3789,3}, {0xA660,3792,3},
+    {0xA662,3795,3}, {0xA664,3798,3}, {0xA666,3801,3}, {0xA668,3804,3}, {0xA66A,3807,3}, {0xA66C,3810,3}, {0xA680,3813,3}, {0xA682,3816,3},
+    {0xA684,3819,3}, {0xA686,3822,3}, {0xA688,3825,3}, {0xA68A,3828,3}, {0xA68C,3831,3}, {0xA68E,3834,3}, {0xA690,3837,3}, {0xA692,3840,3},
+    {0xA694,3843,3}, {0xA696,3846,3}, {0xA698,3849,3}, {0xA69A,3852,3}, {0xA69C,328,2}, {0xA69D,332,2}, {0xA722,3855,3}, {0xA724,3858,3},
+    {0xA726,3861,3}, {0xA728,3864,3}, {0xA72A,3867,3}, {0xA72C,3870,3}, {0xA72E,3873,3}, {0xA732,3876,3}, {0xA734,3879,3}, {0xA736,3882,3},
+    {0xA738,3885,3}, {0xA73A,3888,3}, {0xA73C,3891,3}, {0xA73E,3894,3}, {0xA740,3897,3}, {0xA742,3900,3}, {0xA744,3903,3}, {0xA746,3906,3},
+    {0xA748,3909,3}, {0xA74A,3912,3}, {0xA74C,3915,3}, {0xA74E,3918,3}, {0xA750,3921,3}, {0xA752,3924,3}, {0xA754,3927,3}, {0xA756,3930,3},
+    {0xA758,3933,3}, {0xA75A,3936,3}, {0xA75C,3939,3}, {0xA75E,3942,3}, {0xA760,3945,3}, {0xA762,3948,3}, {0xA764,3951,3}, {0xA766,3954,3},
+    {0xA768,3957,3}, {0xA76A,3960,3}, {0xA76C,3963,3}, {0xA76E,3966,3}, {0xA770,3966,3}, {0xA779,3969,3}, {0xA77B,3972,3}, {0xA77D,3975,3},
+    {0xA77E,3978,3}, {0xA780,3981,3}, {0xA782,3984,3}, {0xA784,3987,3}, {0xA786,3990,3}, {0xA78B,3993,3}, {0xA78D,1427,2}, {0xA790,3996,3},
+    {0xA792,3999,3}, {0xA796,4002,3}, {0xA798,4005,3}, {0xA79A,4008,3}, {0xA79C,4011,3}, {0xA79E,4014,3}, {0xA7A0,4017,3}, {0xA7A2,4020,3},
+    {0xA7A4,4023,3}, {0xA7A6,4026,3}, {0xA7A8,4029,3}, {0xA7AA,154,2}, {0xA7AB,1403,2}, {0xA7AC,1425,2}, {0xA7AD,4032,2}, {0xA7AE,1429,2},
+    {0xA7B0,4034,2}, {0xA7B1,4036,2}, {0xA7B2,1434,2}, {0xA7B3,4038,3}, {0xA7B4,4041,3}, {0xA7B6,4044,3}, {0xA7B8,4047,3}, {0xA7BA,4050,3},
+    {0xA7BC,4053,3}, {0xA7BE,4056,3}, {0xA7C0,4059,3}, {0xA7C2,4062,3}, {0xA7C4,4065,3}, {0xA7C5,1453,2}, {0xA7C6,4068,3}, {0xA7C7,4071,3},
+    {0xA7C9,4074,3}, {0xA7D0,4077,3}, {0xA7D6,4080,3}, {0xA7D8,4083,3}, {0xA7F2,25,1}, {0xA7F3,1422,1}, {0xA7F4,1554,1}, {0xA7F5,4086,3},
+    {0xA7F8,32,1}, {0xA7F9,48,2}, {0xAB5C,3861,3}, {0xAB5D,4089,3}, {0xAB5E,2222,2}, {0xAB5F,4092,3}, {0xAB69,4095,2}, {0xAB70,4097,3},
+    {0xAB71,4100,3}, {0xAB72,4103,3}, {0xAB73,4106,3}, {0xAB74,4109,3}, {0xAB75,4112,3}, {0xAB76,4115,3}, {0xAB77,4118,3}, {0xAB78,4121,3},
+    {0xAB79,4124,3}, {0xAB7A,4127,3}, {0xAB7B,4130,3}, {0xAB7C,4133,3}, {0xAB7D,4136,3}, {0xAB7E,4139,3}, {0xAB7F,4142,3}, {0xAB80,4145,3},
+    {0xAB81,4148,3}, {0xAB82,4151,3}, {0xAB83,4154,3}, {0xAB84,4157,3}, {0xAB85,4160,3}, {0xAB86,4163,3}, {0xAB87,4166,3}, {0xAB88,4169,3},
+    {0xAB89,4172,3}, {0xAB8A,4175,3}, {0xAB8B,4178,3}, {0xAB8C,4181,3}, {0xAB8D,4184,3}, {0xAB8E,4187,3}, {0xAB8F,4190,3}, {0xAB90,4193,3},
+    {0xAB91,4196,3}, {0xAB92,4199,3}, {0xAB93,4202,3}, {0xAB94,4205,3}, {0xAB95,4208,3}, {0xAB96,4211,3}, {0xAB97,4214,3}, {0xAB98,4217,3},
+    {0xAB99,4220,3}, {0xAB9A,4223,3}, {0xAB9B,4226,3}, {0xAB9C,4229,3}, {0xAB9D,4232,3}, {0xAB9E,4235,3}, {0xAB9F,4238,3}, {0xABA0,4241,3},
+    {0xABA1,4244,3}, {0xABA2,4247,3}, {0xABA3,4250,3}, {0xABA4,4253,3}, {0xABA5,4256,3}, {0xABA6,4259,3}, {0xABA7,4262,3}, {0xABA8,4265,3},
+    {0xABA9,4268,3}, {0xABAA,4271,3}, {0xABAB,4274,3}, {0xABAC,4277,3}, {0xABAD,4280,3}, {0xABAE,4283,3}, {0xABAF,4286,3}, {0xABB0,4289,3},
+    {0xABB1,4292,3}, {0xABB2,4295,3}, {0xABB3,4298,3}, {0xABB4,4301,3}, {0xABB5,4304,3}, {0xABB6,4307,3}, {0xABB7,4310,3}, {0xABB8,4313,3},
+    {0xABB9,4316,3}, {0xABBA,4319,3}, {0xABBB,4322,3}, {0xABBC,4325,3}, {0xABBD,4328,3}, {0xABBE,4331,3}, {0xABBF,4334,3}, {0xFB00,4337,2},
+    {0xFB01,4339,2}, {0xFB02,4341,2}, {0xFB03,4338,3}, {0xFB04,4343,3}, {0xFB05,4346,2}, {0xFB06,4346,2}, {0xFB13,4348,4}, {0xFB14,4352,4},
+    {0xFB15,4356,4}, {0xFB16,4360,4}, {0xFB17,4364,4}, {0xFB1D,4368,4}, {0xFB1F,4372,4}, {0xFB20,4376,2}, {0xFB21,1565,2}, {0xFB22,1571,2},
+    {0xFB23,4378,2}, {0xFB24,4380,2}, {0xFB25,4382,2}, {0xFB26,4384,2}, {0xFB27,4386,2}, {0xFB28,4388,2}, {0xFB29,1525,1}, {0xFB2A,4390,4},
+    {0xFB2B,4394,4}, {0xFB2C,4398,6}, {0xFB2D,4404,6}, {0xFB2E,4410,4}, {0xFB2F,4414,4}, {0xFB30,4418,4}, {0xFB31,4422,4}, {0xFB32,4426,4},
+    {0xFB33,4430,4}, {0xFB34,4434,4}, {0xFB35,4438,4}, {0xFB36,4442,4}, {0xFB38,4446,4}, {0xFB39,4450,4}, {0xFB3A,4454,4}, {0xFB3B,4458,4},
+    {0xFB3C,4462,4}, {0xFB3E,4466,4}, {0xFB40,4470,4}, {0xFB41,4474,4}, {0xFB43,4478,4}, {0xFB44,4482,4}, {0xFB46,4486,4}, {0xFB47,4490,4},
+    {0xFB48,4494,4}, {0xFB49,4398,4}, {0xFB4A,4498,4}, {0xFB4B,4502,4}, {0xFB4C,4506,4}, {0xFB4D,4510,4}, {0xFB4E,4514,4}, {0xFB4F,4518,4},
+    {0xFB50,4522,2}, {0xFB51,4522,2}, {0xFB52,4524,2}, {0xFB53,4524,2}, {0xFB54,4524,2}, {0xFB55,4524,2}, {0xFB56,4526,2}, {0xFB57,4526,2},
+    {0xFB58,4526,2}, {0xFB59,4526,2}, {0xFB5A,4528,2}, {0xFB5B,4528,2}, {0xFB5C,4528,2}, {0xFB5D,4528,2}, {0xFB5E,4530,2}, {0xFB5F,4530,2},
+    {0xFB60,4530,2}, {0xFB61,4530,2}, {0xFB62,4532,2}, {0xFB63,4532,2}, {0xFB64,4532,2}, {0xFB65,4532,2}, {0xFB66,4534,2}, {0xFB67,4534,2},
+    {0xFB68,4534,2}, {0xFB69,4534,2}, {0xFB6A,4536,2}, {0xFB6B,4536,2}, {0xFB6C,4536,2}, {0xFB6D,4536,2}, {0xFB6E,4538,2}, {0xFB6F,4538,2},
+    {0xFB70,4538,2}, {0xFB71,4538,2}, {0xFB72,4540,2}, {0xFB73,4540,2}, {0xFB74,4540,2}, {0xFB75,4540,2}, {0xFB76,4542,2}, {0xFB77,4542,2},
+    {0xFB78,4542,2}, {0xFB79,4542,2}, {0xFB7A,4544,2}, {0xFB7B,4544,2}, {0xFB7C,4544,2}, {0xFB7D,4544,2}, {0xFB7E,4546,2}, {0xFB7F,4546,2},
+    {0xFB80,4546,2}, {0xFB81,4546,2}, {0xFB82,4548,2}, {0xFB83,4548,2}, {0xFB84,4550,2}, {0xFB85,4550,2}, {0xFB86,4552,2}, {0xFB87,4552,2},
+    {0xFB88,4554,2}, {0xFB89,4554,2}, {0xFB8A,4556,2}, {0xFB8B,4556,2}, {0xFB8C,4558,2}, {0xFB8D,4558,2}, {0xFB8E,4560,2}, {0xFB8F,4560,2},
+    {0xFB90,4560,2}, {0xFB91,4560,2}, {0xFB92,4562,2}, {0xFB93,4562,2}, {0xFB94,4562,2}, {0xFB95,4562,2}, {0xFB96,4564,2}, {0xFB97,4564,2},
+    {0xFB98,4564,2}, {0xFB99,4564,2}, {0xFB9A,4566,2}, {0xFB9B,4566,2}, {0xFB9C,4566,2}, {0xFB9D,4566,2}, {0xFB9E,4568,2}, {0xFB9F,4568,2},
+    {0xFBA0,4570,2}, {0xFBA1,4570,2}, {0xFBA2,4570,2}, {0xFBA3,4570,2}, {0xFBA4,620,4}, {0xFBA5,620,4}, {0xFBA6,624,2}, {0xFBA7,624,2},
+    {0xFBA8,624,2}, {0xFBA9,624,2}, {0xFBAA,4572,2}, {0xFBAB,4572,2}, {0xFBAC,4572,2}, {0xFBAD,4572,2}, {0xFBAE,628,2}, {0xFBAF,628,2},
+    {0xFBB0,628,4}, {0xFBB1,628,4}, {0xFBD3,4574,2}, {0xFBD4,4574,2}, {0xFBD5,4574,2}, {0xFBD6,4574,2}, {0xFBD7,612,2}, {0xFBD8,612,2},
+    {0xFBD9,4576,2}, {0xFBDA,4576,2}, {0xFBDB,4578,2}, {0xFBDC,4578,2}, {0xFBDD,612,4}, {0xFBDE,4580,2}, {0xFBDF,4580,2}, {0xFBE0,4582,2},
+    {0xFBE1,4582,2}, {0xFBE2,4584,2}, {0xFBE3,4584,2}, {0xFBE4,4586,2}, {0xFBE5,4586,2}, {0xFBE6,4586,2}, {0xFBE7,4586,2}, {0xFBE8,4588,2},
+    {0xFBE9,4588,2}, {0xFBEA,600,6}, {0xFBEB,600,6}, {0xFBEC,4590,6}, {0xFBED,4590,6}, {0xFBEE,4596,6}, {0xFBEF,4596,6}, {0xFBF0,4602,6},
+    {0xFBF1,4602,6}, {0xFBF2,4608,6}, {0xFBF3,4608,6}, {0xFBF4,4614,6}, {0xFBF5,4614,6}, {0xFBF6,4620,6}, {0xFBF7,4620,6}, {0xFBF8,4620,6},
+    {0xFBF9,4626,6}, {0xFBFA,4626,6}, {0xFBFB,4626,6}, {0xFBFC,4632,2}, {0xFBFD,4632,2}, {0xFBFE,4632,2}, {0xFBFF,4632,2}, {0xFC00,4634,6},
+    {0xFC01,4640,6}, {0xFC02,4646,6}, {0xFC03,4626,6}, {0xFC04,4652,6}, {0xFC05,4658,4}, {0xFC06,4662,4}, {0xFC07,4666,4}, {0xFC08,4670,4},
+    {0xFC09,4674,4}, {0xFC0A,4678,4}, {0xFC0B,4682,4}, {0xFC0C,4686,4}, {0xFC0D,4690,4}, {0xFC0E,4694,4}, {0xFC0F,4698,4}, {0xFC10,4702,4},
+    {0xFC11,4706,4}, {0xFC12,4710,4}, {0xFC13,4714,4}, {0xFC14,4718,4}, {0xFC15,4722,4}, {0xFC16,4726,4}, {0xFC17,4724,4}, {0xFC18,4730,4},
+    {0xFC19,4734,4}, {0xFC1A,4738,4}, {0xFC1B,4742,4}, {0xFC1C,4746,4}, {0xFC1D,4750,4}, {0xFC1E,4754,4}, {0xFC1F,4758,4}, {0xFC20,4762,4},
+    {0xFC21,4766,4}, {0xFC22,4770,4}, {0xFC23,4774,4}, {0xFC24,4778,4}, {0xFC25,4782,4}, {0xFC26,4786,4}, {0xFC27,4790,4}, {0xFC28,4794,4},
+    {0xFC29,4798,4}, {0xFC2A,4802,4}, {0xFC2B,4806,4}, {0xFC2C,4810,4}, {0xFC2D,4814,4}, {0xFC2E,4818,4}, {0xFC2F,4822,4}, {0xFC30,4826,4},
+    {0xFC31,4830,4}, {0xFC32,4834,4}, {0xFC33,4838,4}, {0xFC34,4842,4}, {0xFC35,4846,4}, {0xFC36,4850,4}, {0xFC37,4854,4}, {0xFC38,4858,4},
+    {0xFC39,4862,4}, {0xFC3A,4866,4}, {0xFC3B,4870,4}, {0xFC3C,4874,4}, {0xFC3D,4878,4}, {0xFC3E,4882,4}, {0xFC3F,4886,4}, {0xFC40,4890,4},
+    {0xFC41,4894,4}, {0xFC42,4898,4}, {0xFC43,4902,4}, {0xFC44,4906,4}, {0xFC45,4910,4}, {0xFC46,4728,4}, {0xFC47,4732,4}, {0xFC48,4914,4},
+    {0xFC49,4918,4}, {0xFC4A,4650,4}, {0xFC4B,4922,4}, {0xFC4C,4926,4}, {0xFC4D,4930,4}, {0xFC4E,4934,4}, {0xFC4F,4938,4}, {0xFC50,4942,4},
+    {0xFC51,4946,4}, {0xFC52,4950,4}, {0xFC53,4954,4}, {0xFC54,4958,4}, {0xFC55,4720,4}, {0xFC56,4962,4}, {0xFC57,4966,4}, {0xFC58,4908,4},
+    {0xFC59,4970,4}, {0xFC5A,4960,4}, {0xFC5B,4974,4}, {0xFC5C,4978,4}, {0xFC5D,4982,4}, {0xFC5E,4986,5}, {0xFC5F,4991,5}, {0xFC60,4996,5},
+    {0xFC61,5001,5}, {0xFC62,5006,5}, {0xFC63,5011,5}, {0xFC64,5016,6}, {0xFC65,5022,6}, {0xFC66,4646,6}, {0xFC67,5028,6}, {0xFC68,4626,6},
+    {0xFC69,4652,6}, {0xFC6A,5034,4}, {0xFC6B,5038,4}, {0xFC6C,4670,4}, {0xFC6D,5042,4}, {0xFC6E,4674,4}, {0xFC6F,4678,4}, {0xFC70,5046,4},
+    {0xFC71,5050,4}, {0xFC72,4694,4}, {0xFC73,5054,4}, {0xFC74,4698,4}, {0xFC75,4702,4}, {0xFC76,5058,4}, {0xFC77,5062,4}, {0xFC78,4710,4},
+    {0xFC79,5066,4}, {0xFC7A,4714,4}, {0xFC7B,4718,4}, {0xFC7C,4830,4}, {0xFC7D,4834,4}, {0xFC7E,4846,4}, {0xFC7F,4850,4}, {0xFC80,4854,4},
+    {0xFC81,4870,4}, {0xFC82,4874,4}, {0xFC83,4878,4}, {0xFC84,4882,4}, {0xFC85,4898,4}, {0xFC86,4902,4}, {0xFC87,4906,4}, {0xFC88,5070,4},
+    {0xFC89,4914,4}, {0xFC8A,5074,4}, {0xFC8B,5078,4}, {0xFC8C,4934,4}, {0xFC8D,5082,4}, {0xFC8E,4938,4}, {0xFC8F,4942,4}, {0xFC90,4982,4},
+    {0xFC91,5086,4}, {0xFC92,5090,4}, {0xFC93,4908,4}, {0xFC94,5094,4}, {0xFC95,4970,4}, {0xFC96,4960,4}, {0xFC97,4634,6}, {0xFC98,4640,6},
+    {0xFC99,5098,6}, {0xFC9A,4646,6}, {0xFC9B,5104,6}, {0xFC9C,4658,4}, {0xFC9D,4662,4}, {0xFC9E,4666,4}, {0xFC9F,4670,4}, {0xFCA0,5110,4},
+    {0xFCA1,4682,4}, {0xFCA2,4686,4}, {0xFCA3,4690,4}, {0xFCA4,4694,4}, {0xFCA5,5114,4}, {0xFCA6,4710,4}, {0xFCA7,4722,4}, {0xFCA8,4726,4},
+    {0xFCA9,4724,4}, {0xFCAA,4730,4}, {0xFCAB,4734,4}, {0xFCAC,4742,4}, {0xFCAD,4746,4}, {0xFCAE,4750,4}, {0xFCAF,4754,4}, {0xFCB0,4758,4},
+    {0xFCB1,4762,4}, {0xFCB2,5118,4}, {0xFCB3,4766,4}, {0xFCB4,4770,4}, {0xFCB5,4774,4}, {0xFCB6,4778,4}, {0xFCB7,4782,4}, {0xFCB8,4786,4},
+    {0xFCB9,4794,4}, {0xFCBA,4798,4}, {0xFCBB,4802,4}, {0xFCBC,4806,4}, {0xFCBD,4810,4}, {0xFCBE,4814,4}, {0xFCBF,4818,4}, {0xFCC0,4822,4},
+    {0xFCC1,4826,4}, {0xFCC2,4838,4}, {0xFCC3,4842,4}, {0xFCC4,4858,4}, {0xFCC5,4862,4}, {0xFCC6,4866,4}, {0xFCC7,4870,4}, {0xFCC8,4874,4},
+    {0xFCC9,4886,4}, {0xFCCA,4890,4}, {0xFCCB,4894,4}, {0xFCCC,4898,4}, {0xFCCD,5122,4}, {0xFCCE,4910,4}, {0xFCCF,4728,4}, {0xFCD0,4732,4},
+    {0xFCD1,4914,4}, {0xFCD2,4922,4}, {0xFCD3,4926,4}, {0xFCD4,4930,4}, {0xFCD5,4934,4}, {0xFCD6,5126,4}, {0xFCD7,4946,4}, {0xFCD8,4950,4},
+    {0xFCD9,5130,4}, {0xFCDA,4720,4}, {0xFCDB,4962,4}, {0xFCDC,4966,4}, {0xFCDD,4908,4}, {0xFCDE,4944,4}, {0xFCDF,4646,6}, {0xFCE0,5104,6},
+    {0xFCE1,4670,4}, {0xFCE2,5110,4}, {0xFCE3,4694,4}, {0xFCE4,5114,4}, {0xFCE5,4710,4}, {0xFCE6,5134,4}, {0xFCE7,4758,4}, {0xFCE8,5138,4},
+    {0xFCE9,5142,4}, {0xFCEA,5146,4}, {0xFCEB,4870,4}, {0xFCEC,4874,4}, {0xFCED,4898,4}, {0xFCEE,4934,4}, {0xFCEF,5126,4}, {0xFCF0,4908,4},
+    {0xFCF1,4944,4}, {0xFCF2,5150,6}, {0xFCF3,5156,6}, {0xFCF4,5162,6}, {0xFCF5,5168,4}, {0xFCF6,5172,4}, {0xFCF7,5176,4}, {0xFCF8,5180,4},
+    {0xFCF9,5184,4}, {0xFCFA,5188,4}, {0xFCFB,5192,4}, {0xFCFC,5196,4}, {0xFCFD,5200,4}, {0xFCFE,5204,4}, {0xFCFF,5208,4}, {0xFD00,4644,4},
+    {0xFD01,5212,4}, {0xFD02,4638,4}, {0xFD03,5216,4}, {0xFD04,4968,4}, {0xFD05,5220,4}, {0xFD06,5224,4}, {0xFD07,5228,4}, {0xFD08,5232,4},
+    {0xFD09,5236,4}, {0xFD0A,5240,4}, {0xFD0B,5244,4}, {0xFD0C,5142,4}, {0xFD0D,5248,4}, {0xFD0E,5252,4}, {0xFD0F,5256,4}, {0xFD10,5260,4},
+    {0xFD11,5168,4}, {0xFD12,5172,4}, {0xFD13,5176,4}, {0xFD14,5180,4}, {0xFD15,5184,4}, {0xFD16,5188,4}, {0xFD17,5192,4}, {0xFD18,5196,4},
+    {0xFD19,5200,4}, {0xFD1A,5204,4}, {0xFD1B,5208,4}, {0xFD1C,4644,4}, {0xFD1D,5212,4}, {0xFD1E,4638,4}, {0xFD1F,5216,4}, {0xFD20,4968,4},
+    {0xFD21,5220,4}, {0xFD22,5224,4}, {0xFD23,5228,4}, {0xFD24,5232,4}, {0xFD25,5236,4}, {0xFD26,5240,4}, {0xFD27,5244,4}, {0xFD28,5142,4},
+    {0xFD29,5248,4}, {0xFD2A,5252,4}, {0xFD2B,5256,4}, {0xFD2C,5260,4}, {0xFD2D,5236,4}, {0xFD2E,5240,4}, {0xFD2F,5244,4}, {0xFD30,5142,4},
+    {0xFD31,5138,4}, {0xFD32,5146,4}, {0xFD33,4790,4}, {0xFD34,4746,4}, {0xFD35,4750,4}, {0xFD36,4754,4}, {0xFD37,5236,4}, {0xFD38,5240,4},
+    {0xFD39,5244,4}, {0xFD3A,4790,4}, {0xFD3B,4794,4}, {0xFD3C,5264,4}, {0xFD3D,5264,4}, {0xFD50,5268,6}, {0xFD51,5274,6}, {0xFD52,5274,6},
+    {0xFD53,5280,6}, {0xFD54,5286,6}, {0xFD55,5292,6}, {0xFD56,5298,6}, {0xFD57,5304,6}, {0xFD58,4726,6}, {0xFD59,4726,6}, {0xFD5A,5310,6},
+    {0xFD5B,5316,6}, {0xFD5C,5322,6}, {0xFD5D,5328,6}, {0xFD5E,5334,6}, {0xFD5F,5340,6}, {0xFD60,5340,6}, {0xFD61,5346,6}, {0xFD62,5352,6},
+    {0xFD63,5352,6}, {0xFD64,5358,6}, {0xFD65,5358,6}, {0xFD66,5364,6}, {0xFD67,5370,6}, {0xFD68,5370,6}, {0xFD69,5376,6}, {0xFD6A,5382,6},
+    {0xFD6B,5382,6}, {0xFD6C,5388,6}, {0xFD6D,5388,6}, {0xFD6E,5394,6}, {0xFD6F,5400,6}, {0xFD70,5400,6}, {0xFD71,5406,6}, {0xFD72,5406,6},
+    {0xFD73,5412,6}, {0xFD74,5418,6}, {0xFD75,5424,6}, {0xFD76,5430,6}, {0xFD77,5430,6}, {0xFD78,5436,6}, {0xFD79,5442,6}, {0xFD7A,5448,6},
+    {0xFD7B,5454,6}, {0xFD7C,5460,6}, {0xFD7D,5460,6}, {0xFD7E,5466,6}, {0xFD7F,5472,6}, {0xFD80,5478,6}, {0xFD81,5484,6}, {0xFD82,5490,6},
+    {0xFD83,5496,6}, {0xFD84,5496,6}, {0xFD85,5502,6}, {0xFD86,5502,6}, {0xFD87,5508,6}, {0xFD88,5508,6}, {0xFD89,5514,6}, {0xFD8A,4728,6},
+    {0xFD8B,5520,6}, {0xFD8C,5526,6}, {0xFD8D,4910,6}, {0xFD8E,4732,6}, {0xFD8F,5532,6}, {0xFD92,5538,6}, {0xFD93,5544,6}, {0xFD94,5550,6},
+    {0xFD95,5556,6}, {0xFD96,5562,6}, {0xFD97,5568,6}, {0xFD98,5568,6}, {0xFD99,5574,6}, {0xFD9A,5580,6}, {0xFD9B,5586,6}, {0xFD9C,5592,6},
+    {0xFD9D,5592,6}, {0xFD9E,5598,6}, {0xFD9F,5604,6}, {0xFDA0,5610,6}, {0xFDA1,5616,6}, {0xFDA2,5622,6}, {0xFDA3,5628,6}, {0xFDA4,5634,6},
+    {0xFDA5,5640,6}, {0xFDA6,5646,6}, {0xFDA7,5652,6}, {0xFDA8,5658,6}, {0xFDA9,5664,6}, {0xFDAA,5670,6}, {0xFDAB,5676,6}, {0xFDAC,5682,6},
+    {0xFDAD,5688,6}, {0xFDAE,4962,6}, {0xFDAF,5694,6}, {0xFDB0,5700,6}, {0xFDB1,5706,6}, {0xFDB2,5712,6}, {0xFDB3,5718,6}, {0xFDB4,5466,6},
+    {0xFDB5,5478,6}, {0xFDB6,5724,6}, {0xFDB7,5730,6}, {0xFDB8,5736,6}, {0xFDB9,5742,6}, {0xFDBA,5748,6}, {0xFDBB,5754,6}, {0xFDBC,5748,6},
+    {0xFDBD,5736,6}, {0xFDBE,5760,6}, {0xFDBF,5766,6}, {0xFDC0,5772,6}, {0xFDC1,5778,6}, {0xFDC2,5784,6}, {0xFDC3,5754,6}, {0xFDC4,5424,6},
+    {0xFDC5,5364,6}, {0xFDC6,5790,6}, {0xFDC7,5796,6}, {0xFE10,5802,1}, {0xFE11,5803,3}, {0xFE12,5806,3}, {0xFE13,2067,1}, {0xFE14,173,1},
+    {0xFE15,1513,1}, {0xFE16,1515,1}, {0xFE17,5809,3}, {0xFE18,5812,3}, {0xFE19,1480,3}, {0xFE20,165,0}, {0xFE21,165,0}, {0xFE22,165,0},
+    {0xFE23,165,0}, {0xFE24,165,0}, {0xFE25,165,0}, {0xFE26,165,0}, {0xFE27,165,0}, {0xFE28,165,0}, {0xFE29,165,0}, {0xFE2A,165,0},
+    {0xFE2B,165,0}, {0xFE2C,165,0}, {0xFE2D,165,0}, {0xFE2E,165,0}, {0xFE2F,165,0}, {0xFE30,1481,2}, {0xFE31,5815,3}, {0xFE32,5818,3},
+    {0xFE33,5821,1}, {0xFE34,5821,1}, {0xFE35,1530,1}, {0xFE36,1531,1}, {0xFE37,5822,1}, {0xFE38,5823,1}, {0xFE39,5824,3}, {0xFE3A,5827,3},
+    {0xFE3B,5830,3}, {0xFE3C,5833,3}, {0xFE3D,5836,3}, {0xFE3E,5839,3}, {0xFE3F,1841,3}, {0xFE40,1844,3}, {0xFE41,5842,3}, {0xFE42,5845,3},
+    {0xFE43,5848,3}, {0xFE44,5851,3}, {0xFE47,5854,1}, {0xFE48,5855,1}, {0xFE49,0,1}, {0xFE4A,0,1}, {0xFE4B,0,1}, {0xFE4C,0,1},
+    {0xFE4D,5821,1}, {0xFE4E,5821,1}, {0xFE4F,5821,1}, {0xFE50,5802,1}, {0xFE51,5803,3}, {0xFE52,1480,1}, {0xFE54,173,1}, {0xFE55,2067,1},
+    {0xFE56,1515,1}, {0xFE57,1513,1}, {0xFE58,5815,3}, {0xFE59,1530,1}, {0xFE5A,1531,1}, {0xFE5B,5822,1}, {0xFE5C,5823,1}, {0xFE5D,5824,3},
+    {0xFE5E,5827,3}, {0xFE5F,5856,1}, {0xFE60,5857,1}, {0xFE61,5858,1}, {0xFE62,1525,1}, {0xFE63,5859,1}, {0xFE64,1767,1}, {0xFE65,1768,1},
+    {0xFE66,1529,1}, {0xFE68,5860,1}, {0xFE69,5861,1}, {0xFE6A,5862,1}, {0xFE6B,5863,1}, {0xFE70,5864,3}, {0xFE71,5867,4}, {0xFE72,4986,3},
+    {0xFE74,4991,3}, {0xFE76,4996,3}, {0xFE77,5150,4}, {0xFE78,5001,3}, {0xFE79,5156,4}, {0xFE7A,5006,3}, {0xFE7B,5162,4}, {0xFE7C,5011,3},
+    {0xFE7D,5871,4}, {0xFE7E,5875,3}, {0xFE7F,5878,4}, {0xFE80,5882,2}, {0xFE81,584,4}, {0xFE82,584,4}, {0xFE83,588,4}, {0xFE84,588,4},
+    {0xFE85,592,4}, {0xFE86,592,4}, {0xFE87,596,4}, {0xFE88,596,4}, {0xFE89,600,4}, {0xFE8A,600,4}, {0xFE8B,600,4}, {0xFE8C,600,4},
+    {0xFE8D,584,2}, {0xFE8E,584,2}, {0xFE8F,4658,2}, {0xFE90,4658,2}, {0xFE91,4658,2}, {0xFE92,4658,2}, {0xFE93,5884,2}, {0xFE94,5884,2},
+    {0xFE95,4682,2}, {0xFE96,4682,2}, {0xFE97,4682,2}, {0xFE98,4682,2}, {0xFE99,4706,2}, {0xFE9A,4706,2}, {0xFE9B,4706,2}, {0xFE9C,4706,2},
+    {0xFE9D,4638,2}, {0xFE9E,4638,2}, {0xFE9F,4638,2}, {0xFEA0,4638,2}, {0xFEA1,4644,2}, {0xFEA2,4644,2}, {0xFEA3,4644,2}, {0xFEA4,4644,2},
+    {0xFEA5,4668,2}, {0xFEA6,4668,2}, {0xFEA7,4668,2}, {0xFEA8,4668,2}, {0xFEA9,5886,2}, {0xFEAA,5886,2}, {0xFEAB,4974,2}, {0xFEAC,4974,2},
+    {0xFEAD,4978,2}, {0xFEAE,4978,2}, {0xFEAF,5026,2}, {0xFEB0,5026,2}, {0xFEB1,4746,2}, {0xFEB2,4746,2}, {0xFEB3,4746,2}, {0xFEB4,4746,2},
+    {0xFEB5,5142,2}, {0xFEB6,5142,2}, {0xFEB7,5142,2}, {0xFEB8,5142,2}, {0xFEB9,4762,2}, {0xFEBA,4762,2}, {0xFEBB,4762,2}, {0xFEBC,4762,2},
+    {0xFEBD,4770,2}, {0xFEBE,4770,2}, {0xFEBF,4770,2}, {0xFEC0,4770,2}, {0xFEC1,4786,2}, {0xFEC2,4786,2}, {0xFEC3,4786,2}, {0xFEC4,4786,2},
+    {0xFEC5,4794,2}, {0xFEC6,4794,2}, {0xFEC7,4794,2}, {0xFEC8,4794,2}, {0xFEC9,4798,2}, {0xFECA,4798,2}, {0xFECB,4798,2}, {0xFECC,4798,2},
+    {0xFECD,4806,2}, {0xFECE,4806,2}, {0xFECF,4806,2}, {0xFED0,4806,2}, {0xFED1,4814,2}, {0xFED2,4814,2}, {0xFED3,4814,2}, {0xFED4,4814,2},
+    {0xFED5,4838,2}, {0xFED6,4838,2}, {0xFED7,4838,2}, {0xFED8,4838,2}, {0xFED9,4854,2}, {0xFEDA,4854,2}, {0xFEDB,4854,2}, {0xFEDC,4854,2},
+    {0xFEDD,4872,2}, {0xFEDE,4872,2}, {0xFEDF,4872,2}, {0xFEE0,4872,2}, {0xFEE1,4650,2}, {0xFEE2,4650,2}, {0xFEE3,4650,2}, {0xFEE4,4650,2},
+    {0xFEE5,4922,2}, {0xFEE6,4922,2}, {0xFEE7,4922,2}, {0xFEE8,4922,2}, {0xFEE9,4946,2}, {0xFEEA,4946,2}, {0xFEEB,4946,2}, {0xFEEC,4946,2},
+    {0xFEED,592,2}, {0xFEEE,592,2}, {0xFEEF,4588,2}, {0xFEF0,4588,2}, {0xFEF1,600,2}, {0xFEF2,600,2}, {0xFEF3,600,2}, {0xFEF4,600,2},
+    {0xFEF5,5888,6}, {0xFEF6,5888,6}, {0xFEF7,5894,6}, {0xFEF8,5894,6}, {0xFEF9,5900,6}, {0xFEFA,5900,6}, {0xFEFB,5888,4}, {0xFEFC,5888,4},
+    {0xFF01,1513,1}, {0xFF02,5906,1}, {0xFF03,5856,1}, {0xFF04,5861,1}, {0xFF05,5862,1}, {0xFF06,5857,1}, {0xFF07,5907,1}, {0xFF08,1530,1},
+    {0xFF09,1531,1}, {0xFF0A,5858,1}, {0xFF0B,1525,1}, {0xFF0C,5802,1}, {0xFF0D,5859,1}, {0xFF0E,1480,1}, {0xFF0F,1535,1}, {0xFF10,1519,1},
+    {0xFF11,6,1}, {0xFF12,2,1}, {0xFF13,3,1}, {0xFF14,12,1}, {0xFF15,1520,1}, {0xFF16,1521,1}, {0xFF17,1522,1}, {0xFF18,1523,1},
+    {0xFF19,1524,1}, {0xFF1A,2067,1}, {0xFF1B,173,1}, {0xFF1C,1767,1}, {0xFF1D,1529,1}, {0xFF1E,1768,1}, {0xFF1F,1515,1}, {0xFF20,5863,1},
+    {0xFF21,1,1}, {0xFF22,53,1}, {0xFF23,25,1}, {0xFF24,27,1}, {0xFF25,24,1}, {0xFF26,1422,1}, {0xFF27,35,1}, {0xFF28,32,1},
+    {0xFF29,26,1}, {0xFF2A,37,1}, {0xFF2B,38,1}, {0xFF2C,39,1}, {0xFF2D,1394,1}, {0xFF2E,28,1}, {0xFF2F,7,1}, {0xFF30,1395,1},
+    {0xFF31,1554,1}, {0xFF32,50,1}, {0xFF33,33,1}, {0xFF34,31,1}, {0xFF35,29,1}, {0xFF36,1414,1}, {0xFF37,51,1}, {0xFF38,162,1},
+    {0xFF39,30,1}, {0xFF3A,52,1}, {0xFF3B,5854,1}, {0xFF3C,5860,1}, {0xFF3D,5855,1}, {0xFF3E,5908,1}, {0xFF3F,5821,1}, {0xFF40,1476,1},
+    {0xFF41,1,1}, {0xFF42,53,1}, {0xFF43,25,1}, {0xFF44,27,1}, {0xFF45,24,1}, {0xFF46,1422,1}, {0xFF47,35,1}, {0xFF48,32,1},
+    {0xFF49,26,1}, {0xFF4A,37,1}, {0xFF4B,38,1}, {0xFF4C,39,1}, {0xFF4D,1394,1}, {0xFF4E,28,1}, {0xFF4F,7,1}, {0xFF50,1395,1},
+    {0xFF51,1554,1}, {0xFF52,50,1}, {0xFF53,33,1}, {0xFF54,31,1}, {0xFF55,29,1}, {0xFF56,1414,1}, {0xFF57,51,1}, {0xFF58,162,1},
+    {0xFF59,30,1}, {0xFF5A,52,1}, {0xFF5B,5822,1}, {0xFF5C,5909,1}, {0xFF5D,5823,1}, {0xFF5E,5910,1}, {0xFF5F,5911,3}, {0xFF60,5914,3},
+    {0xFF61,5806,3}, {0xFF62,5842,3}, {0xFF63,5845,3}, {0xFF64,5803,3}, {0xFF65,5917,3}, {0xFF66,3417,3}, {0xFF67,5920,3}, {0xFF68,5923,3},
+    {0xFF69,5926,3}, {0xFF6A,5929,3}, {0xFF6B,5932,3}, {0xFF6C,5935,3}, {0xFF6D,5938,3}, {0xFF6E,5941,3}, {0xFF6F,5944,3}, {0xFF70,5947,3},
+    {0xFF71,5950,3}, {0xFF72,5953,3}, {0xFF73,3393,3}, {0xFF74,5956,3}, {0xFF75,5959,3}, {0xFF76,3243,3}, {0xFF77,3249,3}, {0xFF78,3255,3},
+    {0xFF79,3261,3}, {0xFF7A,3267,3}, {0xFF7B,3273,3}, {0xFF7C,3279,3}, {0xFF7D,3285,3}, {0xFF7E,3291,3}, {0xFF7F,3297,3}, {0xFF80,3303,3},
+    {0xFF81,3309,3}, {0xFF82,3315,3}, {0xFF83,3321,3}, {0xFF84,3327,3}, {0xFF85,5962,3}, {0xFF86,5965,3}, {0xFF87,5968,3}, {0xFF88,5971,3},
+    {0xFF89,5974,3}, {0xFF8A,3333,3}, {0xFF8B,3345,3}, {0xFF8C,3357,3}, {0xFF8D,3369,3}, {0xFF8E,3381,3}, {0xFF8F,5977,3}, {0xFF90,5980,3},
+    {0xFF91,5983,3}, {0xFF92,5986,3}, {0xFF93,5989,3}, {0xFF94,5992,3}, {0xFF95,5995,3}, {0xFF96,5998,3}, {0xFF97,6001,3}, {0xFF98,6004,3},
+    {0xFF99,6007,3}, {0xFF9A,6010,3}, {0xFF9B,6013,3}, {0xFF9C,3399,3}, {0xFF9D,6016,3}, {0xFF9E,3070,3}, {0xFF9F,3166,3}, {0xFFA0,3588,3},
+    {0xFFA1,3435,3}, {0xFFA2,3438,3}, {0xFFA3,3441,3}, {0xFFA4,3444,3}, {0xFFA5,3447,3}, {0xFFA6,3450,3}, {0xFFA7,3453,3}, {0xFFA8,3456,3},
+    {0xFFA9,3459,3}, {0xFFAA,3462,3}, {0xFFAB,3465,3}, {0xFFAC,3468,3}, {0xFFAD,3471,3}, {0xFFAE,3474,3}, {0xFFAF,3477,3}, {0xFFB0,3480,3},
+    {0xFFB1,3483,3}, {0xFFB2,3486,3}, {0xFFB3,3489,3}, {0xFFB4,3492,3}, {0xFFB5,3495,3}, {0xFFB6,3498,3}, {0xFFB7,3501,3}, {0xFFB8,3504,3},
+    {0xFFB9,3507,3}, {0xFFBA,3510,3}, {0xFFBB,3513,3}, {0xFFBC,3516,3}, {0xFFBD,3519,3}, {0xFFBE,3522,3}, {0xFFC2,3525,3}, {0xFFC3,3528,3},
+    {0xFFC4,3531,3}, {0xFFC5,3534,3}, {0xFFC6,3537,3}, {0xFFC7,3540,3}, {0xFFCA,3543,3}, {0xFFCB,3546,3}, {0xFFCC,3549,3}, {0xFFCD,3552,3},
+    {0xFFCE,3555,3}, {0xFFCF,3558,3}, {0xFFD2,3561,3}, {0xFFD3,3564,3}, {0xFFD4,3567,3}, {0xFFD5,3570,3}, {0xFFD6,3573,3}, {0xFFD7,3576,3},
+    {0xFFDA,3579,3}, {0xFFDB,3582,3}, {0xFFDC,3585,3}, {0xFFE0,6019,2}, {0xFFE1,6021,2}, {0xFFE2,6023,2}, {0xFFE3,0,1}, {0xFFE4,6025,2},
+    {0xFFE5,6027,2}, {0xFFE6,6029,3}, {0xFFE8,6032,3}, {0xFFE9,1686,3}, {0xFFEA,6035,3}, {0xFFEB,1689,3}, {0xFFEC,6038,3}, {0xFFED,6041,3},
+    {0xFFEE,6044,3},
+};
+
+const fold_entry* find_fold(uint32_t code_point) {
+    const fold_entry* end = fold_table + _countof(fold_table);
+    const fold_entry* it = std::lower_bound(fold_table, end, code_point,
+        [](const fold_entry& entry, uint32_t cp) { return entry.code_point < cp; });
+    return (it != end && it->code_point == code_point) ? it : nullptr;
+}
+
+// Decode one UTF-8 sequence; returns its length, or 0 if it is malformed
+size_t decode_utf8(const unsigned char* p, size_t size, uint32_t& code_point) {
+    unsigned char c = p[0];
+    size_t length;
+    if (c >= 0xC2 && c <= 0xDF) { length = 2; code_point = c & 0x1F; }
+    else if (c >= 0xE0 && c <= 0xEF) { length = 3; code_point = c & 0x0F; }
+    else if (c >= 0xF0 && c <= 0xF4) { length = 4; code_point = c & 0x07; }
+    else return 0;
+
+    if (length > size) return 0;
+    for (size_t i = 1; i < length; i++) {
+        if ((p[i] & 0xC0) != 0x80) return 0;
+        code_point = (code_point << 6) | (p[i] & 0x3F);
+    }
+    return length;
+}
+
+} // namespace
+
+void unicode_fold_append(const char* data, size_t size, std::string& out) {
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+    size_t i = 0;
+    while (i < size) {
+        // ASCII runs are the common case
+        unsigned char c = p[i];
+        if (c < 0x80) {
+            out.push_back((c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : static_cast<char>(c));
+            i++;
+            continue;
+        }
+
+        uint32_t code_point = 0;
+        size_t length = decode_utf8(p + i, size - i, code_point);
+        if (length == 0) {
+            out.push_back(static_cast<char>(c));
+            i++;
+            continue;
+        }
+
+        const fold_entry* entry = code_point < 0x10000 ? find_fold(code_point) : nullptr;
+        if (entry) {
+            out.append(fold_pool + entry->offset, entry->length);
+        } else {
+            out.append(data + i, length);
+        }
+        i += length;
+    }
+}
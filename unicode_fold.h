@@ -0,0 +1,17 @@
+#pragma once
+#include "stdafx.h"
+#include <string>
+
+// Search folding for UTF-8 text, used to compare artist and title names:
+// compatibility decomposition (NFKD), accents removed, case folded. Latin letters
+// without a decomposition (ø, ł, đ, æ, ß ...) become their ASCII spelling;
+// Greek and Cyrillic keep their script but lose case and accents.
+// ASCII is lowercased; invalid UTF-8 and code points outside the BMP pass through.
+void unicode_fold_append(const char* data, size_t size, std::string& out);
+
+inline std::string unicode_fold(const std::string& s) {
+    std::string out;
+    out.reserve(s.size());
+    unicode_fold_append(s.data(), s.size(), out);
+    return out;
+}